@@ -0,0 +1,160 @@
+/* ---------------------------------------------------------------------------------------------
+* Module Name: Benchmark Safe Temperature Monitoring
+* File Name: channelStore_benchmark.c
+* Created on: 19.10.2026
+* Development Group: CKN GmbH
+* Project: FSQM SW Development Exercise
+* Dependencies: monitorTemp.c, channelStore.c, monitorCommon.c, clock_gettime() (POSIX)
+*
+* Description: This file contains a benchmark, which compares the scan of 1M channels kept in an
+* array of structures (all parameters of MonitorTemp() and the display text in one structure per channel)
+* with the scan of the same channels kept in the channel store (packed hot data, separate cold data)
+*
+* Build (from the repository root):
+*	gcc -O2 -ImonitorTemp benchmark/channelStore_benchmark.c monitorTemp/monitorTemp.c
+*		monitorTemp/channelStore.c monitorTemp/monitorCommon.c -lm -o channelStore_benchmark
+*
+* ----------------------------------------------------------------------------------------------
+* Versions:
+* Version: 0.1 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Initial version
+*
+* Version: 0.2 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Build with monitorCommon.c
+*
+* Version: 0.3 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Hot bytes per channel corrected to the 32 bit scan arrays
+*
+* ----------------------------------------------------------------------------------------------*/
+
+// Include system header files
+#include <stdio.h> // stdio.h is necessary for printing/reading via standard IO
+#include <stdlib.h> // stdlib.h is necessary for malloc/free
+#include <time.h> // time.h is necessary for clock_gettime
+// Include own header files
+#include "monitorTemp.h"
+#include "channelStore.h"
+
+// Definition of local (module level) constants
+// Number of channels
+static const unsigned int CHANNELS = 1000000;
+// Number of scans per measurement
+static const unsigned int SCANS = 20;
+
+// Declaration of types
+// One channel as array of structures, as it would be done without the channel store
+typedef struct {
+	char format;
+	float min_temp;
+	float max_temp;
+	float max_deltatemp;
+	float temp_sensor1;
+	float temp_sensor2;
+	unsigned int temp_ok;
+	char message[40];
+} ChannelRecord;
+
+// Declaration of local (module level) functions
+static double Seconds(void);
+
+
+/* -----------------------------------------------------------
+* Main function of the benchmark
+* 	Parameters: none
+* 	Return value: 0 if the benchmark was carried out, 1 otherwise
+* -----------------------------------------------------------*/
+int main(void) {
+
+	// Definition of local variables
+	ChannelRecord *records = malloc(CHANNELS * sizeof(ChannelRecord));	// channels as array of structures
+	ChannelStore store;					// channels in the channel store
+	unsigned int channel = 0;			// index of a channel
+	unsigned int index = 0;				// Loop index
+	unsigned int scan = 0;				// Loop index over the scans
+	unsigned int not_ok = 0;			// number of channels with alarm or failure (prevents removal of the scans)
+	float sensor1 = 0;					// reading of sensor 1
+	float sensor2 = 0;					// reading of sensor 2
+	double start = 0;					// start of a measurement in seconds
+	double aos_time = 0;				// time per channel of the array of structures in ns
+	double store_time = 0;				// time per channel of the channel store in ns
+	unsigned int store_bytes = (6 * sizeof(int32_t)) + sizeof(uint8_t);	// hot bytes per channel read/written by a scan (limits, readings, delta, result)
+
+	if((records == 0) || (ChannelStoreInit(&store, CHANNELS) == 0))
+	{
+		printf("benchmark: memory could not be allocated\n");
+		return 1;
+	}
+
+	for(index = 0; index < CHANNELS; index++)
+	{
+		sensor1 = 20.0f + (float)(index % 600) / 10.0f;
+		sensor2 = sensor1 + (float)(index % 7) / 2.0f;
+		records[index].format = 'C';
+		records[index].min_temp = -10.0f;
+		records[index].max_temp = 75.0f;
+		records[index].max_deltatemp = 2.0f;
+		records[index].temp_sensor1 = sensor1;
+		records[index].temp_sensor2 = sensor2;
+		records[index].message[0] = '\0';
+		ChannelStoreRegister(&store, "channel", 'C', -10.0f, 75.0f, 2.0f, &channel);
+		ChannelStoreSetReading(&store, channel, sensor1, sensor2);
+	}
+
+	/*Scan of the array of structures*/
+	start = Seconds();
+	for(scan = 0; scan < SCANS; scan++)
+	{
+		for(index = 0; index < CHANNELS; index++)
+		{
+			records[index].temp_ok = EvaluateTemp(records[index].format, records[index].min_temp, records[index].max_temp,
+					records[index].max_deltatemp, records[index].temp_sensor1, records[index].temp_sensor2);
+			not_ok += (records[index].temp_ok != 7);
+		}
+	}
+	aos_time = (Seconds() - start) * 1.0e9 / ((double)CHANNELS * SCANS);
+
+	/*Scan of the channel store*/
+	start = Seconds();
+	for(scan = 0; scan < SCANS; scan++)
+	{
+		not_ok += ChannelStoreScan(&store, 0, store.count);
+	}
+	store_time = (Seconds() - start) * 1.0e9 / ((double)CHANNELS * SCANS);
+
+	printf("channels: %u, scans: %u (alarms/failures: %u)\n", CHANNELS, SCANS, not_ok);
+	printf("array of structures: %3u bytes/channel, %8u cache lines/scan, %6.2f ns/channel\n",
+			(unsigned int)sizeof(ChannelRecord), (unsigned int)((CHANNELS * sizeof(ChannelRecord) + 63) / 64), aos_time);
+	printf("channel store:       %3u bytes/channel, %8u cache lines/scan, %6.2f ns/channel\n",
+			store_bytes, (CHANNELS * store_bytes + 63) / 64, store_time);
+
+	ChannelStoreFree(&store);
+	free(records);
+
+	return 0;
+}
+
+
+/*---------------------------------------------------
+* Definition of function Seconds()
+* Parameters: none
+* Return value:
+*	seconds: monotonic time in seconds as double
+------------------------------------------------------*/
+static double Seconds(void) {
+
+	// Definition of local variables
+	struct timespec now;				// actual time
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (double)now.tv_sec + ((double)now.tv_nsec * 1.0e-9);
+}
+
+
+// End of file channelStore_benchmark.c
@@ -0,0 +1,161 @@
+/* ---------------------------------------------------------------------------------------------
+* Module Name: Benchmark Safe Temperature Monitoring
+* File Name: dualChannel_benchmark.c
+* Created on: 19.10.2026
+* Development Group: CKN GmbH
+* Project: FSQM SW Development Exercise
+* Dependencies: monitorTemp.c, dualChannel.c, monitorCommon.c, POSIX threads (link with -pthread),
+* 		clock_gettime() and sysconf() (POSIX)
+*
+* Description: This file contains a benchmark, which compares the evaluation of a batch of 1M channels
+* by one channel (ValidateTempBatch()) with the dual channel evaluation (MonitorTempDualChannel(): both
+* channels in parallel on the same batch and cross-comparison of the results)
+*
+*  the dual channel evaluation must take less than twice the time of the single evaluation; the
+*  benchmark fails (return value 1) if the ratio is 2 or more; with less than 2 online cores both
+*  channels share one core, the ratio is then only printed
+*
+* Build (from the repository root):
+*	gcc -O2 -ImonitorTemp benchmark/dualChannel_benchmark.c monitorTemp/monitorTemp.c
+*		monitorTemp/dualChannel.c monitorTemp/monitorCommon.c -lm -pthread -o dualChannel_benchmark
+*
+* ----------------------------------------------------------------------------------------------
+* Versions:
+* Version: 0.1 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Initial version
+*
+* ----------------------------------------------------------------------------------------------*/
+
+// Include system header files
+#include <stdio.h> // stdio.h is necessary for printing/reading via standard IO
+#include <stdlib.h> // stdlib.h is necessary for malloc/free
+#include <time.h> // time.h is necessary for clock_gettime
+#include <unistd.h> // unistd.h is necessary for sysconf
+// Include own header files
+#include "monitorTemp.h"
+#include "dualChannel.h"
+
+// Definition of local (module level) constants
+// Number of channels
+static const unsigned int CHANNELS = 1000000;
+// Number of batches per measurement
+static const unsigned int BATCHES = 20;
+// Largest allowed ratio of the dual channel time to the single channel time
+static const double MAX_RATIO = 2.0;
+
+// Declaration of local (module level) functions
+static double Seconds(void);
+
+
+/* -----------------------------------------------------------
+* Main function of the benchmark
+* 	Parameters: none
+* 	Return value: 0 if the requirement is met (or cannot be measured), 1 otherwise
+* -----------------------------------------------------------*/
+int main(void) {
+
+	// Definition of local variables
+	char *format = malloc(CHANNELS);	// parameters of the batch
+	float *min_temp = malloc(CHANNELS * sizeof(float));
+	float *max_temp = malloc(CHANNELS * sizeof(float));
+	float *max_deltatemp = malloc(CHANNELS * sizeof(float));
+	float *temp_sensor1 = malloc(CHANNELS * sizeof(float));
+	float *temp_sensor2 = malloc(CHANNELS * sizeof(float));
+	unsigned int *temp_ok = malloc(CHANNELS * sizeof(unsigned int));	// results
+	unsigned int *result_a = malloc(CHANNELS * sizeof(unsigned int));	// results of channel A (masks of the single evaluation)
+	unsigned int *result_b = malloc(CHANNELS * sizeof(unsigned int));	// results of channel B
+	TempBatch batch = {format, min_temp, max_temp, max_deltatemp, temp_sensor1, temp_sensor2, CHANNELS};
+	DualChannel dual;					// context of the dual channel evaluation
+	long cores = sysconf(_SC_NPROCESSORS_ONLN);	// number of online cores
+	unsigned int index = 0;				// Loop index
+	unsigned int scan = 0;				// Loop index over the batches
+	unsigned int mismatches = 0;		// mismatches of the dual channel evaluation
+	double start = 0;					// start of a measurement in seconds
+	double single_time = 0;				// time per channel of the single evaluation in ns
+	double dual_time = 0;				// time per channel of the dual channel evaluation in ns
+	double ratio = 0;					// dual_time / single_time
+	int failed = 0;						// Return value
+
+	if((format == 0) || (min_temp == 0) || (max_temp == 0) || (max_deltatemp == 0) || (temp_sensor1 == 0)
+			|| (temp_sensor2 == 0) || (temp_ok == 0) || (result_a == 0) || (result_b == 0)
+			|| (DualChannelInit(&dual, 0, 1) == 0))
+	{
+		printf("benchmark: memory could not be allocated or threads could not be started\n");
+		return 1;
+	}
+
+	for(index = 0; index < CHANNELS; index++)
+	{
+		format[index] = ((index % 5) == 0) ? 'F' : 'C';
+		min_temp[index] = (format[index] == 'F') ? 14.0f : -10.0f;
+		max_temp[index] = (format[index] == 'F') ? 167.0f : 75.0f;
+		max_deltatemp[index] = 2.0f;
+		temp_sensor1[index] = 20.0f + (float)(index % 600) / 10.0f;
+		temp_sensor2[index] = temp_sensor1[index] + (float)(index % 7) / 2.0f;
+	}
+
+	/*Single evaluation (channel A only)*/
+	start = Seconds();
+	for(scan = 0; scan < BATCHES; scan++)
+	{
+		ValidateTempBatch(&batch, result_a, temp_ok);
+	}
+	single_time = (Seconds() - start) * 1.0e9 / ((double)CHANNELS * BATCHES);
+
+	/*Dual channel evaluation with cross-comparison*/
+	start = Seconds();
+	for(scan = 0; scan < BATCHES; scan++)
+	{
+		mismatches += MonitorTempDualChannel(&dual, &batch, temp_ok, result_a, result_b);
+	}
+	dual_time = (Seconds() - start) * 1.0e9 / ((double)CHANNELS * BATCHES);
+	ratio = dual_time / single_time;
+
+	printf("channels: %u, batches: %u, online cores: %ld (mismatches: %u)\n", CHANNELS, BATCHES, cores, mismatches);
+	printf("single channel: %6.2f ns/channel\n", single_time);
+	printf("dual channel:   %6.2f ns/channel, ratio %.2f (required: < %.1f)\n", dual_time, ratio, MAX_RATIO);
+	if(cores < 2)
+	{
+		printf("both channels share one core, the requirement is not checked\n");
+	}
+	else if(ratio >= MAX_RATIO)
+	{
+		printf("requirement not met\n");
+		failed = 1;
+	}
+
+	DualChannelShutdown(&dual);
+	free(format);
+	free(min_temp);
+	free(max_temp);
+	free(max_deltatemp);
+	free(temp_sensor1);
+	free(temp_sensor2);
+	free(temp_ok);
+	free(result_a);
+	free(result_b);
+
+	return failed;
+}
+
+
+/*---------------------------------------------------
+* Definition of function Seconds()
+* Parameters: none
+* Return value:
+*	seconds: monotonic time in seconds as double
+------------------------------------------------------*/
+static double Seconds(void) {
+
+	// Definition of local variables
+	struct timespec now;				// actual time
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (double)now.tv_sec + ((double)now.tv_nsec * 1.0e-9);
+}
+
+
+// End of file dualChannel_benchmark.c
@@ -0,0 +1,571 @@
+/* ---------------------------------------------------------------------------------------------
+* Module Name: Python Bindings Safe Temperature Monitoring
+* File Name: monitortemp_module.c
+* Created on: 19.10.2026
+* Development Group: CKN GmbH
+* Project: FSQM SW Development Exercise
+* Dependencies: monitorTemp.c (EvaluateTempEx()), Python C API (3.8 or later), POSIX threads (hardware
+* 		dependent, the evaluation is carried out in the calling thread on other systems)
+*
+* Description: This file contains the Python extension module "monitortemp", which evaluates arrays of
+* channels (e.g. NumPy arrays or array.array) with the C implementation of the monitoring.
+*
+*  evaluate(format, min_temp, max_temp, max_deltatemp, temp_sensor1, temp_sensor2, out=None, mask=None, threads=0)
+*  evaluates element i of all arguments with EvaluateTempEx() and stores the result in out[i] and the
+*  violation mask in mask[i]; every argument is either a scalar (used for all elements) or a contiguous
+*  buffer (buffer protocol): float32 or float64 for the temperatures, 1 byte per element for the format
+*  ('C', 'F', 'c', 'f'), 4 byte integers for out and mask (format 'I', 'i', 'L' or 'l', other buffers with
+*  4 byte elements, e.g. float32, raise TypeError)
+*
+*  the buffers are used in place (no copy, float64 values are converted element by element, as by a
+*  call of EvaluateTemp() from C); the GIL is released during the evaluation and large arrays are split
+*  over several threads
+*
+*  evaluate_one() evaluates a single channel and returns (temp_ok, violation_mask)
+*
+* Build (from the directory bindings/python):
+*	python setup.py build_ext --inplace
+*
+* ----------------------------------------------------------------------------------------------
+* Versions:
+* Version: 0.1 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Initial version
+*
+* Version: 0.2 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Result buffers must have an integer format, created result buffer with format I
+*
+* ----------------------------------------------------------------------------------------------*/
+
+#define PY_SSIZE_T_CLEAN
+// Include system header files
+#include <Python.h> // Python.h must be included first (Python C API)
+#include <string.h> // string.h is necessary for string operations
+#if defined(__unix__) || defined(__APPLE__)
+#include <pthread.h> // pthread.h is necessary for the evaluation threads
+#include <unistd.h> // unistd.h is necessary for sysconf()
+#endif
+// Include own header files
+#include "monitorTemp.h"
+
+// Definition of local (module level) constants
+// Minimum number of elements per evaluation thread
+static const Py_ssize_t MIN_ELEMENTS_PER_THREAD = 16384;
+// Constants usable as array sizes
+enum {
+	TEMPERATURES = 5,				// temperature arguments (min_temp, max_temp, max_deltatemp, temp_sensor1, temp_sensor2)
+	MAX_THREADS = 64				// maximum number of evaluation threads
+};
+
+// Declaration of types
+// One argument: scalar or buffer
+typedef struct {
+	Py_buffer view;					// buffer of the argument, view.obj is 0 for a scalar
+	const char *data;				// first element, 0 for a scalar
+	char type;						// 'f': float32, 'd': float64, 'b': 1 byte, 'I': 4 byte unsigned integer
+	float scalar;					// value of a scalar temperature
+	char scalar_format;				// value of a scalar format
+} Column;
+
+// Range of elements of one evaluation thread
+typedef struct {
+	const Column *format;			// format of the channels
+	const Column *temperature;		// TEMPERATURES temperature arguments
+	unsigned int *temp_ok;			// results, 0 if not requested
+	unsigned int *violation_mask;	// violation masks, 0 if not requested
+	Py_ssize_t first;				// first element
+	Py_ssize_t last;				// element after the last element
+} EvaluationJob;
+
+// Declaration of local (module level) functions
+static PyObject *Evaluate(PyObject *self, PyObject *args, PyObject *kwargs);
+static PyObject *EvaluateOne(PyObject *self, PyObject *args);
+static int GetTemperature(PyObject *object, Column *column, const char *name);
+static int GetFormat(PyObject *object, Column *column);
+static int GetResult(PyObject *object, Column *column, const char *name);
+static const char *ElementFormat(const Py_buffer *view);
+static void ReleaseColumn(Column *column);
+static void *EvaluateRange(void *argument);
+static Py_ssize_t ThreadCount(Py_ssize_t elements, Py_ssize_t requested);
+
+// Methods and definition of the module
+static PyMethodDef MONITORTEMP_METHODS[] = {
+	{"evaluate", (PyCFunction)(void (*)(void))Evaluate, METH_VARARGS | METH_KEYWORDS,
+			"evaluate(format, min_temp, max_temp, max_deltatemp, temp_sensor1, temp_sensor2, out=None, mask=None, threads=0)\n"
+			"Evaluates arrays of channels with EvaluateTempEx(); returns out (uint32 results 7, 3 or 5)."},
+	{"evaluate_one", EvaluateOne, METH_VARARGS,
+			"evaluate_one(format, min_temp, max_temp, max_deltatemp, temp_sensor1, temp_sensor2)\n"
+			"Evaluates one channel; returns (temp_ok, violation_mask)."},
+	{0, 0, 0, 0}
+};
+
+static struct PyModuleDef MONITORTEMP_MODULE = {
+	PyModuleDef_HEAD_INIT, "monitortemp", "Safe temperature monitoring (C implementation)", -1, MONITORTEMP_METHODS,
+	0, 0, 0, 0
+};
+
+
+/* -----------------------------------------------------------
+* Initialization function of the module
+* 	Parameters: none
+* 	Return value: module object, 0 on failure
+* -----------------------------------------------------------*/
+PyMODINIT_FUNC PyInit_monitortemp(void) {
+
+	// Definition of local variables
+	PyObject *module = PyModule_Create(&MONITORTEMP_MODULE);	// Return value
+
+	if((module != 0)
+			&& ((PyModule_AddIntConstant(module, "TEMP_VIOLATION", TEMP_VIOLATION) != 0)
+			|| (PyModule_AddIntConstant(module, "TEMP_ALARM_DELTA", TEMP_ALARM_DELTA) != 0)
+			|| (PyModule_AddIntConstant(module, "TEMP_ALARM_LOW", TEMP_ALARM_LOW) != 0)
+			|| (PyModule_AddIntConstant(module, "TEMP_ALARM_HIGH", TEMP_ALARM_HIGH) != 0)
+			|| (PyModule_AddIntConstant(module, "TEMP_ALARM", TEMP_ALARM) != 0)))
+	{
+		Py_DECREF(module);
+		module = 0;
+	}
+
+	return module;
+}
+
+
+// Definition of local (module level) functions
+
+/*---------------------------------------------------
+* Definition of function Evaluate()
+* Parameters:
+*	self: module
+*	args, kwargs: arguments of evaluate(), see description of the file
+* Return value:
+*	out: result buffer (the given one or a new memoryview of uint32), 0 with exception on failure
+------------------------------------------------------*/
+static PyObject *Evaluate(PyObject *self, PyObject *args, PyObject *kwargs) {
+
+	// Definition of local variables
+	static char *keywords[] = {"format", "min_temp", "max_temp", "max_deltatemp", "temp_sensor1", "temp_sensor2",
+			"out", "mask", "threads", 0};
+	static const char *names[TEMPERATURES] = {"min_temp", "max_temp", "max_deltatemp", "temp_sensor1", "temp_sensor2"};
+	PyObject *format_object = 0;		// argument format
+	PyObject *temperature_object[TEMPERATURES];	// temperature arguments
+	PyObject *out_object = Py_None;		// argument out
+	PyObject *mask_object = Py_None;	// argument mask
+	Py_ssize_t requested = 0;			// argument threads, 0: number of cores
+	Column format;						// format of the channels
+	Column temperature[TEMPERATURES];	// temperature arguments
+	Column result;						// results
+	Column mask;						// violation masks
+	Py_ssize_t length[TEMPERATURES + 3];	// number of elements of every buffer argument, -1 for scalars
+	Py_ssize_t elements = -1;			// number of channels
+	EvaluationJob job[MAX_THREADS];		// ranges of the threads
+	Py_ssize_t threads = 1;				// number of threads
+	Py_ssize_t index = 0;				// Loop index
+	PyObject *bytes = 0;				// memory of the created result buffer
+	PyObject *memory = 0;				// memoryview of the created result buffer (bytes)
+	PyObject *created = 0;				// result buffer created by this function (memoryview of uint32)
+	PyObject *returned = 0;				// Return value
+	int ok = 1;							// 0 after the first error
+#if defined(__unix__) || defined(__APPLE__)
+	pthread_t thread[MAX_THREADS];		// evaluation threads
+	Py_ssize_t started = 0;				// number of started threads
+#endif
+
+	(void)self;
+	memset(&format, 0, sizeof(format));
+	memset(temperature, 0, sizeof(temperature));
+	memset(&result, 0, sizeof(result));
+	memset(&mask, 0, sizeof(mask));
+
+	if(!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOOOO|OOn", keywords, &format_object, &temperature_object[0],
+			&temperature_object[1], &temperature_object[2], &temperature_object[3], &temperature_object[4],
+			&out_object, &mask_object, &requested))
+	{
+		return 0;
+	}
+
+	/*Arguments, all buffers must have the same number of elements*/
+	ok = (GetFormat(format_object, &format) == 0);
+	length[0] = (format.data != 0) ? format.view.len : -1;
+	for(index = 0; (index < TEMPERATURES) && ok; index++)
+	{
+		ok = (GetTemperature(temperature_object[index], &temperature[index], names[index]) == 0);
+		length[index + 1] = (temperature[index].data != 0) ? (temperature[index].view.len / temperature[index].view.itemsize) : -1;
+	}
+	if(ok && (out_object != Py_None))
+	{
+		ok = (GetResult(out_object, &result, "out") == 0);
+	}
+	length[TEMPERATURES + 1] = (result.data != 0) ? (result.view.len / 4) : -1;
+	if(ok && (mask_object != Py_None))
+	{
+		ok = (GetResult(mask_object, &mask, "mask") == 0);
+	}
+	length[TEMPERATURES + 2] = (mask.data != 0) ? (mask.view.len / 4) : -1;
+
+	for(index = 0; (index < TEMPERATURES + 3) && ok; index++)
+	{
+		if((length[index] >= 0) && (elements >= 0) && (length[index] != elements))
+		{
+			PyErr_SetString(PyExc_ValueError, "all array arguments must have the same number of elements");
+			ok = 0;
+		}
+		elements = (length[index] >= 0) ? length[index] : elements;
+	}
+	elements = (elements < 0) ? 1 : elements;
+
+	/*Result buffer, if not given*/
+	if(ok && (result.data == 0))
+	{
+		/*The created buffer has the format "I" like a given one, the memoryview holds the bytearray*/
+		bytes = PyByteArray_FromStringAndSize(0, elements * 4);
+		memory = (bytes != 0) ? PyMemoryView_FromObject(bytes) : 0;
+		created = (memory != 0) ? PyObject_CallMethod(memory, "cast", "s", "I") : 0;
+		Py_XDECREF(memory);
+		Py_XDECREF(bytes);
+		ok = (created != 0) && (GetResult(created, &result, "out") == 0);
+	}
+
+	if(ok)
+	{
+		threads = ThreadCount(elements, requested);
+		for(index = 0; index < threads; index++)
+		{
+			job[index].format = &format;
+			job[index].temperature = temperature;
+			job[index].temp_ok = (unsigned int *)result.data;
+			job[index].violation_mask = (unsigned int *)mask.data;
+			job[index].first = (elements * index) / threads;
+			job[index].last = (elements * (index + 1)) / threads;
+		}
+
+		/*The buffers stay valid, they are held until the end of the function*/
+		Py_BEGIN_ALLOW_THREADS
+#if defined(__unix__) || defined(__APPLE__)
+		for(started = 1; started < threads; started++)
+		{
+			if(pthread_create(&thread[started], 0, EvaluateRange, &job[started]) != 0)
+			{
+				break;
+			}
+		}
+		/*Ranges of threads which could not be started are evaluated by the calling thread*/
+		for(index = started; index < threads; index++)
+		{
+			EvaluateRange(&job[index]);
+		}
+		EvaluateRange(&job[0]);
+		for(index = 1; index < started; index++)
+		{
+			pthread_join(thread[index], 0);
+		}
+#else
+		for(index = 0; index < threads; index++)
+		{
+			EvaluateRange(&job[index]);
+		}
+#endif
+		Py_END_ALLOW_THREADS
+
+		returned = (created != 0) ? created : out_object;
+		Py_INCREF(returned);
+	}
+
+	ReleaseColumn(&format);
+	for(index = 0; index < TEMPERATURES; index++)
+	{
+		ReleaseColumn(&temperature[index]);
+	}
+	ReleaseColumn(&result);
+	ReleaseColumn(&mask);
+	Py_XDECREF(created);
+
+	return returned;
+}
+
+
+/*---------------------------------------------------
+* Definition of function EvaluateOne()
+* Parameters:
+*	self: module
+*	args: format (str of length 1) and the five temperatures (float)
+* Return value:
+*	tuple (temp_ok, violation_mask), 0 with exception on failure
+------------------------------------------------------*/
+static PyObject *EvaluateOne(PyObject *self, PyObject *args) {
+
+	// Definition of local variables
+	int format = 0;						// format of the channel
+	float temperature[TEMPERATURES];	// temperature arguments
+	unsigned int temp_ok = 0;			// result of the channel
+	unsigned int violation_mask = 0;	// violation mask of the channel
+	PyObject *returned = 0;				// Return value
+
+	(void)self;
+	if(PyArg_ParseTuple(args, "Cfffff", &format, &temperature[0], &temperature[1], &temperature[2],
+			&temperature[3], &temperature[4]))
+	{
+		temp_ok = EvaluateTempEx((char)format, temperature[0], temperature[1], temperature[2],
+				temperature[3], temperature[4], &violation_mask);
+		returned = Py_BuildValue("(II)", temp_ok, violation_mask);
+	}
+
+	return returned;
+}
+
+
+/*---------------------------------------------------
+* Definition of function GetTemperature()
+* Parameters:
+*	object: float (scalar) or contiguous buffer of float32 or float64
+*	column: argument
+*	name: name of the argument for the error message
+* Return value:
+*	0 if the argument could be used, -1 with exception otherwise
+------------------------------------------------------*/
+static int GetTemperature(PyObject *object, Column *column, const char *name) {
+
+	// Definition of local variables
+	int error = -1;						// Return value, defensive programming: initialize with -1 (failure)
+	const char *element = 0;			// element format of the buffer
+
+	if(PyFloat_Check(object) || PyLong_Check(object))
+	{
+		column->scalar = (float)PyFloat_AsDouble(object);
+		error = (PyErr_Occurred() != 0) ? -1 : 0;
+	}
+	else if(PyObject_GetBuffer(object, &column->view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) == 0)
+	{
+		element = ElementFormat(&column->view);
+		if((strcmp(element, "f") == 0) && (column->view.itemsize == 4))
+		{
+			column->type = 'f';
+			column->data = column->view.buf;
+			error = 0;
+		}
+		else if((strcmp(element, "d") == 0) && (column->view.itemsize == 8))
+		{
+			column->type = 'd';
+			column->data = column->view.buf;
+			error = 0;
+		}
+		else
+		{
+			PyBuffer_Release(&column->view);
+			column->view.obj = 0;
+			PyErr_Format(PyExc_TypeError, "%s must be float32 or float64 in native byte order", name);
+		}
+	}
+
+	return error;
+}
+
+
+/*---------------------------------------------------
+* Definition of function GetFormat()
+* Parameters:
+*	object: str of length 1 (scalar) or contiguous buffer with 1 byte per element
+*	column: argument
+* Return value:
+*	0 if the argument could be used, -1 with exception otherwise
+------------------------------------------------------*/
+static int GetFormat(PyObject *object, Column *column) {
+
+	// Definition of local variables
+	int error = -1;						// Return value, defensive programming: initialize with -1 (failure)
+	Py_UCS4 character = 0;				// character of a scalar format
+
+	if(PyUnicode_Check(object))
+	{
+		if(PyUnicode_GetLength(object) == 1)
+		{
+			character = PyUnicode_ReadChar(object, 0);
+			/*Other characters are passed as an invalid format, i.e. they result in 5*/
+			column->scalar_format = (character < 128) ? (char)character : '?';
+			error = 0;
+		}
+		else
+		{
+			PyErr_SetString(PyExc_ValueError, "format must be a single character or a buffer of 1 byte characters");
+		}
+	}
+	else if(PyObject_GetBuffer(object, &column->view, PyBUF_C_CONTIGUOUS) == 0)
+	{
+		if(column->view.itemsize == 1)
+		{
+			column->type = 'b';
+			column->data = column->view.buf;
+			error = 0;
+		}
+		else
+		{
+			PyBuffer_Release(&column->view);
+			column->view.obj = 0;
+			PyErr_SetString(PyExc_TypeError, "format must have 1 byte per element");
+		}
+	}
+
+	return error;
+}
+
+
+/*---------------------------------------------------
+* Definition of function GetResult()
+* Parameters:
+*	object: writable contiguous buffer of 4 byte integers
+*	column: argument
+*	name: name of the argument for the error message
+* Return value:
+*	0 if the argument could be used, -1 with exception otherwise
+------------------------------------------------------*/
+static int GetResult(PyObject *object, Column *column, const char *name) {
+
+	// Definition of local variables
+	int error = -1;						// Return value, defensive programming: initialize with -1 (failure)
+	const char *element = 0;			// element format of the buffer
+
+	if(PyObject_GetBuffer(object, &column->view, PyBUF_C_CONTIGUOUS | PyBUF_WRITABLE | PyBUF_FORMAT) == 0)
+	{
+		/*Only 4 byte integers, other buffers of 4 byte elements (e.g. float32) are rejected*/
+		element = ElementFormat(&column->view);
+		if((column->view.itemsize == 4) && (element[0] != '\0') && (element[1] == '\0')
+				&& (strchr("IiLl", element[0]) != 0))
+		{
+			column->type = 'I';
+			column->data = column->view.buf;
+			error = 0;
+		}
+		else
+		{
+			PyBuffer_Release(&column->view);
+			column->view.obj = 0;
+			PyErr_Format(PyExc_TypeError, "%s must be a writable buffer of 4 byte integers (format 'I', 'i', 'L' or 'l')", name);
+		}
+	}
+
+	return error;
+}
+
+
+/*---------------------------------------------------
+* Definition of function ElementFormat()
+* Parameters:
+*	view: buffer
+* Return value:
+*	element format without native byte order prefix ("@", "=", "<" on little endian systems)
+------------------------------------------------------*/
+static const char *ElementFormat(const Py_buffer *view) {
+
+	// Definition of local variables
+	const char *element = (view->format != 0) ? view->format : "B";	// Return value
+	const uint16_t order = 1;			// first byte is 1 on little endian systems
+
+	if((element[0] == '@') || (element[0] == '=') || ((element[0] == '<') && (*(const unsigned char *)&order == 1)))
+	{
+		element++;
+	}
+
+	return element;
+}
+
+
+/*---------------------------------------------------
+* Definition of function ReleaseColumn()
+* Parameters:
+*	column: argument, the buffer is released if there is one
+* Return value: none
+------------------------------------------------------*/
+static void ReleaseColumn(Column *column) {
+
+	if(column->view.obj != 0)
+	{
+		PyBuffer_Release(&column->view);
+		column->view.obj = 0;
+	}
+}
+
+
+/*---------------------------------------------------
+* Definition of function EvaluateRange()
+* Runs without GIL, must not use the Python C API
+* Parameters:
+*	argument: EvaluationJob
+* Return value:
+*	0
+------------------------------------------------------*/
+static void *EvaluateRange(void *argument) {
+
+	// Definition of local variables
+	const EvaluationJob *job = argument;	// range of the thread
+	float value[TEMPERATURES];			// temperatures of one element
+	char format = 0;					// format of one element
+	unsigned int violation_mask = 0;	// violation mask of one element
+	unsigned int temp_ok = 0;			// result of one element
+	Py_ssize_t index = 0;				// Loop index over the elements
+	unsigned int argument_index = 0;	// Loop index over the temperature arguments
+	const Column *column = 0;			// temperature argument
+
+	for(index = job->first; index < job->last; index++)
+	{
+		format = (job->format->data != 0) ? job->format->data[index] : job->format->scalar_format;
+		for(argument_index = 0; argument_index < TEMPERATURES; argument_index++)
+		{
+			column = &job->temperature[argument_index];
+			value[argument_index] = (column->type == 'f') ? ((const float *)column->data)[index]
+					: ((column->type == 'd') ? (float)((const double *)column->data)[index] : column->scalar);
+		}
+
+		temp_ok = EvaluateTempEx(format, value[0], value[1], value[2], value[3], value[4], &violation_mask);
+		if(job->temp_ok != 0)
+		{
+			job->temp_ok[index] = temp_ok;
+		}
+		if(job->violation_mask != 0)
+		{
+			job->violation_mask[index] = violation_mask;
+		}
+	}
+
+	return 0;
+}
+
+
+/*---------------------------------------------------
+* Definition of function ThreadCount()
+* Parameters:
+*	elements: number of elements
+*	requested: requested number of threads, 0 for the number of cores
+* Return value:
+*	threads: number of threads, between 1 and MAX_THREADS, at least MIN_ELEMENTS_PER_THREAD elements per thread
+------------------------------------------------------*/
+static Py_ssize_t ThreadCount(Py_ssize_t elements, Py_ssize_t requested) {
+
+	// Definition of local variables
+	Py_ssize_t threads = requested;		// Return value
+
+#if defined(__unix__) || defined(__APPLE__)
+	if(threads <= 0)
+	{
+		threads = (Py_ssize_t)sysconf(_SC_NPROCESSORS_ONLN);
+	}
+#endif
+	if(threads > (elements / MIN_ELEMENTS_PER_THREAD))
+	{
+		threads = elements / MIN_ELEMENTS_PER_THREAD;
+	}
+	if(threads > MAX_THREADS)
+	{
+		threads = MAX_THREADS;
+	}
+	if(threads < 1)
+	{
+		threads = 1;
+	}
+
+	return threads;
+}
+
+
+// End of file monitortemp_module.c
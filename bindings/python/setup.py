@@ -0,0 +1,30 @@
+# ---------------------------------------------------------------------------------------------
+# Module Name: Python Bindings Safe Temperature Monitoring
+# File Name: setup.py
+# Created on: 19.10.2026
+# Development Group: CKN GmbH
+# Project: FSQM SW Development Exercise
+#
+# Description: Build of the Python extension module "monitortemp" with the C implementation of
+# the monitoring (monitorTemp.c), e.g. python setup.py build_ext --inplace
+# ---------------------------------------------------------------------------------------------
+import os
+
+from setuptools import Extension, setup
+
+SOURCE_DIR = os.path.join("..", "..", "monitorTemp")
+
+setup(
+    name="monitortemp",
+    version="0.1",
+    description="Safe temperature monitoring (C implementation)",
+    ext_modules=[
+        Extension(
+            "monitortemp",
+            sources=["monitortemp_module.c", os.path.join(SOURCE_DIR, "monitorTemp.c")],
+            include_dirs=[SOURCE_DIR],
+            extra_compile_args=["-std=gnu11"],
+            libraries=["m"],
+        )
+    ],
+)
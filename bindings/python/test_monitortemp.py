@@ -0,0 +1,64 @@
+# ---------------------------------------------------------------------------------------------
+# Module Name: Python Bindings Testing Safe Temperature Monitoring
+# File Name: test_monitortemp.py
+# Created on: 19.10.2026
+# Development Group: CKN GmbH
+# Project: FSQM SW Development Exercise
+#
+# Description: Tests of the extension module "monitortemp"; the array results must be identical to
+# the results of single evaluations (EvaluateTempEx()), e.g. python -m unittest test_monitortemp
+# (after python setup.py build_ext --inplace). Uses array.array, so NumPy is not required.
+# ---------------------------------------------------------------------------------------------
+import array
+import unittest
+
+import monitortemp
+
+
+class MonitorTempBindingTest(unittest.TestCase):
+    def test_evaluate_one(self):
+        # BBT1, alarm in Fahrenheit (WBT4), NT3 (invalid format)
+        self.assertEqual(monitortemp.evaluate_one("C", -10.0, 80.0, 3.0, 55.1, 55.5), (7, 0))
+        self.assertEqual(monitortemp.evaluate_one("F", 32.0, 212.0, 5.0, 220.0, 200.0)[0], 3)
+        self.assertEqual(monitortemp.evaluate_one("K", -10.0, 80.0, 3.0, 55.1, 55.5)[0], 5)
+
+    def test_evaluate_arrays_in_place(self):
+        count = 100000
+        sensor1 = array.array("f", [-20.0 + (index % 1200) * 0.1 for index in range(count)])
+        sensor2 = array.array("d", [value + ((index % 9) - 4) for index, value in enumerate(sensor1)])
+        formats = bytearray(b"CF" * (count // 2))
+        out = array.array("I", bytes(4 * count))
+        mask = array.array("I", bytes(4 * count))
+        returned = monitortemp.evaluate(formats, -10.0, 80.0, 3.0, sensor1, sensor2, out=out, mask=mask, threads=4)
+        self.assertIs(returned, out)
+        for index in range(0, count, 97):
+            expected = monitortemp.evaluate_one(chr(formats[index]), -10.0, 80.0, 3.0, sensor1[index],
+                                                array.array("f", [sensor2[index]])[0])
+            self.assertEqual((out[index], mask[index]), expected)
+
+    def test_created_result(self):
+        out = monitortemp.evaluate("C", -10.0, 80.0, 3.0, array.array("f", [55.1, 85.0]), 55.5)
+        self.assertEqual(list(out), [7, 3])
+
+    def test_invalid_arguments(self):
+        with self.assertRaises(ValueError):
+            monitortemp.evaluate("C", -10.0, 80.0, 3.0, array.array("f", [1.0, 2.0]), array.array("f", [1.0]))
+        with self.assertRaises(TypeError):
+            monitortemp.evaluate("C", -10.0, 80.0, 3.0, array.array("i", [1]), 1.0)
+
+    def test_result_buffer_format(self):
+        # 4 byte elements which are not integers (float32) or 1 byte elements are rejected for out and mask
+        with self.assertRaises(TypeError):
+            monitortemp.evaluate("C", -10.0, 80.0, 3.0, 55.1, 55.5, out=array.array("f", [0.0]))
+        with self.assertRaises(TypeError):
+            monitortemp.evaluate("C", -10.0, 80.0, 3.0, 55.1, 55.5, mask=array.array("f", [0.0]))
+        with self.assertRaises(TypeError):
+            monitortemp.evaluate("C", -10.0, 80.0, 3.0, 55.1, 55.5, out=bytearray(4))
+        out = array.array("i", [0])
+        mask = array.array("I", [0])
+        monitortemp.evaluate("C", -10.0, 80.0, 3.0, 85.0, 85.0, out=out, mask=mask)
+        self.assertEqual((out[0], mask[0]), monitortemp.evaluate_one("C", -10.0, 80.0, 3.0, 85.0, 85.0))
+
+
+if __name__ == "__main__":
+    unittest.main()
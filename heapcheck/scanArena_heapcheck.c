@@ -0,0 +1,297 @@
+/* ---------------------------------------------------------------------------------------------
+* Module Name: Heap Check Safe Temperature Monitoring
+* File Name: scanArena_heapcheck.c
+* Created on: 19.10.2026
+* Development Group: CKN GmbH
+* Project: FSQM SW Development Exercise
+* Dependencies: scanArena.c, pipeline.c, monitorTemp.c, telemetry.c, monitorCommon.c, testVectors.c,
+* 		POSIX threads (link with -pthread), GNU linker option --wrap
+*
+* Description: This file contains a separate test program, which counts the heap calls of the scan arena,
+* the event pool and the pipeline after their initialization; no heap call is allowed in the cycles
+*
+*  the heap functions are wrapped by the linker (--wrap), so only the calls of the linked modules are
+*  counted and the allocator of the C library (or of a sanitizer) is not replaced; the program is built
+*  separately, so the wrapping does not affect the tests of monitorTemp_main.c
+*
+*  every counting window is checked against a control window with known calls of all wrapped functions
+*
+* Build (from the repository root):
+*	gcc -O2 -ImonitorTemp heapcheck/scanArena_heapcheck.c monitorTemp/scanArena.c monitorTemp/pipeline.c
+*		monitorTemp/monitorTemp.c monitorTemp/telemetry.c monitorTemp/monitorCommon.c monitorTemp/testVectors.c
+*		-lm -pthread -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc,--wrap=free,--wrap=aligned_alloc,
+*		--wrap=posix_memalign -o scanArena_heapcheck
+*
+* ----------------------------------------------------------------------------------------------
+* Versions:
+* Version: 0.1 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Initial version, counting moved here from scanarena_testing.c
+*
+* ----------------------------------------------------------------------------------------------*/
+
+// Include system header files
+#include <stdatomic.h> // stdatomic.h is necessary for the counters of the heap calls
+#include <stdio.h> // stdio.h is necessary for printing/reading via standard IO
+#include <stdlib.h> // stdlib.h is necessary for the heap functions
+// Include own header files
+#include "monitorTemp.h"
+#include "scanArena.h"
+#include "pipeline.h"
+#include "testVectors.h"
+
+// Definition of local (module level) variables
+// the wrapped heap functions are called without context, so the counters are module level variables
+static atomic_ulong heap_calls;			// number of heap calls while counting
+static atomic_uint counting;			// 1 while the heap calls are counted
+
+// Declaration of types
+// Context of the test functions of the pipeline
+typedef struct {
+	unsigned long acquired;				// number of acquired batches
+	unsigned long batches;				// number of batches to be acquired
+	unsigned long counted_from;			// batch whose publication starts the counting
+	unsigned long counted_until;		// batch whose publication stops the counting
+	unsigned long events;				// number of published events
+} HeapCheckContext;
+
+// Declaration of the heap functions of the C library (resolved by the linker option --wrap)
+extern void *__real_malloc(size_t size);
+extern void *__real_calloc(size_t count, size_t size);
+extern void *__real_realloc(void *pointer, size_t size);
+extern void __real_free(void *pointer);
+extern void *__real_aligned_alloc(size_t alignment, size_t size);
+extern int __real_posix_memalign(void **pointer, size_t alignment, size_t size);
+
+// Declaration of local (module level) functions
+void *__wrap_malloc(size_t size);
+void *__wrap_calloc(size_t count, size_t size);
+void *__wrap_realloc(void *pointer, size_t size);
+void __wrap_free(void *pointer);
+void *__wrap_aligned_alloc(size_t alignment, size_t size);
+int __wrap_posix_memalign(void **pointer, size_t alignment, size_t size);
+static void StartHeapCount(void);
+static unsigned long StopHeapCount(void);
+static unsigned int AcquireTestBatch(void *context, PipelineSlot *slot);
+static void PublishTestBatch(void *context, PipelineSlot *slot);
+
+
+/* -----------------------------------------------------------
+* Main function of the heap check
+* 	Parameters: none
+* 	Return value: 0 if no heap function was called in the cycles, 1 otherwise
+* -----------------------------------------------------------*/
+int main(void) {
+
+	// Definition of local variables
+	ScanArena arena;					// scratch memory of the cycles
+	EventPool pool;						// event records
+	ScanEvent *event = 0;				// acquired event record
+	Pipeline pipeline;					// pipeline with scan arena and event pool in every slot
+	HeapCheckContext context = {0, 50, 0, 44, 0};	// context of the test functions of the pipeline
+	void *volatile probe = 0;			// memory of the control window
+	void *aligned = 0;					// memory of posix_memalign() in the control window
+	unsigned long control_calls = 0;	// heap calls of the control window
+	unsigned long cycle_calls = 0;		// heap calls of the arena and event pool cycles
+	unsigned long pipeline_calls = 1;	// heap calls of the pipeline batches
+	unsigned long batches = 0;			// number of published batches
+	unsigned int *temp_ok = 0;			// results of one cycle, taken from the arena
+	unsigned int cycle = 0;				// Loop index over the cycles
+	unsigned int index = 0;				// Loop index over the channels
+	int failed = 0;						// Return value
+
+	if((ScanArenaInit(&arena, ScanArenaSizeFor(100)) == 0) || (EventPoolInit(&pool, 100) == 0))
+	{
+		printf("heap check: scan memory could not be allocated\n");
+		return 1;
+	}
+
+	/*Control window: every wrapped function once, with the 4 free() calls 9 heap calls*/
+	StartHeapCount();
+	probe = malloc(16);
+	free(probe);
+	probe = calloc(4, 4);
+	probe = realloc(probe, 32);
+	free(probe);
+	probe = aligned_alloc(64, 64);
+	free(probe);
+	if(posix_memalign(&aligned, 64, 64) == 0)
+	{
+		free(aligned);
+	}
+	control_calls = StopHeapCount();
+
+	/*10 cycles of 100 channels with scratch memory from the arena and events from the pool*/
+	StartHeapCount();
+	for(cycle = 0; cycle < 10; cycle++)
+	{
+		ScanArenaReset(&arena);
+		temp_ok = ScanArenaAlloc(&arena, 100 * sizeof(unsigned int));
+		for(index = 0; (index < 100) && (temp_ok != 0); index++)
+		{
+			temp_ok[index] = EvaluateTemp('C', -10.0f, 80.0f, 3.0f, 20.0f + (float)cycle, 90.0f);
+			event = (temp_ok[index] != 7) ? EventPoolAcquire(&pool) : 0;
+			if(event != 0)
+			{
+				event->channel = index;
+				(void)EventPoolRelease(&pool, event);
+			}
+		}
+	}
+	cycle_calls = StopHeapCount();
+
+	/*Pipeline: counted from the publication of batch 0 (all threads started) until batch 44 (no thread ended)*/
+	if(PipelineInit(&pipeline, 3, 4, AcquireTestBatch, 0, PublishTestBatch, &context) == 1)
+	{
+		batches = PipelineRun(&pipeline);
+		pipeline_calls = StopHeapCount();
+		PipelineFree(&pipeline);
+	}
+
+	printf("control window:  %lu heap calls (expected 9)\n", control_calls);
+	printf("arena and pool:  %lu heap calls in 10 cycles, %lu pool failures\n", cycle_calls, pool.failures);
+	printf("pipeline:        %lu heap calls in 44 batches, %lu batches, %lu events\n", pipeline_calls, batches, context.events);
+	failed = (control_calls != 9) || (cycle_calls != 0) || (pool.failures != 0) || (pipeline_calls != 0)
+			|| (batches != 50) || (context.events != 100);
+	printf("%s\n", (failed == 0) ? "heap check SUCCESFUL" : "heap check FAILED");
+
+	EventPoolFree(&pool);
+	ScanArenaFree(&arena);
+
+	return failed;
+}
+
+
+/*---------------------------------------------------
+* Definition of the wrapped heap functions
+* Count the call while counting is enabled and call the function of the C library
+------------------------------------------------------*/
+void *__wrap_malloc(size_t size) {
+
+	atomic_fetch_add(&heap_calls, atomic_load(&counting));
+	return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t count, size_t size) {
+
+	atomic_fetch_add(&heap_calls, atomic_load(&counting));
+	return __real_calloc(count, size);
+}
+
+void *__wrap_realloc(void *pointer, size_t size) {
+
+	atomic_fetch_add(&heap_calls, atomic_load(&counting));
+	return __real_realloc(pointer, size);
+}
+
+void __wrap_free(void *pointer) {
+
+	atomic_fetch_add(&heap_calls, atomic_load(&counting));
+	__real_free(pointer);
+}
+
+void *__wrap_aligned_alloc(size_t alignment, size_t size) {
+
+	atomic_fetch_add(&heap_calls, atomic_load(&counting));
+	return __real_aligned_alloc(alignment, size);
+}
+
+int __wrap_posix_memalign(void **pointer, size_t alignment, size_t size) {
+
+	atomic_fetch_add(&heap_calls, atomic_load(&counting));
+	return __real_posix_memalign(pointer, alignment, size);
+}
+
+
+/*---------------------------------------------------
+* Definition of function StartHeapCount()
+* Starts the counting of the heap calls of all threads
+* Parameters: none
+* Return value: none
+------------------------------------------------------*/
+static void StartHeapCount(void) {
+
+	atomic_store(&heap_calls, 0);
+	atomic_store(&counting, 1u);
+}
+
+
+/*---------------------------------------------------
+* Definition of function StopHeapCount()
+* Parameters: none
+* Return value:
+*	calls: unsigned long, number of heap calls since StartHeapCount()
+------------------------------------------------------*/
+static unsigned long StopHeapCount(void) {
+
+	atomic_store(&counting, 0u);
+
+	return atomic_load(&heap_calls);
+}
+
+
+/*---------------------------------------------------
+* Definition of function AcquireTestBatch()
+* Acquisition of the heap check: vectors of BBT1, BBT2, NT1 and NT2 (testVectors.c), channels 2 and 3 with failure
+* Parameters:
+*	context: HeapCheckContext
+*	slot: slot to be filled
+* Return value:
+*	acquired: unsigned integer, 1 if a batch was acquired, 0 after the last batch
+------------------------------------------------------*/
+static unsigned int AcquireTestBatch(void *context, PipelineSlot *slot) {
+
+	// Definition of local variables
+	HeapCheckContext *check = context;	// context of the heap check
+	const TestVector *vector = 0;		// vector of the actual channel
+	unsigned int index = 0;				// Loop index
+	unsigned int acquired = 0;			// Return value
+
+	if(check->acquired < check->batches)
+	{
+		for(index = 0; index < 4; index++)
+		{
+			vector = TestVectorGet(TEST_VECTOR_BBT1 + index);
+			slot->format[index] = vector->format;
+			slot->min_temp[index] = vector->min_temp;
+			slot->max_temp[index] = vector->max_temp;
+			slot->max_deltatemp[index] = vector->max_deltatemp;
+			slot->temp_sensor1[index] = vector->temp_sensor1;
+			slot->temp_sensor2[index] = vector->temp_sensor2;
+		}
+		slot->batch.count = 4;
+		check->acquired++;
+		acquired = 1;
+	}
+
+	return acquired;
+}
+
+
+/*---------------------------------------------------
+* Definition of function PublishTestBatch()
+* Publication of the heap check: counts the events and starts/stops the counting of the heap calls
+* Parameters:
+*	context: HeapCheckContext
+*	slot: slot with the results and events
+* Return value: none
+------------------------------------------------------*/
+static void PublishTestBatch(void *context, PipelineSlot *slot) {
+
+	// Definition of local variables
+	HeapCheckContext *check = context;	// context of the heap check
+
+	if(slot->sequence == check->counted_from)
+	{
+		StartHeapCount();
+	}
+	check->events += slot->event_count;
+	if(slot->sequence == check->counted_until)
+	{
+		(void)StopHeapCount();
+	}
+}
+
+
+// End of file scanArena_heapcheck.c
@@ -0,0 +1,423 @@
+/* ---------------------------------------------------------------------------------------------
+* Module Name: Safe Temperature Monitoring
+* File Name: channelStore.c
+* Corresponding Header-File: channelStore.h
+* Created on: 19.10.2026
+* Development Group: CKN GmbH
+* Project: FSQM SW Development Exercise
+* Dependencies: stdint.h, stdlib.h (memory is only allocated in ChannelStoreInit()),
+* 		monitorCommon.c (absolute temperatures, ToCentiDegree())
+*
+* Description: This file contains the functions of the channel store.
+*
+*  channelStoreInit() allocates all arrays in one memory block, every array starts at a cache line
+*
+*  channelStoreRegister() checks the limits of a channel (as EvaluateTemp()) and stores them in scan units;
+*  limits of Fahrenheit channels are converted with the offset of the Fahrenheit scale, the delta without
+*
+*  channelStoreSetReading() rounds the readings of both sensors of a channel to centi-degree of the registered
+*  unit (as CheckTemp()) and stores them in scan units, together with the difference of their magnitudes in
+*  whole degrees of the registered unit; readings beyond the absolute temperatures of the registered unit are
+*  stored as invalid; the readings are also stored in centi-degree Celsius for analysis, saturated to 16 bit
+*  (they are out of every registered range anyway)
+*
+*  channelStoreScan() evaluates a range of channels as CheckTemp() does, without any branch in the loop;
+*  as all channels are stored in the same unit, Celsius and Fahrenheit channels are evaluated by the same
+*  loop, and as every centi-degree of both formats is an exact number of scan units, the comparisons
+*  give the same result as in the registered unit
+*
+*  channelStoreNativeCenti() and channelStoreNativeTemp() convert a stored temperature back to the registered
+*  format for presentation, channelStoreCentiCelsius() to centi-degree Celsius
+*
+* ----------------------------------------------------------------------------------------------
+* Versions:
+* Version: 0.1 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Initial version, channel store with hot/cold split
+*
+* Version: 0.2 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Normalization of all channels to centi-degree Celsius, ChannelStoreNativeTemp() added
+*
+* Version: 0.3 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Shared constants and helpers taken from monitorCommon.h
+*
+* Version: 0.4 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Scan unit 1/900 degree Celsius, delta compared in whole degrees of the registered unit,
+* validity checked in the registered unit as in EvaluateTemp()
+*
+* Version: 0.5 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Unused display text removed from ChannelInfo
+*
+* ----------------------------------------------------------------------------------------------*/
+
+// Include system header files
+#include <stdint.h> // stdint.h is necessary for the fixed size values
+#include <stdlib.h> // stdlib.h is necessary for malloc/free
+#include <string.h> // string.h is necessary for string operations
+// Include own header files
+#include "channelStore.h"
+#include "monitorCommon.h"
+
+// Definition of local (module level) constants
+// Largest limit in centi-degree Celsius which can be registered; the readings in centi-degree Celsius are
+// saturated to +/- (COMPACT_LIMIT + 1), so a saturated reading is always beyond a registered limit
+static const long COMPACT_LIMIT = 32766;
+
+// Declaration of local (module level) functions
+static unsigned int IsPlausible(float value, unsigned int fahrenheit);
+
+
+// Function Definitions
+
+/*---------------------------------------------------
+* Definition of function ChannelStoreInit()
+* Parameters:
+*	store: channel store to be initialized
+*	capacity: maximum number of channels
+* Return value:
+*	init_ok: unsigned integer, 1 if the memory could be allocated, 0 otherwise
+------------------------------------------------------*/
+unsigned int ChannelStoreInit(ChannelStore *store, unsigned int capacity) {
+
+	// Definition of local variables
+	unsigned int init_ok = 0;			// Return value, defensive programming: initialize with 0 (failure)
+	size_t size32 = AlignToCacheLine(capacity * sizeof(int32_t));	// size of a 32 bit array
+	size_t size16 = AlignToCacheLine(capacity * sizeof(int16_t));	// size of a 16 bit array
+	size_t size8 = AlignToCacheLine(capacity * sizeof(uint8_t));	// size of an 8 bit array
+	size_t size_info = AlignToCacheLine(capacity * sizeof(ChannelInfo));	// size of the cold data
+	uintptr_t next = 0;					// start of the next array
+
+	memset(store, 0, sizeof(*store));
+	store->memory = malloc((6 * size32) + (2 * size16) + (2 * size8) + size_info + CACHE_LINE);
+
+	if(store->memory != 0)
+	{
+		next = AlignToCacheLine((uintptr_t)store->memory);
+		store->min_temp = (int32_t *)next;
+		next += size32;
+		store->max_temp = (int32_t *)next;
+		next += size32;
+		store->max_deltatemp = (int32_t *)next;
+		next += size32;
+		store->scan_sensor1 = (int32_t *)next;
+		next += size32;
+		store->scan_sensor2 = (int32_t *)next;
+		next += size32;
+		store->scan_delta = (int32_t *)next;
+		next += size32;
+		store->temp_ok = (uint8_t *)next;
+		next += size8;
+		store->temp_sensor1 = (int16_t *)next;
+		next += size16;
+		store->temp_sensor2 = (int16_t *)next;
+		next += size16;
+		store->format = (uint8_t *)next;
+		next += size8;
+		store->info = (ChannelInfo *)next;
+		store->capacity = capacity;
+		init_ok = 1;
+	}
+
+	return init_ok;
+}
+
+
+/*---------------------------------------------------
+* Definition of function ChannelStoreFree()
+* Parameters:
+*	store: channel store initialized with ChannelStoreInit()
+* Return value: none
+------------------------------------------------------*/
+void ChannelStoreFree(ChannelStore *store) {
+
+	free(store->memory);
+	memset(store, 0, sizeof(*store));
+}
+
+
+/*---------------------------------------------------
+* Definition of function ChannelStoreRegister()
+* Parameters:
+*	store: channel store initialized with ChannelStoreInit()
+*	name: name of the channel (cold data, truncated to 23 characters)
+*	format: char 'F' or 'C'
+*	min_temp: minimum allowed temperature as float
+*	max_temp: maximum allowed temperature as float
+*	max_deltatemp: maximum allowed delta temperature between sensor 1 and sensor 2 as float
+*	channel: index of the registered channel
+* Return value:
+*	register_ok: unsigned integer, 1 if the channel was registered,
+*		0 if the store is full, the parameters are invalid or do not fit into 16 bit
+------------------------------------------------------*/
+unsigned int ChannelStoreRegister(ChannelStore *store, const char *name, char format,
+		float min_temp, float max_temp, float max_deltatemp, unsigned int *channel) {
+
+	// Definition of local variables
+	unsigned int register_ok = 0;		// Return value, defensive programming: initialize with 0 (failure)
+	unsigned int valid = 0;				// 1 if all parameters are plausible
+	unsigned int fahrenheit = 0;		// 1 for a Fahrenheit channel
+	long min_centi = 0;					// min_temp in centi-degree of the registered unit
+	long max_centi = 0;					// max_temp in centi-degree of the registered unit
+	long delta_centi = 0;				// max_deltatemp in centi-degree of the registered unit
+	int32_t scale = 0;					// scan units per centi-degree of the registered unit
+	int32_t offset = 0;					// scan units of 0 °C in the registered unit
+	int32_t min_units = 0;				// min_temp in scan units
+	int32_t max_units = 0;				// max_temp in scan units
+	int32_t delta_units = 0;			// max_deltatemp in scan units
+	unsigned int index = store->count;	// index of the new channel
+
+	/*Plausibility check of the parameter 'format'*/
+	if((format == 'C') || (format == 'c'))
+	{
+		format = 'C';
+		valid = 1;
+	}
+	else if((format == 'F') || (format == 'f'))
+	{
+		format = 'F';
+		fahrenheit = 1;
+		valid = 1;
+	}
+
+	/*Plausibility check of the limits in the registered unit with the same comparisons as EvaluateTemp()*/
+	valid &= (min_temp >= ((fahrenheit == 1) ? (float)ABS_MINTEMP_F_CENTI : (float)ABS_MINTEMP_C_CENTI) / 100.0f);
+	valid &= (max_temp <= ((fahrenheit == 1) ? (float)ABS_MAXTEMP_F_CENTI : (float)ABS_MAXTEMP_C_CENTI) / 100.0f);
+	valid &= (min_temp <= max_temp) & (max_deltatemp <= (max_temp - min_temp));
+	valid &= ToCentiDegree(min_temp, &min_centi) & ToCentiDegree(max_temp, &max_centi) & ToCentiDegree(max_deltatemp, &delta_centi);
+
+	/*Conversion to scan units; the delta is a difference, so without offset*/
+	scale = (fahrenheit == 1) ? CHANNEL_UNITS_PER_CENTI_F : CHANNEL_UNITS_PER_CENTI_C;
+	offset = (fahrenheit == 1) ? CHANNEL_UNITS_OFFSET_F : 0;
+	min_units = (valid == 1) ? (int32_t)((min_centi * scale) - offset) : 0;
+	max_units = (valid == 1) ? (int32_t)((max_centi * scale) - offset) : 0;
+	delta_units = (valid == 1) ? (int32_t)(delta_centi * scale) : 0;
+
+	/*The limits must fit into 16 bit centi-degree Celsius (readings for analysis)*/
+	valid &= (ChannelStoreCentiCelsius(min_units) >= -COMPACT_LIMIT) & (ChannelStoreCentiCelsius(max_units) <= COMPACT_LIMIT);
+	valid &= (ChannelStoreCentiCelsius(delta_units) >= -COMPACT_LIMIT) & (ChannelStoreCentiCelsius(delta_units) <= COMPACT_LIMIT);
+
+	if((valid == 1) && (index < store->capacity))
+	{
+		store->min_temp[index] = min_units;
+		store->max_temp[index] = max_units;
+		store->max_deltatemp[index] = delta_units;
+		store->scan_sensor1[index] = CHANNEL_INVALID_UNITS;
+		store->scan_sensor2[index] = CHANNEL_INVALID_UNITS;
+		store->scan_delta[index] = 0;
+		store->temp_sensor1[index] = INVALID_READING;
+		store->temp_sensor2[index] = INVALID_READING;
+		store->format[index] = (uint8_t)format;
+		store->temp_ok[index] = 5;
+
+		strncpy(store->info[index].name, name, sizeof(store->info[index].name) - 1);
+		store->info[index].name[sizeof(store->info[index].name) - 1] = '\0';
+		store->info[index].format = format;
+
+		store->count++;
+		*channel = index;
+		register_ok = 1;
+	}
+
+	return register_ok;
+}
+
+
+/*---------------------------------------------------
+* Definition of function ChannelStoreSetReading()
+* Parameters:
+*	store: channel store initialized with ChannelStoreInit()
+*	channel: index of a registered channel
+*	temp_sensor1: actual measured temperature of sensor 1 as float
+*	temp_sensor2: actual measured temperature of sensor 2 as float
+* Return value: none
+------------------------------------------------------*/
+void ChannelStoreSetReading(ChannelStore *store, unsigned int channel, float temp_sensor1, float temp_sensor2) {
+
+	// Definition of local variables
+	unsigned int fahrenheit = (store->format[channel] == 'F');	// 1 for a Fahrenheit channel
+	int32_t scale = fahrenheit ? CHANNEL_UNITS_PER_CENTI_F : CHANNEL_UNITS_PER_CENTI_C;	// scan units per centi-degree
+	int32_t offset = fahrenheit ? CHANNEL_UNITS_OFFSET_F : 0;	// scan units of 0 °C in the registered unit
+	float reading[2];					// readings of both sensors
+	long centi[2] = {0, 0};				// readings in centi-degree of the registered unit, rounded as by CheckTemp()
+	long whole[2] = {0, 0};				// magnitudes of the readings in whole degrees of the registered unit
+	unsigned int valid[2] = {0, 0};		// 1 if the reading is plausible
+	int32_t units[2];					// readings in scan units
+	int32_t celsius = 0;				// reading in centi-degree Celsius
+	int16_t stored[2];					// readings in 16 bit centi-degree Celsius
+	unsigned int sensor = 0;			// Loop index over both sensors
+
+	reading[0] = temp_sensor1;
+	reading[1] = temp_sensor2;
+
+	for(sensor = 0; sensor < 2; sensor++)
+	{
+		units[sensor] = CHANNEL_INVALID_UNITS;
+		stored[sensor] = INVALID_READING;
+		valid[sensor] = IsPlausible(reading[sensor], fahrenheit) & ToCentiDegree(reading[sensor], &centi[sensor]);
+		if(valid[sensor] == 1)
+		{
+			units[sensor] = (int32_t)((centi[sensor] * scale) - offset);
+			whole[sensor] = centi[sensor] / 100;
+			whole[sensor] = (whole[sensor] < 0) ? -whole[sensor] : whole[sensor];
+
+			/*Saturation, a saturated reading is beyond every registered limit*/
+			celsius = ChannelStoreCentiCelsius(units[sensor]);
+			celsius = (celsius > (COMPACT_LIMIT + 1)) ? (int32_t)(COMPACT_LIMIT + 1) : celsius;
+			celsius = (celsius < -(COMPACT_LIMIT + 1)) ? (int32_t)-(COMPACT_LIMIT + 1) : celsius;
+			stored[sensor] = (int16_t)celsius;
+		}
+	}
+
+	store->scan_sensor1[channel] = units[0];
+	store->scan_sensor2[channel] = units[1];
+	/*CheckTemp() compares the magnitudes in whole degrees (truncated) of the registered unit*/
+	store->scan_delta[channel] = (int32_t)((whole[0] - whole[1]) * 100 * scale);
+	store->temp_sensor1[channel] = stored[0];
+	store->temp_sensor2[channel] = stored[1];
+}
+
+
+/*---------------------------------------------------
+* Definition of function ChannelStoreScan()
+* Evaluates the channels first .. first + count - 1 and stores the results in store->temp_ok,
+* the result of each channel corresponds to EvaluateTemp() with the stored limits and readings
+* Parameters:
+*	store: channel store initialized with ChannelStoreInit()
+*	first: index of the first channel to be evaluated
+*	count: number of channels to be evaluated
+* Return value:
+*	not_ok: unsigned integer, number of evaluated channels with result 3 or 5
+------------------------------------------------------*/
+unsigned int ChannelStoreScan(ChannelStore *store, unsigned int first, unsigned int count) {
+
+	// Definition of local variables
+	unsigned int not_ok = 0;			// Return value: number of channels with alarm or failure
+	unsigned int index = 0;				// Loop index
+	unsigned int last = first + count;	// index after the last channel to be evaluated
+	int32_t sensor1 = 0;				// reading of sensor 1
+	int32_t sensor2 = 0;				// reading of sensor 2
+	int alarm = 0;						// 1 if one of the checks fails
+	int invalid = 0;					// 1 if one of the readings is invalid
+	// Local copies of the array pointers; temp_ok is an 8 bit array, which might alias the store
+	// for the compiler, so the pointers would be reloaded in every iteration otherwise
+	const int32_t *min_temp = store->min_temp;
+	const int32_t *max_temp = store->max_temp;
+	const int32_t *max_deltatemp = store->max_deltatemp;
+	const int32_t *scan_sensor1 = store->scan_sensor1;
+	const int32_t *scan_sensor2 = store->scan_sensor2;
+	const int32_t *scan_delta = store->scan_delta;
+	uint8_t *temp_ok = store->temp_ok;
+
+	if(last > store->count)
+	{
+		last = store->count;
+	}
+
+	for(index = first; index < last; index++)
+	{
+		sensor1 = scan_sensor1[index];
+		sensor2 = scan_sensor2[index];
+		invalid = (sensor1 == CHANNEL_INVALID_UNITS) | (sensor2 == CHANNEL_INVALID_UNITS);
+
+		alarm = (scan_delta[index] > max_deltatemp[index]);
+		alarm |= (sensor1 < min_temp[index]) | (sensor2 < min_temp[index]);
+		alarm |= (sensor1 > max_temp[index]) | (sensor2 > max_temp[index]);
+
+		/*7: OK, 3: alarm, 5: invalid reading*/
+		temp_ok[index] = (uint8_t)(7 - (4 * (alarm & (1 - invalid))) - (2 * invalid));
+		not_ok += (unsigned int)(alarm | invalid);
+	}
+
+	return not_ok;
+}
+
+
+/*---------------------------------------------------
+* Definition of function ChannelStoreNativeTemp()
+* Converts a stored temperature (limit or reading, not the delta) back to the format of the channel for presentation
+* Parameters:
+*	store: channel store initialized with ChannelStoreInit()
+*	channel: index of a registered channel
+*	units: stored temperature in scan units
+* Return value:
+*	temp: temperature as float in the registered format of the channel
+------------------------------------------------------*/
+float ChannelStoreNativeTemp(const ChannelStore *store, unsigned int channel, int32_t units) {
+
+	return (float)ChannelStoreNativeCenti(store, channel, units) / 100.0f;
+}
+
+
+/*---------------------------------------------------
+* Definition of function ChannelStoreNativeCenti()
+* Converts a stored temperature (limit or reading, not the delta) back to centi-degree of the format of the channel,
+* stored values are converted exactly
+* Parameters:
+*	store: channel store initialized with ChannelStoreInit()
+*	channel: index of a registered channel
+*	units: stored temperature in scan units
+* Return value:
+*	centi: temperature in centi-degree of the registered format of the channel
+------------------------------------------------------*/
+int32_t ChannelStoreNativeCenti(const ChannelStore *store, unsigned int channel, int32_t units) {
+
+	// Definition of local variables
+	int32_t centi = units / CHANNEL_UNITS_PER_CENTI_C;	// Return value, temperature in centi-degree Celsius
+
+	if(store->format[channel] == 'F')
+	{
+		centi = (units + CHANNEL_UNITS_OFFSET_F) / CHANNEL_UNITS_PER_CENTI_F;
+	}
+
+	return centi;
+}
+
+
+/*---------------------------------------------------
+* Definition of function ChannelStoreCentiCelsius()
+* Parameters:
+*	units: temperature or temperature difference in scan units
+* Return value:
+*	centi: value in centi-degree Celsius, rounded half away from zero
+------------------------------------------------------*/
+int32_t ChannelStoreCentiCelsius(int32_t units) {
+
+	// Definition of local variables
+	int32_t half = (units < 0) ? -(CHANNEL_UNITS_PER_CENTI_C / 2) : (CHANNEL_UNITS_PER_CENTI_C / 2);	// half a centi-degree
+
+	return (units + half) / CHANNEL_UNITS_PER_CENTI_C;
+}
+
+
+
+// Definition of local (module level) functions
+
+/*---------------------------------------------------
+* Definition of function IsPlausible()
+* Same comparisons as the plausibility check of the readings in EvaluateTemp()
+* Parameters:
+*	value: reading in the format of the channel as float
+*	fahrenheit: 1 if value is in Fahrenheit, 0 if value is in Celsius
+* Return value:
+*	plausible: unsigned integer, 1 if value is within the absolute temperatures of the format, 0 otherwise (also for NaN)
+------------------------------------------------------*/
+static unsigned int IsPlausible(float value, unsigned int fahrenheit) {
+
+	// Definition of local variables
+	float abs_min = (float)(fahrenheit ? ABS_MINTEMP_F_CENTI : ABS_MINTEMP_C_CENTI) / 100.0f;	// absolute minimum temperature
+	float abs_max = (float)(fahrenheit ? ABS_MAXTEMP_F_CENTI : ABS_MAXTEMP_C_CENTI) / 100.0f;	// absolute maximum temperature
+
+	return (value >= abs_min) & (value <= abs_max);
+}
+
+
+// End of file channelStore.c
@@ -0,0 +1,118 @@
+/* ---------------------------------------------------------------------------------------------
+ * Module Name: Safe Temperature Monitoring
+ * File Name: channelStore.h
+ * Corresponding Source-File: channelStore.c
+ * Created on: 19.10.2026
+ * Development Group: CKN GmbH
+ * Project: FSQM SW Development Exercise
+ * Dependencies: stdint.h, stdlib.h (memory is only allocated in ChannelStoreInit())
+ *
+ * Description: This file contains the function prototypes of the channel store, which keeps the
+ * state of many channels for cyclic monitoring. The implementation of the functions can be found
+ * in the corresponding source file channelStore.c
+ *
+ *  the data which is needed in every scan (hot data: limits, readings, results) is kept in packed
+ *  arrays (structure of arrays), so that a scan only loads what it compares
+ *
+ *  all channels are normalized at registration into one internal unit, the scan unit of 1/900 degree
+ *  Celsius (= 1/500 degree Fahrenheit): centi-degree Celsius and centi-degree Fahrenheit are both exact
+ *  multiples of it, so the comparisons of EvaluateTemp() in the registered unit give the same result
+ *  on the normalized values; limits and readings of both formats are converted when they are stored,
+ *  so one scan evaluates a mixed fleet without any dispatch on the format; the registered format is
+ *  only kept for the conversion of readings and for presentation (ChannelStoreNativeCenti())
+ *
+ *  CheckTemp() compares the magnitudes of the readings in whole degrees of the registered unit, this
+ *  difference is computed when the readings are stored (scan_delta) and compared with max_deltatemp
+ *
+ *  the readings are additionally kept in 16 bit centi-degree Celsius (temp_sensor1, temp_sensor2) for
+ *  the modules which analyse or export the readings of the whole fleet in one unit
+ *
+ *  the data which is only needed for registration and presentation (cold data: name, registered format)
+ *  is kept in a separate array, so that a scan does not load it into the cache
+ *
+ *  only channels whose limits fit into 16 bit centi-degree Celsius (-327.66 .. 327.66 °C, i.e. up to
+ *  621.78 °F) can be registered, other channels must be evaluated with EvaluateTemp(); the results
+ *  correspond to EvaluateTemp() for limits with a resolution of 0.01 degree (finer limits are rounded)
+ * ----------------------------------------------------------------------------------------------
+ * Versions:
+ *
+ * Version: 0.1 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * Initial version, definition of functions
+ *
+ * Version: 0.2 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * Fahrenheit channels normalized to centi-degree Celsius, ChannelStoreNativeTemp() added
+ *
+ * Version: 0.3 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * Scan unit 1/900 degree Celsius, exact for both formats, delta compared in the registered unit,
+ * ChannelStoreNativeCenti() added
+ *
+ * Version: 0.4 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * Result 6 documented for temp_ok
+ *
+ * Version: 0.5 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * Unused display text removed from ChannelInfo
+ *
+ * ----------------------------------------------------------------------------------------------  */
+
+#ifndef CHANNELSTORE_H_
+#define CHANNELSTORE_H_
+
+#include <stdint.h>
+
+// Declaration of constants (enumeration constants)
+enum {
+	CHANNEL_UNITS_PER_CENTI_C = 9,	// scan units per centi-degree Celsius
+	CHANNEL_UNITS_PER_CENTI_F = 5,	// scan units per centi-degree Fahrenheit
+	CHANNEL_UNITS_OFFSET_F = 16000,	// 0 °C (32 °F) above 0 °F in scan units
+	CHANNEL_INVALID_UNITS = INT32_MIN	// marker of an invalid reading in scan units
+};
+
+// Declaration of types
+// Cold data of a channel, only used for registration and presentation
+typedef struct {
+	char name[24];					// name of the channel
+	char format;					// 'F' or 'C' as registered, unit for presentation
+} ChannelInfo;
+
+// Channel store; element i of every array belongs to channel i
+typedef struct {
+	// hot data, scan units (1/900 degree Celsius) for all channels
+	int32_t *min_temp;				// minimum allowed temperature
+	int32_t *max_temp;				// maximum allowed temperature
+	int32_t *max_deltatemp;			// maximum allowed delta temperature between sensor 1 and sensor 2
+	int32_t *scan_sensor1;			// last reading of sensor 1, CHANNEL_INVALID_UNITS if invalid
+	int32_t *scan_sensor2;			// last reading of sensor 2, CHANNEL_INVALID_UNITS if invalid
+	int32_t *scan_delta;			// magnitude of sensor 1 - magnitude of sensor 2 in whole degrees of the registered unit
+	uint8_t *temp_ok;				// result of the last scan, 7, 3 or 5 as for MonitorTemp(), 6 after SensorHealthScan()
+	// readings for analysis and export, 16 bit centi-degree Celsius for all channels
+	int16_t *temp_sensor1;			// last reading of sensor 1, INT16_MIN if invalid
+	int16_t *temp_sensor2;			// last reading of sensor 2, INT16_MIN if invalid
+	uint8_t *format;				// 'F' or 'C', unit of the incoming readings, only used when readings are stored
+	// cold data
+	ChannelInfo *info;				// name and registered format
+	unsigned int count;				// number of registered channels
+	unsigned int capacity;			// maximum number of channels
+	void *memory;					// memory block of all arrays
+} ChannelStore;
+
+extern unsigned int ChannelStoreInit(ChannelStore *store, unsigned int capacity);
+extern void ChannelStoreFree(ChannelStore *store);
+extern unsigned int ChannelStoreRegister(ChannelStore *store, const char *name, char format,
+		float min_temp, float max_temp, float max_deltatemp, unsigned int *channel);
+extern void ChannelStoreSetReading(ChannelStore *store, unsigned int channel, float temp_sensor1, float temp_sensor2);
+extern unsigned int ChannelStoreScan(ChannelStore *store, unsigned int first, unsigned int count);
+extern float ChannelStoreNativeTemp(const ChannelStore *store, unsigned int channel, int32_t units);
+extern int32_t ChannelStoreNativeCenti(const ChannelStore *store, unsigned int channel, int32_t units);
+extern int32_t ChannelStoreCentiCelsius(int32_t units);
+
+#endif /* CHANNELSTORE_H_ */
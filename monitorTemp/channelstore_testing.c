@@ -0,0 +1,252 @@
+/* ---------------------------------------------------------------------------------------------
+* Module Name: Channel Store Testing for ChannelStoreScan()
+* File Name: channelstore_testing.c
+* Corresponding Header-File: channelstore_testing.h
+* Created on: 19.10.2026
+* Development Group: CKN GmbH
+* Project: FSQM SW Development Exercise (Channel Store Testing Functions for ChannelStoreScan())
+* Dependencies: ChannelStoreScan(), ChannelStoreNativeTemp(), EvaluateTemp(), stdio.h (hardware dependent)
+*
+* Description: This file contains the channel store testing function for ChannelStoreScan()
+*
+* PerformChannelStoreTest() is a function, which registers channels in the channel store and checks
+* that the scan returns the same results as EvaluateTemp(), also for a mixed fleet of Celsius and Fahrenheit channels
+*
+* ----------------------------------------------------------------------------------------------
+* Versions:
+* Version: 0.1 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* 3 channel store tests were implemented
+*
+* Version: 0.2 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* 2 tests of the normalization of Fahrenheit channels were implemented
+*
+* Version: 0.3 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Test of the scan units and differential test of Fahrenheit channels against EvaluateTemp() were implemented
+*
+* ----------------------------------------------------------------------------------------------*/
+// Include system header files
+#include <stdio.h> // stdio.h is necessary for printing/reading via standard IO
+#include <stdlib.h> // stdlib.h is necessary for rand()
+#include <string.h> // string.h is necessary for string operations
+// Include own header files
+#include "monitorTemp.h"
+#include "channelStore.h"
+// Definition of global constants (only if really necessary, see coding rules)
+// No globals
+// Definition of global variables (should be avoided, see coding rules)
+// No globals
+// Definition of global and local functions (sorted by topic, if possible)
+
+/*---------------------------------------------------
+* Definition of function PerformChannelStoreTest()
+* Parameters:
+* None
+* Return value:
+* test_complete: unsigned integer, 1 if all tests were succesful, 0 if one or more tests failed
+------------------------------------------------------*/
+unsigned int PerformChannelStoreTest(void) {
+	// Definition of local variables
+	// Test vectors: BBT1, BBT2, BT1, BT2, sensor 1 out of range, delta alarm, sensor beyond 16 bit, sensor beyond 1000° C
+	float min_temp[8] = {-10.0, -100.0, -273.15, -273.15, 0.0, 0.0, 0.0, 0.0};
+	float max_temp[8] = {80.0, 120.0, 80.0, 80.0, 50.0, 50.0, 50.0, 50.0};
+	float max_deltatemp[8] = {3.0, 5.0, 3.0, 3.0, 3.0, 3.0, 3.0, 3.0};
+	float temp_sensor1[8] = {55.1, 99.9, -273.15, -272.0, 50.01, 45.0, 500.0, 1000.5};
+	float temp_sensor2[8] = {55.5, 100.1, -272.0, -273.15, 20.0, 40.0, 20.0, 20.0};
+	// Mixed fleet: the same channels in Celsius and in Fahrenheit: OK, alarm, sensor 1 out of range, absolute minimum
+	float celsius_sensor1[4] = {55.0, 101.0, -280.0, -273.15};
+	float celsius_sensor2[4] = {56.0, 100.0, 20.0, 20.0};
+	float fahrenheit_sensor1[4] = {131.0, 213.8, -472.0, -459.67};
+	float fahrenheit_sensor2[4] = {132.8, 212.0, 68.0, 68.0};
+	unsigned int expected[4] = {7, 3, 5, 3}; // expected results of the mixed fleet
+	unsigned int first = 0; // index of the first channel of the mixed fleet
+	float native = 0; // stored value in the registered format
+	// Random Fahrenheit channels: limits with a resolution of 0.01° F, readings with any resolution
+	float random_min[1000]; // minimum temperatures
+	float random_max[1000]; // maximum temperatures
+	float random_delta[1000]; // maximum delta temperatures
+	float random_sensor1[1000]; // readings of sensor 1
+	float random_sensor2[1000]; // readings of sensor 2
+	int range = 0; // max_temp - min_temp in centi-degree
+	int low = 0; // min_temp in centi-degree
+	ChannelStore fleet; // channel store of the random channels
+	ChannelStore store; // channel store under test
+	unsigned int channel = 0; // index of a registered channel
+	unsigned int index = 0; // loop index
+	unsigned int correct = 0; // number of correct results
+	unsigned int register_ok = 0; // result of ChannelStoreRegister()
+	char message[40]; // String array for test result message
+	unsigned int total_tests = 0; // Total number of tests
+	unsigned int successful_tests = 0; // Total number of successful test
+
+	unsigned int test_complete = 0; // 1 if all tests OK, 0 if one or more tests failed
+	// For printf() function, buffer setting (no buffering)
+	setvbuf(stdout, NULL, _IONBF, 0);
+
+	if (ChannelStoreInit(&store, 32) == 0) {
+		printf("\n\nCST: channel store could not be allocated\n");
+		return 0;
+	}
+	// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+	// Channel store tests (CST)
+	// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+	// CST1: The scan returns the same results as EvaluateTemp()
+	total_tests++;
+	printf("\n\nCST1: Test with representative values, same results as EvaluateTemp()\n");
+	// Initialize test result message with negative test result, will only be changed if test is successful
+	strcpy(message, "CST1 FAILED, Correct results: \0");
+	correct = 0;
+	for (index = 0; index < 8; index++) {
+		if (ChannelStoreRegister(&store, "CST1", 'C', min_temp[index], max_temp[index], max_deltatemp[index], &channel) == 1) {
+			ChannelStoreSetReading(&store, channel, temp_sensor1[index], temp_sensor2[index]);
+		}
+	}
+	ChannelStoreScan(&store, 0, store.count);
+	for (index = 0; (index < 8) && (index < store.count); index++) {
+		correct += (store.temp_ok[index] == EvaluateTemp('C', min_temp[index], max_temp[index], max_deltatemp[index],
+				temp_sensor1[index], temp_sensor2[index]));
+	}
+	// Expected: all 8 results as EvaluateTemp()
+	if (correct == 8) {
+		strcpy(message, "CST1 SUCCESFUL, Correct results: \0");
+		successful_tests++;
+	}
+	// Print test result
+	printf("\n%s%d", message, correct);
+	// End of CST1
+
+	// CST2: A channel with limits beyond 16 bit centi-degree is rejected
+	total_tests++;
+	printf("\n\nCST2: Test with maximum temperature 1000° C, channel is rejected\n");
+	// Initialize test result message with negative test result, will only be changed if test is successful
+	strcpy(message, "CST2 FAILED, Return value: \0");
+	register_ok = ChannelStoreRegister(&store, "CST2", 'C', -273.15, 1000.0, 3.0, &channel);
+	// Expected return value: 0
+	if (register_ok == 0) {
+		strcpy(message, "CST2 SUCCESFUL, Return value: \0");
+		successful_tests++;
+	}
+	// Print test result
+	printf("\n%s%d", message, register_ok);
+	// End of CST2
+
+	// CST3: A channel without readings is reported as function failure
+	total_tests++;
+	printf("\n\nCST3: Test without readings, function failure\n");
+	// Initialize test result message with negative test result, will only be changed if test is successful
+	strcpy(message, "CST3 FAILED, Return value: \0");
+	register_ok = ChannelStoreRegister(&store, "CST3", 'F', 32.0, 212.0, 10.0, &channel);
+	ChannelStoreScan(&store, channel, 1);
+	// Expected return value: 5 (Failure)
+	if ((register_ok == 1) && (store.temp_ok[channel] == 5)) {
+		strcpy(message, "CST3 SUCCESFUL, Return value: \0");
+		successful_tests++;
+	}
+	// Print test result
+	printf("\n%s%d", message, store.temp_ok[channel]);
+	// End of CST3
+
+	// CST4: Celsius and Fahrenheit channels are stored in the same unit and evaluated by the same scan
+	total_tests++;
+	printf("\n\nCST4: Test with the same channels in Celsius and Fahrenheit, same limits and results\n");
+	// Initialize test result message with negative test result, will only be changed if test is successful
+	strcpy(message, "CST4 FAILED, Correct results: \0");
+	correct = 0;
+	first = store.count;
+	for (index = 0; index < 4; index++) {
+		if (ChannelStoreRegister(&store, "CST4 C", 'C', 0.0, 100.0, 5.0, &channel) == 1) {
+			ChannelStoreSetReading(&store, channel, celsius_sensor1[index], celsius_sensor2[index]);
+		}
+		if (ChannelStoreRegister(&store, "CST4 F", 'f', 32.0, 212.0, 9.0, &channel) == 1) {
+			ChannelStoreSetReading(&store, channel, fahrenheit_sensor1[index], fahrenheit_sensor2[index]);
+		}
+	}
+	ChannelStoreScan(&store, first, 8);
+	for (index = first; (index + 1 < first + 8) && (index + 1 < store.count); index += 2) {
+		correct += ((store.min_temp[index] == store.min_temp[index + 1]) && (store.max_temp[index] == store.max_temp[index + 1])
+				&& (store.max_deltatemp[index] == store.max_deltatemp[index + 1])
+				&& (store.temp_ok[index] == expected[(index - first) / 2]) && (store.temp_ok[index + 1] == expected[(index - first) / 2]));
+	}
+	// Expected: 4 pairs with the same limits and the expected results
+	if (correct == 4) {
+		strcpy(message, "CST4 SUCCESFUL, Correct results: \0");
+		successful_tests++;
+	}
+	// Print test result
+	printf("\n%s%d", message, correct);
+	// End of CST4
+
+	// CST5: A Fahrenheit channel beyond 327.66° F is accepted, the limit is presented in Fahrenheit
+	total_tests++;
+	printf("\n\nCST5: Test with maximum temperature 500° F, channel is accepted, limit presented in Fahrenheit\n");
+	// Initialize test result message with negative test result, will only be changed if test is successful
+	strcpy(message, "CST5 FAILED, Maximum temperature: \0");
+	register_ok = ChannelStoreRegister(&store, "CST5", 'F', 0.0, 500.0, 10.0, &channel);
+	native = (register_ok == 1) ? ChannelStoreNativeTemp(&store, channel, store.max_temp[channel]) : 0;
+	// Expected: registered, 260° C stored (234000 scan units), 500° F presented
+	if ((register_ok == 1) && (store.max_temp[channel] == 234000) && (native > 499.99) && (native < 500.01)) {
+		strcpy(message, "CST5 SUCCESFUL, Maximum temperature: \0");
+		successful_tests++;
+	}
+	// Print test result
+	printf("\n%s%f", message, native);
+	// End of CST5
+
+	// CST6: Differential test of Fahrenheit channels, the delta is checked in whole degrees Fahrenheit
+	total_tests++;
+	printf("\n\nCST6: Test with 1000 random Fahrenheit channels, same results as EvaluateTemp()\n");
+	// Initialize test result message with negative test result, will only be changed if test is successful
+	strcpy(message, "CST6 FAILED, Correct results: \0");
+	correct = 0;
+	// First vector: 100.0° F and 96.0° F differ by 4 whole degrees Fahrenheit (but 2.22° C), delta alarm
+	random_min[0] = 32.0;
+	random_max[0] = 212.0;
+	random_delta[0] = 3.9;
+	random_sensor1[0] = 100.0;
+	random_sensor2[0] = 96.0;
+	srand(32);
+	for (index = 1; index < 1000; index++) {
+		low = (rand() % 34001) - 4000;
+		range = 100 + (rand() % 29901);
+		random_min[index] = (float)low / 100.0f;
+		random_max[index] = (float)(low + range) / 100.0f;
+		random_delta[index] = (float)(rand() % range) / 100.0f;
+		random_sensor1[index] = random_min[index] - 20.0f + ((float)rand() / (float)RAND_MAX) * ((float)range / 100.0f + 40.0f);
+		random_sensor2[index] = random_sensor1[index] + (((float)rand() / (float)RAND_MAX) - 0.5f) * 2.0f * (random_delta[index] + 3.0f);
+	}
+	if (ChannelStoreInit(&fleet, 1000) == 1) {
+		for (index = 0; index < 1000; index++) {
+			if (ChannelStoreRegister(&fleet, "CST6", 'F', random_min[index], random_max[index], random_delta[index], &channel) == 1) {
+				ChannelStoreSetReading(&fleet, channel, random_sensor1[index], random_sensor2[index]);
+			}
+		}
+		ChannelStoreScan(&fleet, 0, fleet.count);
+		for (index = 0; (index < 1000) && (index < fleet.count); index++) {
+			correct += (fleet.temp_ok[index] == EvaluateTemp('F', random_min[index], random_max[index], random_delta[index],
+					random_sensor1[index], random_sensor2[index]));
+		}
+		// the first vector must be reported as alarm
+		correct -= ((fleet.count > 0) && (fleet.temp_ok[0] != 3));
+		ChannelStoreFree(&fleet);
+	}
+	// Expected: all 1000 results as EvaluateTemp(), the first vector with alarm
+	if (correct == 1000) {
+		strcpy(message, "CST6 SUCCESFUL, Correct results: \0");
+		successful_tests++;
+	}
+	// Print test result
+	printf("\n%s%d", message, correct);
+	// End of CST6
+
+	ChannelStoreFree(&store);
+
+	test_complete = (successful_tests == total_tests);
+
+	return test_complete;
+
+}
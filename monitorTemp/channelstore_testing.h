@@ -0,0 +1,28 @@
+/* ---------------------------------------------------------------------------------------------
+ * Module Name: Safe Temperature Monitoring
+ * File Name: channelstore_testing.h
+ * Corresponding Source-File: channelstore_testing.c
+ * Created on: 19.10.2026
+ * Development Group: CKN GmbH
+ * Project: FSQM SW Development Exercise
+ * Dependencies: ChannelStoreScan(), stdio.h (hardware dependent)
+ *
+ * Description: This file contains the test cases for the channel store of the Safe Temperature Monitoring module
+ *
+
+ * ----------------------------------------------------------------------------------------------
+ * Versions:
+ *
+ * Version: 0.1 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * Initial version, definition of functions
+ *
+ * ----------------------------------------------------------------------------------------------  */
+
+#ifndef CHANNELSTORE_TESTING_H_
+#define CHANNELSTORE_TESTING_H_
+
+extern unsigned int PerformChannelStoreTest(void);
+
+#endif /* CHANNELSTORE_TESTING_H_ */
@@ -0,0 +1,640 @@
+/* ---------------------------------------------------------------------------------------------
+* Module Name: Safe Temperature Monitoring
+* File Name: checkpoint.c
+* Corresponding Header-File: checkpoint.h
+* Created on: 19.10.2026
+* Development Group: CKN GmbH
+* Project: FSQM SW Development Exercise
+* Dependencies: channelStore.c, telemetry.c (TelemetryNow()), POSIX threads (link with -pthread),
+* 		mmap() and fsync() (POSIX, hardware dependent)
+*
+* Description: This file contains the functions of the checkpoint of the channel store.
+*
+*  checkpointWriterInit() allocates the buffer for the largest snapshot and starts the writer thread
+*
+*  checkpointWriterOffer() starts a snapshot, if one is due and the buffer is free, and copies the next
+*  chunk of channels of a started snapshot into the buffer, so the copy of a large store is spread over
+*  several scans; the names and formats are only copied for new channels, they stay in the buffer
+*  from one snapshot to the next; the lock is only tried, so the scan thread never waits for the writer thread
+*
+*  the writer thread calculates the CRC, writes the first channel_count channels of every array of the
+*  buffer into a temporary file, synchronizes it and renames it; a snapshot captured before CheckpointWriterShutdown() is still written
+*
+*  checkpointRestore() checks magic, version, sizes and CRC before anything is copied into the store,
+*  so the store is not modified by an invalid snapshot
+*
+* ----------------------------------------------------------------------------------------------
+* Versions:
+* Version: 0.1 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Initial version, background checkpoint and restore of the channel store
+*
+* Version: 0.2 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Snapshot format version 2, limits and readings of the channel store in 32 bit scan units
+*
+* Version: 0.3 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Snapshot copied in chunks of channels with bounded pause, names copied only for new channels
+*
+* Version: 0.4 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Unused display text removed from the snapshot (format version 3), state of sensor health and rollups documented as not included
+*
+* ----------------------------------------------------------------------------------------------*/
+
+// Include system header files
+#include <pthread.h> // pthread.h is necessary for the writer thread
+#include <stdint.h> // stdint.h is necessary for the fixed size header
+#include <stdio.h> // stdio.h is necessary for the file operations
+#include <stdlib.h> // stdlib.h is necessary for malloc/free
+#include <string.h> // string.h is necessary for memcpy
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h> // fcntl.h is necessary for open()
+#include <sys/mman.h> // sys/mman.h is necessary for mmap()
+#include <sys/stat.h> // sys/stat.h is necessary for fstat()
+#include <unistd.h> // unistd.h is necessary for fsync() and close()
+#endif
+// Include own header files
+#include "channelStore.h"
+#include "telemetry.h"
+#include "checkpoint.h"
+
+// Definition of local (module level) constants
+// Magic number of a snapshot, "MTCP" in a little endian file
+static const uint32_t CHECKPOINT_MAGIC = 0x5043544Du;
+// Number of arrays of a snapshot
+enum {
+	SNAPSHOT_ARRAYS = 11
+};
+// Size of an element of the arrays of a snapshot, in the order of the file (see ArraysOfStore())
+static const size_t ELEMENT_SIZE[SNAPSHOT_ARRAYS] = {
+	sizeof(int32_t), sizeof(int32_t), sizeof(int32_t), sizeof(int32_t), sizeof(int32_t), sizeof(int32_t),
+	sizeof(int16_t), sizeof(int16_t), sizeof(uint8_t), sizeof(uint8_t), sizeof(ChannelInfo)
+};
+// Array of the names and formats, only copied for channels registered since the last snapshot
+static const unsigned int INFO_ARRAY = SNAPSHOT_ARRAYS - 1;
+// Table of the CRC-32 (IEEE 802.3, reflected polynomial 0xEDB88320)
+static const uint32_t CRC_TABLE[256] = {
+	0x00000000u, 0x77073096u, 0xEE0E612Cu, 0x990951BAu, 0x076DC419u, 0x706AF48Fu,
+	0xE963A535u, 0x9E6495A3u, 0x0EDB8832u, 0x79DCB8A4u, 0xE0D5E91Eu, 0x97D2D988u,
+	0x09B64C2Bu, 0x7EB17CBDu, 0xE7B82D07u, 0x90BF1D91u, 0x1DB71064u, 0x6AB020F2u,
+	0xF3B97148u, 0x84BE41DEu, 0x1ADAD47Du, 0x6DDDE4EBu, 0xF4D4B551u, 0x83D385C7u,
+	0x136C9856u, 0x646BA8C0u, 0xFD62F97Au, 0x8A65C9ECu, 0x14015C4Fu, 0x63066CD9u,
+	0xFA0F3D63u, 0x8D080DF5u, 0x3B6E20C8u, 0x4C69105Eu, 0xD56041E4u, 0xA2677172u,
+	0x3C03E4D1u, 0x4B04D447u, 0xD20D85FDu, 0xA50AB56Bu, 0x35B5A8FAu, 0x42B2986Cu,
+	0xDBBBC9D6u, 0xACBCF940u, 0x32D86CE3u, 0x45DF5C75u, 0xDCD60DCFu, 0xABD13D59u,
+	0x26D930ACu, 0x51DE003Au, 0xC8D75180u, 0xBFD06116u, 0x21B4F4B5u, 0x56B3C423u,
+	0xCFBA9599u, 0xB8BDA50Fu, 0x2802B89Eu, 0x5F058808u, 0xC60CD9B2u, 0xB10BE924u,
+	0x2F6F7C87u, 0x58684C11u, 0xC1611DABu, 0xB6662D3Du, 0x76DC4190u, 0x01DB7106u,
+	0x98D220BCu, 0xEFD5102Au, 0x71B18589u, 0x06B6B51Fu, 0x9FBFE4A5u, 0xE8B8D433u,
+	0x7807C9A2u, 0x0F00F934u, 0x9609A88Eu, 0xE10E9818u, 0x7F6A0DBBu, 0x086D3D2Du,
+	0x91646C97u, 0xE6635C01u, 0x6B6B51F4u, 0x1C6C6162u, 0x856530D8u, 0xF262004Eu,
+	0x6C0695EDu, 0x1B01A57Bu, 0x8208F4C1u, 0xF50FC457u, 0x65B0D9C6u, 0x12B7E950u,
+	0x8BBEB8EAu, 0xFCB9887Cu, 0x62DD1DDFu, 0x15DA2D49u, 0x8CD37CF3u, 0xFBD44C65u,
+	0x4DB26158u, 0x3AB551CEu, 0xA3BC0074u, 0xD4BB30E2u, 0x4ADFA541u, 0x3DD895D7u,
+	0xA4D1C46Du, 0xD3D6F4FBu, 0x4369E96Au, 0x346ED9FCu, 0xAD678846u, 0xDA60B8D0u,
+	0x44042D73u, 0x33031DE5u, 0xAA0A4C5Fu, 0xDD0D7CC9u, 0x5005713Cu, 0x270241AAu,
+	0xBE0B1010u, 0xC90C2086u, 0x5768B525u, 0x206F85B3u, 0xB966D409u, 0xCE61E49Fu,
+	0x5EDEF90Eu, 0x29D9C998u, 0xB0D09822u, 0xC7D7A8B4u, 0x59B33D17u, 0x2EB40D81u,
+	0xB7BD5C3Bu, 0xC0BA6CADu, 0xEDB88320u, 0x9ABFB3B6u, 0x03B6E20Cu, 0x74B1D29Au,
+	0xEAD54739u, 0x9DD277AFu, 0x04DB2615u, 0x73DC1683u, 0xE3630B12u, 0x94643B84u,
+	0x0D6D6A3Eu, 0x7A6A5AA8u, 0xE40ECF0Bu, 0x9309FF9Du, 0x0A00AE27u, 0x7D079EB1u,
+	0xF00F9344u, 0x8708A3D2u, 0x1E01F268u, 0x6906C2FEu, 0xF762575Du, 0x806567CBu,
+	0x196C3671u, 0x6E6B06E7u, 0xFED41B76u, 0x89D32BE0u, 0x10DA7A5Au, 0x67DD4ACCu,
+	0xF9B9DF6Fu, 0x8EBEEFF9u, 0x17B7BE43u, 0x60B08ED5u, 0xD6D6A3E8u, 0xA1D1937Eu,
+	0x38D8C2C4u, 0x4FDFF252u, 0xD1BB67F1u, 0xA6BC5767u, 0x3FB506DDu, 0x48B2364Bu,
+	0xD80D2BDAu, 0xAF0A1B4Cu, 0x36034AF6u, 0x41047A60u, 0xDF60EFC3u, 0xA867DF55u,
+	0x316E8EEFu, 0x4669BE79u, 0xCB61B38Cu, 0xBC66831Au, 0x256FD2A0u, 0x5268E236u,
+	0xCC0C7795u, 0xBB0B4703u, 0x220216B9u, 0x5505262Fu, 0xC5BA3BBEu, 0xB2BD0B28u,
+	0x2BB45A92u, 0x5CB36A04u, 0xC2D7FFA7u, 0xB5D0CF31u, 0x2CD99E8Bu, 0x5BDEAE1Du,
+	0x9B64C2B0u, 0xEC63F226u, 0x756AA39Cu, 0x026D930Au, 0x9C0906A9u, 0xEB0E363Fu,
+	0x72076785u, 0x05005713u, 0x95BF4A82u, 0xE2B87A14u, 0x7BB12BAEu, 0x0CB61B38u,
+	0x92D28E9Bu, 0xE5D5BE0Du, 0x7CDCEFB7u, 0x0BDBDF21u, 0x86D3D2D4u, 0xF1D4E242u,
+	0x68DDB3F8u, 0x1FDA836Eu, 0x81BE16CDu, 0xF6B9265Bu, 0x6FB077E1u, 0x18B74777u,
+	0x88085AE6u, 0xFF0F6A70u, 0x66063BCAu, 0x11010B5Cu, 0x8F659EFFu, 0xF862AE69u,
+	0x616BFFD3u, 0x166CCF45u, 0xA00AE278u, 0xD70DD2EEu, 0x4E048354u, 0x3903B3C2u,
+	0xA7672661u, 0xD06016F7u, 0x4969474Du, 0x3E6E77DBu, 0xAED16A4Au, 0xD9D65ADCu,
+	0x40DF0B66u, 0x37D83BF0u, 0xA9BCAE53u, 0xDEBB9EC5u, 0x47B2CF7Fu, 0x30B5FFE9u,
+	0xBDBDF21Cu, 0xCABAC28Au, 0x53B39330u, 0x24B4A3A6u, 0xBAD03605u, 0xCDD70693u,
+	0x54DE5729u, 0x23D967BFu, 0xB3667A2Eu, 0xC4614AB8u, 0x5D681B02u, 0x2A6F2B94u,
+	0xB40BBE37u, 0xC30C8EA1u, 0x5A05DF1Bu, 0x2D02EF8Du
+};
+
+// Declaration of local (module level) functions
+static size_t PayloadSize(unsigned int channel_count);
+static void ArraysOfStore(const ChannelStore *store, unsigned char *array[SNAPSHOT_ARRAYS]);
+static unsigned char *ArrayOfBuffer(const CheckpointWriter *writer, unsigned int index);
+static void CaptureChannels(CheckpointWriter *writer, const ChannelStore *store, unsigned int end);
+static unsigned int LoadSnapshot(ChannelStore *store, const unsigned char *image, size_t size, uint64_t *sequence);
+static unsigned int WriteSnapshot(CheckpointWriter *writer);
+static uint32_t Crc32(uint32_t crc, const unsigned char *data, size_t size);
+static void *CheckpointThread(void *argument);
+
+
+// Function Definitions
+
+/*---------------------------------------------------
+* Definition of function CheckpointWriterInit()
+* Parameters:
+*	writer: writer to be initialized
+*	max_channels: maximum number of channels of the stores to be captured
+*	path: path of the snapshot (at most CHECKPOINT_PATH_SIZE - 1 characters)
+*	period_ns: minimum time between two snapshots in ns
+* Return value:
+*	init_ok: unsigned integer, 1 if the buffer was allocated and the thread started, 0 otherwise
+------------------------------------------------------*/
+unsigned int CheckpointWriterInit(CheckpointWriter *writer, unsigned int max_channels, const char *path, uint64_t period_ns) {
+
+	// Definition of local variables
+	unsigned int init_ok = 0;			// Return value, defensive programming: initialize with 0 (failure)
+
+	memset(writer, 0, sizeof(*writer));
+	writer->max_channels = max_channels;
+	writer->period_ns = period_ns;
+	writer->chunk_channels = CHECKPOINT_CHUNK_CHANNELS;
+	writer->capacity = CheckpointSize(max_channels);
+
+	if((strlen(path) < sizeof(writer->path)) && (pthread_mutex_init(&writer->lock, 0) == 0))
+	{
+		strcpy(writer->path, path);
+		strcpy(writer->temp_path, path);
+		strcat(writer->temp_path, ".tmp");
+
+		if(pthread_cond_init(&writer->wake, 0) == 0)
+		{
+			writer->buffer = malloc(writer->capacity);
+			if((writer->buffer != 0) && (pthread_create(&writer->thread, 0, CheckpointThread, writer) == 0))
+			{
+				init_ok = 1;
+			}
+			else
+			{
+				free(writer->buffer);
+				writer->buffer = 0;
+				pthread_cond_destroy(&writer->wake);
+				pthread_mutex_destroy(&writer->lock);
+			}
+		}
+		else
+		{
+			pthread_mutex_destroy(&writer->lock);
+		}
+	}
+
+	return init_ok;
+}
+
+
+/*---------------------------------------------------
+* Definition of function CheckpointWriterOffer()
+* Called by the scan thread between two scans; starts a snapshot if one is due and copies the next
+* chunk_channels channels of a started snapshot, the thread does not wait for the writer thread in any case
+* Parameters:
+*	writer: writer initialized with CheckpointWriterInit()
+*	store: channel store to be captured (always the same store), must not be modified during the call
+* Return value:
+*	captured: unsigned integer, 1 if a snapshot was completed and handed to the writer thread,
+*		0 if no snapshot was due, the writer is busy or the snapshot is not complete yet
+------------------------------------------------------*/
+unsigned int CheckpointWriterOffer(CheckpointWriter *writer, const ChannelStore *store) {
+
+	// Definition of local variables
+	unsigned int captured = 0;			// Return value, 1 if a snapshot was completed
+	uint64_t now = TelemetryNow();		// actual time in ns
+	unsigned int end = 0;				// channel after the last channel of the chunk
+	CheckpointHeader header;			// header of the completed snapshot
+
+	/*Start of a snapshot, the buffer is owned by the scan thread until the snapshot is complete*/
+	if((writer->capturing == 0) && ((writer->captured == 0) || ((now - writer->last_capture) >= writer->period_ns))
+			&& (pthread_mutex_trylock(&writer->lock) == 0))
+	{
+		if((writer->pending == 0) && (writer->shutdown == 0) && (store->count <= writer->max_channels))
+		{
+			writer->capturing = 1;
+			writer->capture_count = store->count;
+			writer->capture_next = 0;
+			writer->last_capture = now;
+			/*channels are only appended by a registration, a smaller store has other channels*/
+			writer->info_count = (store->count < writer->info_count) ? 0 : writer->info_count;
+		}
+		pthread_mutex_unlock(&writer->lock);
+	}
+
+	/*A registration during the snapshot restarts it, all arrays of a snapshot have the same channels*/
+	if((writer->capturing == 1) && (store->count != writer->capture_count))
+	{
+		writer->capturing = (store->count <= writer->max_channels);
+		writer->capture_count = store->count;
+		writer->capture_next = 0;
+	}
+
+	if(writer->capturing == 1)
+	{
+		end = ((writer->capture_count - writer->capture_next) < writer->chunk_channels) ?
+				writer->capture_count : (writer->capture_next + writer->chunk_channels);
+		CaptureChannels(writer, store, end);
+	}
+
+	/*The complete snapshot is handed to the writer thread, the CRC is calculated by the writer thread*/
+	if((writer->capturing == 1) && (writer->capture_next == writer->capture_count)
+			&& (pthread_mutex_trylock(&writer->lock) == 0))
+	{
+		if(writer->shutdown == 0)
+		{
+			writer->sequence++;
+			memset(&header, 0, sizeof(header));
+			header.magic = CHECKPOINT_MAGIC;
+			header.version = CHECKPOINT_VERSION;
+			header.header_size = sizeof(header);
+			header.info_size = sizeof(ChannelInfo);
+			header.channel_count = writer->capture_count;
+			header.sequence = writer->sequence;
+			header.payload_size = PayloadSize(writer->capture_count);
+			memcpy(writer->buffer, &header, sizeof(header));
+
+			writer->info_count = writer->capture_count;
+			writer->pending = 1;
+			writer->captured++;
+			pthread_cond_signal(&writer->wake);
+			captured = 1;
+		}
+		writer->capturing = 0;
+		pthread_mutex_unlock(&writer->lock);
+	}
+
+	return captured;
+}
+
+
+/*---------------------------------------------------
+* Definition of function CheckpointWriterShutdown()
+* Writes a pending snapshot, stops the writer thread and frees the buffer
+* Parameters:
+*	writer: writer initialized with CheckpointWriterInit()
+* Return value: none
+------------------------------------------------------*/
+void CheckpointWriterShutdown(CheckpointWriter *writer) {
+
+	pthread_mutex_lock(&writer->lock);
+	writer->shutdown = 1;
+	pthread_cond_signal(&writer->wake);
+	pthread_mutex_unlock(&writer->lock);
+
+	pthread_join(writer->thread, 0);
+
+	pthread_cond_destroy(&writer->wake);
+	pthread_mutex_destroy(&writer->lock);
+	free(writer->buffer);
+	writer->buffer = 0;
+}
+
+
+/*---------------------------------------------------
+* Definition of function CheckpointSize()
+* Parameters:
+*	channel_count: number of channels
+* Return value:
+*	size: size of a snapshot of channel_count channels in bytes (header and arrays)
+------------------------------------------------------*/
+size_t CheckpointSize(unsigned int channel_count) {
+
+	return sizeof(CheckpointHeader) + PayloadSize(channel_count);
+}
+
+
+/*---------------------------------------------------
+* Definition of function CheckpointRestore()
+* WARNING: CheckpointRestore() is hardware dependent (mmap())
+* Parameters:
+*	store: channel store initialized with ChannelStoreInit(), its channels are replaced by the snapshot
+*	path: path of the snapshot
+*	sequence: number of the restored snapshot
+* Return value:
+*	restore_ok: unsigned integer, 1 if the snapshot was restored,
+*		0 if the file could not be read, is invalid or does not fit into the store (store unchanged)
+------------------------------------------------------*/
+#if defined(__unix__) || defined(__APPLE__)
+unsigned int CheckpointRestore(ChannelStore *store, const char *path, uint64_t *sequence) {
+
+	// Definition of local variables
+	unsigned int restore_ok = 0;		// Return value, defensive programming: initialize with 0 (failure)
+	int file = open(path, O_RDONLY);	// file descriptor of the snapshot
+	struct stat status;					// size of the snapshot
+	void *image = MAP_FAILED;			// snapshot mapped into memory
+
+	if(file >= 0)
+	{
+		if((fstat(file, &status) == 0) && (status.st_size > 0))
+		{
+			image = mmap(0, (size_t)status.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+			if(image != MAP_FAILED)
+			{
+				restore_ok = LoadSnapshot(store, image, (size_t)status.st_size, sequence);
+				munmap(image, (size_t)status.st_size);
+			}
+		}
+		close(file);
+	}
+
+	return restore_ok;
+}
+#else
+unsigned int CheckpointRestore(ChannelStore *store, const char *path, uint64_t *sequence) {
+
+	// Definition of local variables
+	unsigned int restore_ok = 0;		// Return value, defensive programming: initialize with 0 (failure)
+	FILE *file = fopen(path, "rb");		// snapshot
+	long size = 0;						// size of the snapshot in bytes
+	unsigned char *image = 0;			// snapshot read into memory
+
+	if(file != 0)
+	{
+		if((fseek(file, 0, SEEK_END) == 0) && ((size = ftell(file)) > 0) && (fseek(file, 0, SEEK_SET) == 0))
+		{
+			image = malloc((size_t)size);
+			if((image != 0) && (fread(image, 1, (size_t)size, file) == (size_t)size))
+			{
+				restore_ok = LoadSnapshot(store, image, (size_t)size, sequence);
+			}
+			free(image);
+		}
+		fclose(file);
+	}
+
+	return restore_ok;
+}
+#endif
+
+
+
+// Definition of local (module level) functions
+
+/*---------------------------------------------------
+* Definition of function PayloadSize()
+* Parameters:
+*	channel_count: number of channels
+* Return value:
+*	size: size of the arrays of channel_count channels in bytes
+------------------------------------------------------*/
+static size_t PayloadSize(unsigned int channel_count) {
+
+	// Definition of local variables
+	size_t size = 0;					// Return value, size of the arrays
+	unsigned int index = 0;				// Loop index
+
+	for(index = 0; index < SNAPSHOT_ARRAYS; index++)
+	{
+		size += (size_t)channel_count * ELEMENT_SIZE[index];
+	}
+
+	return size;
+}
+
+
+/*---------------------------------------------------
+* Definition of function ArraysOfStore()
+* Parameters:
+*	store: channel store
+*	array: returns the arrays of the store in the order of a snapshot
+* Return value: none
+------------------------------------------------------*/
+static void ArraysOfStore(const ChannelStore *store, unsigned char *array[SNAPSHOT_ARRAYS]) {
+
+	array[0] = (unsigned char *)store->min_temp;
+	array[1] = (unsigned char *)store->max_temp;
+	array[2] = (unsigned char *)store->max_deltatemp;
+	array[3] = (unsigned char *)store->scan_sensor1;
+	array[4] = (unsigned char *)store->scan_sensor2;
+	array[5] = (unsigned char *)store->scan_delta;
+	array[6] = (unsigned char *)store->temp_sensor1;
+	array[7] = (unsigned char *)store->temp_sensor2;
+	array[8] = store->format;
+	array[9] = store->temp_ok;
+	array[10] = (unsigned char *)store->info;
+}
+
+
+/*---------------------------------------------------
+* Definition of function ArrayOfBuffer()
+* The arrays in the buffer have room for max_channels channels, so an array does not move, when the
+* number of channels changes (the names and formats are kept from one snapshot to the next)
+* Parameters:
+*	writer: writer initialized with CheckpointWriterInit()
+*	index: index of the array, 0 .. SNAPSHOT_ARRAYS - 1
+* Return value:
+*	array: start of the array in the buffer
+------------------------------------------------------*/
+static unsigned char *ArrayOfBuffer(const CheckpointWriter *writer, unsigned int index) {
+
+	// Definition of local variables
+	size_t offset = sizeof(CheckpointHeader);	// offset of the array in the buffer
+	unsigned int previous = 0;			// Loop index
+
+	for(previous = 0; previous < index; previous++)
+	{
+		offset += (size_t)writer->max_channels * ELEMENT_SIZE[previous];
+	}
+
+	return writer->buffer + offset;
+}
+
+
+/*---------------------------------------------------
+* Definition of function CaptureChannels()
+* Copies the channels capture_next .. end - 1 of every array into the buffer; the name and format
+* only for channels, which were registered since the last snapshot
+* Parameters:
+*	writer: writer with a started snapshot
+*	store: channel store to be captured
+*	end: channel after the last channel to be copied, at most capture_count
+* Return value: none
+------------------------------------------------------*/
+static void CaptureChannels(CheckpointWriter *writer, const ChannelStore *store, unsigned int end) {
+
+	// Definition of local variables
+	unsigned char *array[SNAPSHOT_ARRAYS];	// arrays of the store
+	unsigned int first = writer->capture_next;	// first channel to be copied
+	unsigned int index = 0;				// Loop index
+
+	ArraysOfStore(store, array);
+	for(index = 0; index < INFO_ARRAY; index++)
+	{
+		memcpy(ArrayOfBuffer(writer, index) + ((size_t)first * ELEMENT_SIZE[index]),
+				array[index] + ((size_t)first * ELEMENT_SIZE[index]), (size_t)(end - first) * ELEMENT_SIZE[index]);
+	}
+
+	first = (first < writer->info_count) ? writer->info_count : first;
+	if(first < end)
+	{
+		memcpy(ArrayOfBuffer(writer, INFO_ARRAY) + ((size_t)first * sizeof(ChannelInfo)),
+				&store->info[first], (size_t)(end - first) * sizeof(ChannelInfo));
+	}
+	writer->capture_next = end;
+}
+
+
+/*---------------------------------------------------
+* Definition of function LoadSnapshot()
+* Parameters:
+*	store: channel store initialized with ChannelStoreInit()
+*	image: snapshot in memory (no alignment required)
+*	size: size of the snapshot in bytes
+*	sequence: number of the snapshot
+* Return value:
+*	load_ok: unsigned integer, 1 if the snapshot is valid and was copied into the store, 0 otherwise
+------------------------------------------------------*/
+static unsigned int LoadSnapshot(ChannelStore *store, const unsigned char *image, size_t size, uint64_t *sequence) {
+
+	// Definition of local variables
+	unsigned int load_ok = 0;			// Return value, defensive programming: initialize with 0 (failure)
+	CheckpointHeader header;			// header of the snapshot
+	const unsigned char *next = image + sizeof(header);	// start of the next array
+	unsigned char *array[SNAPSHOT_ARRAYS];	// arrays of the store
+	size_t array_size = 0;				// size of an array of the snapshot
+	unsigned int index = 0;				// Loop index
+
+	if(size >= sizeof(header))
+	{
+		memcpy(&header, image, sizeof(header));
+		/*The CRC is only checked if the header is consistent, i.e. the payload is within the file*/
+		if((header.magic == CHECKPOINT_MAGIC) && (header.version == CHECKPOINT_VERSION)
+				&& (header.header_size == sizeof(header)) && (header.info_size == sizeof(ChannelInfo))
+				&& (header.channel_count <= store->capacity) && (header.payload_size == PayloadSize(header.channel_count))
+				&& ((size - sizeof(header)) >= header.payload_size)
+				&& (Crc32(0, next, (size_t)header.payload_size) == header.crc))
+		{
+			ArraysOfStore(store, array);
+			for(index = 0; index < SNAPSHOT_ARRAYS; index++)
+			{
+				array_size = (size_t)header.channel_count * ELEMENT_SIZE[index];
+				memcpy(array[index], next, array_size);
+				next += array_size;
+			}
+			store->count = header.channel_count;
+			*sequence = header.sequence;
+			load_ok = 1;
+		}
+	}
+
+	return load_ok;
+}
+
+
+/*---------------------------------------------------
+* Definition of function WriteSnapshot()
+* Called by the writer thread without lock, the buffer is owned by the thread while pending is 1
+* Parameters:
+*	writer: writer with a captured snapshot
+* Return value:
+*	write_ok: unsigned integer, 1 if the snapshot was written and renamed, 0 otherwise
+------------------------------------------------------*/
+static unsigned int WriteSnapshot(CheckpointWriter *writer) {
+
+	// Definition of local variables
+	unsigned int write_ok = 0;			// Return value, defensive programming: initialize with 0 (failure)
+	CheckpointHeader header;			// header of the captured snapshot
+	size_t array_size = 0;				// size of an array of the snapshot
+	unsigned int index = 0;				// Loop index
+	FILE *file = 0;						// temporary file
+
+	/*The arrays are written packed, the first channel_count channels of every array*/
+	memcpy(&header, writer->buffer, sizeof(header));
+	for(index = 0; index < SNAPSHOT_ARRAYS; index++)
+	{
+		array_size = (size_t)header.channel_count * ELEMENT_SIZE[index];
+		header.crc = Crc32(header.crc, ArrayOfBuffer(writer, index), array_size);
+	}
+
+	file = fopen(writer->temp_path, "wb");
+	if(file != 0)
+	{
+		write_ok = (fwrite(&header, 1, sizeof(header), file) == sizeof(header));
+		for(index = 0; index < SNAPSHOT_ARRAYS; index++)
+		{
+			array_size = (size_t)header.channel_count * ELEMENT_SIZE[index];
+			write_ok &= (fwrite(ArrayOfBuffer(writer, index), 1, array_size, file) == array_size);
+		}
+		write_ok &= (fflush(file) == 0);
+#if defined(__unix__) || defined(__APPLE__)
+		/*The snapshot must be on the disk before it replaces the previous one*/
+		write_ok &= (fsync(fileno(file)) == 0);
+#endif
+		write_ok &= (fclose(file) == 0);
+		write_ok = write_ok && (rename(writer->temp_path, writer->path) == 0);
+	}
+
+	return write_ok;
+}
+
+
+/*---------------------------------------------------
+* Definition of function Crc32()
+* Parameters:
+*	crc: CRC-32 of the preceding data, 0 at the start
+*	data: data to be protected
+*	size: size of the data in bytes
+* Return value:
+*	crc: CRC-32 (IEEE 802.3) of the preceding data and the data
+------------------------------------------------------*/
+static uint32_t Crc32(uint32_t crc, const unsigned char *data, size_t size) {
+
+	// Definition of local variables
+	size_t index = 0;					// Loop index
+
+	crc ^= 0xFFFFFFFFu;
+
+	for(index = 0; index < size; index++)
+	{
+		crc = CRC_TABLE[(crc ^ data[index]) & 0xFFu] ^ (crc >> 8);
+	}
+
+	return crc ^ 0xFFFFFFFFu;
+}
+
+
+/*---------------------------------------------------
+* Definition of function CheckpointThread()
+* Writes every captured snapshot; finishes at shutdown after the pending snapshot was written
+* Parameters:
+*	argument: CheckpointWriter
+* Return value:
+*	0
+------------------------------------------------------*/
+static void *CheckpointThread(void *argument) {
+
+	// Definition of local variables
+	CheckpointWriter *writer = argument;	// writer of the thread
+	unsigned int write_ok = 0;			// result of the last write
+
+	pthread_mutex_lock(&writer->lock);
+	for(;;)
+	{
+		while((writer->pending == 0) && (writer->shutdown == 0))
+		{
+			pthread_cond_wait(&writer->wake, &writer->lock);
+		}
+		if(writer->pending == 0)
+		{
+			break;
+		}
+		pthread_mutex_unlock(&writer->lock);
+
+		write_ok = WriteSnapshot(writer);
+
+		pthread_mutex_lock(&writer->lock);
+		writer->written += write_ok;
+		writer->failures += 1u - write_ok;
+		writer->pending = 0;
+	}
+	pthread_mutex_unlock(&writer->lock);
+
+	return 0;
+}
+
+
+// End of file checkpoint.c
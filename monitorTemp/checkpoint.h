@@ -0,0 +1,127 @@
+/* ---------------------------------------------------------------------------------------------
+ * Module Name: Safe Temperature Monitoring
+ * File Name: checkpoint.h
+ * Corresponding Source-File: checkpoint.c
+ * Created on: 19.10.2026
+ * Development Group: CKN GmbH
+ * Project: FSQM SW Development Exercise
+ * Dependencies: channelStore.h, POSIX threads (link with -pthread), mmap() and fsync() (POSIX, hardware
+ * 		dependent, on other systems the snapshot is read with fread() and not synchronized),
+ * 		stdlib.h (memory is only allocated in CheckpointWriterInit() and, without mmap(), in CheckpointRestore())
+ *
+ * Description: This file contains the function prototypes of the checkpoint of the channel store.
+ * The implementation of the functions can be found in the corresponding source file checkpoint.c
+ *
+ *  a checkpoint is a snapshot of the complete runtime state of all channels of a channel store
+ *  (limits, readings, results, names and formats): a versioned header followed by the
+ *  arrays of the store, packed without gaps; the arrays are protected by a CRC-32
+ *
+ *  the state of the sensor health monitoring (sensorHealth.h) and of the rollups (rollup.h) is not part
+ *  of a snapshot: both are derived from the readings of the following scans, so after a restore the
+ *  health detectors start again with empty history and the rollup windows start empty
+ *
+ *  checkpointWriterOffer() is called by the scan thread between two scans; if the period has expired
+ *  and the last snapshot has been written, a snapshot is started; every call copies the next chunk of
+ *  chunk_channels channels of a started snapshot into a preallocated buffer (memcpy only), the snapshot is
+ *  complete after ceil(N / chunk_channels) calls; the CRC and the file operations are carried out by a
+ *  background thread, so the scan is never blocked by the file system
+ *
+ *  pause of the scan thread: a call copies at most chunk_channels channels (CHECKPOINT_CHUNK_CHANNELS
+ *  after CheckpointWriterInit()), 30 bytes of limits, readings and result per channel and 25 bytes
+ *  (sizeof(ChannelInfo)) only for channels registered since the last snapshot, i.e. at most 30 KB per call
+ *  (about 55 KB for the first snapshot), independent of the number of channels of the store
+ *
+ *  every channel of a snapshot is consistent (copied between two scans), the channels of different chunks
+ *  can be from different scans of the capture; a registration during the capture restarts the snapshot;
+ *  the writer expects, that channels are only appended to the captured store (ChannelStoreRegister())
+ *
+ *  the snapshot is written into <path>.tmp and then renamed to <path>, so the file at <path> is
+ *  always a complete snapshot
+ *
+ *  checkpointRestore() maps a snapshot into memory, checks header and CRC and copies the arrays into a
+ *  channel store; a snapshot of a different version or layout is rejected
+ * ----------------------------------------------------------------------------------------------
+ * Versions:
+ *
+ * Version: 0.1 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * Initial version, definition of functions
+ *
+ * Version: 0.2 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * Snapshot format version 2, limits and readings of the channel store in 32 bit scan units
+ *
+ * Version: 0.3 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * Snapshot copied in chunks of channels with bounded pause, names copied only for new channels
+ *
+ * Version: 0.4 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * Unused display text removed from the snapshot (format version 3), state of sensor health and rollups documented as not included
+ *
+ * ----------------------------------------------------------------------------------------------  */
+
+#ifndef CHECKPOINT_H_
+#define CHECKPOINT_H_
+
+#include <pthread.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "channelStore.h"
+
+// Declaration of constants (enumeration constants, usable as array sizes)
+enum {
+	CHECKPOINT_VERSION = 3,			// version of the snapshot format, increased with every change of the layout
+	CHECKPOINT_CHUNK_CHANNELS = 1024,	// channels copied by one call of CheckpointWriterOffer()
+	CHECKPOINT_PATH_SIZE = 256		// maximum length of the path of the snapshot including '\0'
+};
+
+// Declaration of types
+// Header of a snapshot, followed by the arrays of the channel store
+typedef struct {
+	uint32_t magic;					// "MTCP", identifies a snapshot
+	uint32_t version;				// CHECKPOINT_VERSION of the writer
+	uint32_t header_size;			// sizeof(CheckpointHeader) of the writer
+	uint32_t channel_count;			// number of channels in the snapshot
+	uint64_t sequence;				// number of the snapshot, increased with every snapshot
+	uint64_t payload_size;			// size of the arrays after the header in bytes
+	uint32_t crc;					// CRC-32 of the arrays
+	uint32_t info_size;				// sizeof(ChannelInfo) of the writer
+} CheckpointHeader;
+
+// Background writer of snapshots
+typedef struct {
+	unsigned char *buffer;			// captured snapshot (header and arrays of max_channels channels)
+	size_t capacity;				// size of the buffer in bytes
+	unsigned int max_channels;		// maximum number of channels of a snapshot
+	unsigned int chunk_channels;	// channels copied by one call of CheckpointWriterOffer()
+	unsigned int capturing;			// 1 while a snapshot is copied (buffer owned by the scan thread)
+	unsigned int capture_count;		// number of channels of the snapshot being copied
+	unsigned int capture_next;		// next channel to be copied
+	unsigned int info_count;		// number of channels, whose name and format are in the buffer
+	uint64_t period_ns;				// minimum time between two snapshots in ns
+	uint64_t last_capture;			// start of the last capture in ns (TelemetryNow())
+	uint64_t sequence;				// number of the last captured snapshot
+	unsigned int pending;			// 1 while a captured snapshot waits to be written (buffer owned by the thread)
+	unsigned int shutdown;			// 1 if the thread shall finish
+	unsigned long captured;			// number of captured snapshots
+	unsigned long written;			// number of written snapshots
+	unsigned long failures;			// number of snapshots which could not be written
+	pthread_t thread;				// thread writing the snapshots
+	pthread_mutex_t lock;			// protects pending, shutdown and the counters
+	pthread_cond_t wake;			// signalled when a snapshot was captured or at shutdown
+	char path[CHECKPOINT_PATH_SIZE];	// path of the snapshot
+	char temp_path[CHECKPOINT_PATH_SIZE + 4];	// path of the snapshot while it is written
+} CheckpointWriter;
+
+extern unsigned int CheckpointWriterInit(CheckpointWriter *writer, unsigned int max_channels, const char *path, uint64_t period_ns);
+extern unsigned int CheckpointWriterOffer(CheckpointWriter *writer, const ChannelStore *store);
+extern void CheckpointWriterShutdown(CheckpointWriter *writer);
+extern size_t CheckpointSize(unsigned int channel_count);
+extern unsigned int CheckpointRestore(ChannelStore *store, const char *path, uint64_t *sequence);
+
+#endif /* CHECKPOINT_H_ */
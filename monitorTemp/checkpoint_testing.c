@@ -0,0 +1,199 @@
+/* ---------------------------------------------------------------------------------------------
+* Module Name: Checkpoint Testing for CheckpointRestore()
+* File Name: checkpoint_testing.c
+* Corresponding Header-File: checkpoint_testing.h
+* Created on: 19.10.2026
+* Development Group: CKN GmbH
+* Project: FSQM SW Development Exercise (Checkpoint Testing Functions)
+* Dependencies: CheckpointWriterOffer(), CheckpointRestore(), stdio.h (hardware dependent), nanosleep() (POSIX),
+* 		write access to the working directory
+*
+* Description: This file contains the checkpoint testing function
+*
+* PerformCheckpointTest() is a function, which writes a snapshot of a channel store in the background,
+* restores it into a second store, checks that a corrupted snapshot is rejected and that a large store is
+* captured in chunks
+*
+* ----------------------------------------------------------------------------------------------
+* Versions:
+* Version: 0.1 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* 2 checkpoint tests were implemented
+*
+* Version: 0.2 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Test of a snapshot captured in chunks was implemented
+*
+* ----------------------------------------------------------------------------------------------*/
+// Include system header files
+#include <stdio.h> // stdio.h is necessary for printing/reading via standard IO
+#include <string.h> // string.h is necessary for string operations
+#include <time.h> // time.h is necessary for nanosleep
+// Include own header files
+#include "channelStore.h"
+#include "checkpoint.h"
+// Definition of global constants (only if really necessary, see coding rules)
+// No globals
+// Definition of global variables (should be avoided, see coding rules)
+// No globals
+// Definition of global and local functions (sorted by topic, if possible)
+
+/*---------------------------------------------------
+* Definition of function PerformCheckpointTest()
+* Parameters:
+* None
+* Return value:
+* test_complete: unsigned integer, 1 if all tests were succesful, 0 if one or more tests failed
+------------------------------------------------------*/
+unsigned int PerformCheckpointTest(void) {
+	// Definition of local variables
+	const char *path = "monitorTemp_checkpoint_test.bin"; // path of the snapshot
+	CheckpointWriter writer; // writer under test
+	ChannelStore store; // channel store with 3 channels: OK, alarm, no reading
+	ChannelStore restored; // channel store restored from the snapshot
+	ChannelStore large; // channel store with 2501 channels, captured in chunks
+	ChannelStore large_restored; // channel store restored from the snapshot of the large store
+	unsigned int offers[3] = {0, 0, 0}; // results of the 3 offers of a snapshot of 2500 channels
+	unsigned int index = 0; // Loop index over the channels
+	unsigned int tries = 0; // number of offers until the second snapshot is complete
+	struct timespec wait = {0, 1000000}; // 1 ms between two offers
+	unsigned int channel = 0; // index of a registered channel
+	unsigned int captured[2] = {0, 0}; // results of two offers directly after each other
+	unsigned int restore_ok = 0; // result of CheckpointRestore()
+	unsigned int equal = 0; // 1 if both stores are equal
+	uint64_t sequence = 0; // number of the restored snapshot
+	FILE *file = 0; // snapshot to be corrupted
+	int byte = 0; // byte of the snapshot to be corrupted
+	char message[40]; // String array for test result message
+	unsigned int total_tests = 0; // Total number of tests
+	unsigned int successful_tests = 0; // Total number of successful test
+
+	unsigned int test_complete = 0; // 1 if all tests OK, 0 if one or more tests failed
+	// For printf() function, buffer setting (no buffering)
+	setvbuf(stdout, NULL, _IONBF, 0);
+
+	if ((ChannelStoreInit(&store, 3) == 0) || (ChannelStoreInit(&restored, 3) == 0)) {
+		printf("\n\nCPT: channel stores could not be allocated\n");
+		ChannelStoreFree(&store);
+		return 0;
+	}
+	ChannelStoreRegister(&store, "OK", 'C', -10.0, 80.0, 3.0, &channel);
+	ChannelStoreSetReading(&store, channel, 55.1, 55.5);
+	ChannelStoreRegister(&store, "alarm", 'F', 32.0, 212.0, 9.0, &channel);
+	ChannelStoreSetReading(&store, channel, 220.0, 200.0);
+	ChannelStoreRegister(&store, "no reading", 'C', -10.0, 80.0, 3.0, &channel);
+	ChannelStoreScan(&store, 0, store.count);
+	// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+	// Checkpoint tests (CPT)
+	// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+	// CPT1: A snapshot written in the background restores the complete state of the store
+	total_tests++;
+	printf("\n\nCPT1: Test with 3 channels, snapshot restored into a second store\n");
+	// Initialize test result message with negative test result, will only be changed if test is successful
+	strcpy(message, "CPT1 FAILED, Sequence: \0");
+	if (CheckpointWriterInit(&writer, 3, path, 1000000000u) == 1) {
+		captured[0] = CheckpointWriterOffer(&writer, &store);
+		captured[1] = CheckpointWriterOffer(&writer, &store);
+		CheckpointWriterShutdown(&writer);
+		restore_ok = CheckpointRestore(&restored, path, &sequence);
+	}
+	if (restore_ok == 1) {
+		equal = (restored.count == store.count)
+				&& (memcmp(restored.min_temp, store.min_temp, store.count * sizeof(int32_t)) == 0)
+				&& (memcmp(restored.temp_sensor1, store.temp_sensor1, store.count * sizeof(int16_t)) == 0)
+				&& (memcmp(restored.temp_ok, store.temp_ok, store.count) == 0)
+				&& (strcmp(restored.info[1].name, "alarm") == 0) && (restored.info[1].format == 'F');
+		// the restored store is monitored without a new registration
+		ChannelStoreScan(&restored, 0, restored.count);
+		equal &= (memcmp(restored.temp_ok, store.temp_ok, store.count) == 0);
+	}
+	// Expected: first offer captured, second offer not due, sequence 1, both stores equal
+	if ((captured[0] == 1) && (captured[1] == 0) && (writer.written == 1) && (sequence == 1) && (equal == 1)) {
+		strcpy(message, "CPT1 SUCCESFUL, Sequence: \0");
+		successful_tests++;
+	}
+	// Print test result
+	printf("\n%s%lu", message, (unsigned long)sequence);
+	// End of CPT1
+
+	// CPT2: A corrupted snapshot is rejected, the store is not modified
+	total_tests++;
+	printf("\n\nCPT2: Test with one corrupted byte, snapshot rejected\n");
+	// Initialize test result message with negative test result, will only be changed if test is successful
+	strcpy(message, "CPT2 FAILED, Return value: \0");
+	file = fopen(path, "r+b");
+	restore_ok = 1;
+	if ((file != 0) && (fseek(file, (long)CheckpointSize(3) - 1, SEEK_SET) == 0)) {
+		byte = fgetc(file);
+		fseek(file, (long)CheckpointSize(3) - 1, SEEK_SET);
+		fputc(byte ^ 0x01, file);
+		fclose(file);
+		restored.count = 0;
+		restore_ok = CheckpointRestore(&restored, path, &sequence);
+	}
+	// Expected return value: 0, no channels restored
+	if ((restore_ok == 0) && (restored.count == 0)) {
+		strcpy(message, "CPT2 SUCCESFUL, Return value: \0");
+		successful_tests++;
+	}
+	// Print test result
+	printf("\n%s%d", message, restore_ok);
+	// End of CPT2
+
+	// CPT3: A large store is copied in chunks of 1024 channels, names are only copied for new channels
+	total_tests++;
+	printf("\n\nCPT3: Test with 2500 channels in 3 chunks, 1 channel registered, second snapshot restored\n");
+	// Initialize test result message with negative test result, will only be changed if test is successful
+	strcpy(message, "CPT3 FAILED, Sequence: \0");
+	equal = 0;
+	sequence = 0;
+	if ((ChannelStoreInit(&large, 2501) == 1) && (ChannelStoreInit(&large_restored, 2501) == 1)) {
+		ChannelStoreRegister(&large, "first", 'C', -10.0, 80.0, 3.0, &channel);
+		for (index = 1; index < 2500; index++) {
+			ChannelStoreRegister(&large, "channel", 'F', 32.0, 212.0, 9.0, &channel);
+			ChannelStoreSetReading(&large, channel, (float)(50 + (index % 150)), 100.0);
+		}
+		ChannelStoreScan(&large, 0, large.count);
+		if (CheckpointWriterInit(&writer, 2501, path, 0) == 1) {
+			offers[0] = CheckpointWriterOffer(&writer, &large);
+			offers[1] = CheckpointWriterOffer(&writer, &large);
+			offers[2] = CheckpointWriterOffer(&writer, &large);
+			ChannelStoreRegister(&large, "new", 'C', -10.0, 80.0, 3.0, &channel);
+			ChannelStoreSetReading(&large, channel, 20.0, 20.5);
+			ChannelStoreScan(&large, channel, 1);
+			// the second snapshot starts when the first one has been written
+			while ((CheckpointWriterOffer(&writer, &large) == 0) && (tries < 10000)) {
+				nanosleep(&wait, 0);
+				tries++;
+			}
+			CheckpointWriterShutdown(&writer);
+			restore_ok = CheckpointRestore(&large_restored, path, &sequence);
+			equal = (restore_ok == 1) && (large_restored.count == 2501)
+					&& (memcmp(large_restored.scan_sensor1, large.scan_sensor1, large.count * sizeof(int32_t)) == 0)
+					&& (memcmp(large_restored.temp_ok, large.temp_ok, large.count) == 0)
+					&& (strcmp(large_restored.info[0].name, "first") == 0) && (strcmp(large_restored.info[2499].name, "channel") == 0)
+					&& (strcmp(large_restored.info[2500].name, "new") == 0) && (large_restored.info[2500].format == 'C');
+		}
+	}
+	// Expected: the first snapshot complete with the third offer, sequence 2, both stores equal
+	if ((offers[0] == 0) && (offers[1] == 0) && (offers[2] == 1) && (sequence == 2) && (equal == 1)) {
+		strcpy(message, "CPT3 SUCCESFUL, Sequence: \0");
+		successful_tests++;
+	}
+	// Print test result
+	printf("\n%s%lu", message, (unsigned long)sequence);
+	// End of CPT3
+
+	remove(path);
+	ChannelStoreFree(&large_restored);
+	ChannelStoreFree(&large);
+	ChannelStoreFree(&restored);
+	ChannelStoreFree(&store);
+
+	test_complete = (successful_tests == total_tests);
+
+	return test_complete;
+
+}
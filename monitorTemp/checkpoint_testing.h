@@ -0,0 +1,28 @@
+/* ---------------------------------------------------------------------------------------------
+ * Module Name: Safe Temperature Monitoring
+ * File Name: checkpoint_testing.h
+ * Corresponding Source-File: checkpoint_testing.c
+ * Created on: 19.10.2026
+ * Development Group: CKN GmbH
+ * Project: FSQM SW Development Exercise
+ * Dependencies: CheckpointRestore(), stdio.h (hardware dependent)
+ *
+ * Description: This file contains the test cases for the checkpoint of the Safe Temperature Monitoring module
+ *
+
+ * ----------------------------------------------------------------------------------------------
+ * Versions:
+ *
+ * Version: 0.1 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * Initial version, definition of functions
+ *
+ * ----------------------------------------------------------------------------------------------  */
+
+#ifndef CHECKPOINT_TESTING_H_
+#define CHECKPOINT_TESTING_H_
+
+extern unsigned int PerformCheckpointTest(void);
+
+#endif /* CHECKPOINT_TESTING_H_ */
@@ -0,0 +1,357 @@
+/* ---------------------------------------------------------------------------------------------
+* Module Name: Safe Temperature Monitoring
+* File Name: columnExport.c
+* Corresponding Header-File: columnExport.h
+* Created on: 19.10.2026
+* Development Group: CKN GmbH
+* Project: FSQM SW Development Exercise
+* Dependencies: channelStore.c, stdio.h (file operations), stdlib.h (memory is only allocated in ColumnExportOpen())
+*
+* Description: This file contains the functions of the columnar export of the results.
+*
+*  columnExportOpen() creates the file and writes the file header with the column descriptors
+*
+*  columnExportWriteBatch() writes one record batch: every column is written with one fwrite(); the
+*  readings are converted from the scan arrays into centi-degree of the registered format and averaged
+*  in one pass into preallocated buffers, the other columns are written directly from the arrays of the
+*  channel store; the padding of the buffers is written from a zero filled buffer
+*
+*  columnExportCheckFile() and columnExportNextBatch() are the reading side: they check a mapped file
+*  and return pointers to the column buffers of one batch after the other, nothing is copied
+*
+* ----------------------------------------------------------------------------------------------
+* Versions:
+* Version: 0.1 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Initial version, columnar export with record batches
+*
+* Version: 0.2 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Shared constants and helpers taken from monitorCommon.h
+*
+* Version: 0.3 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Readings and average exported in centi-degree of the registered format (file format version 2)
+*
+* ----------------------------------------------------------------------------------------------*/
+
+// Include system header files
+#include <stdint.h> // stdint.h is necessary for the fixed size columns
+#include <stdio.h> // stdio.h is necessary for the file operations
+#include <stdlib.h> // stdlib.h is necessary for malloc/free
+#include <string.h> // string.h is necessary for memcpy/memcmp
+// Include own header files
+#include "channelStore.h"
+#include "columnExport.h"
+
+// Definition of local (module level) constants
+// Magic number of the file
+static const char FILE_MAGIC[8] = {'M', 'T', 'C', 'O', 'L', 'U', 'M', 'N'};
+// Magic number of a record batch, "BTCH" in a little endian file
+static const uint32_t BATCH_MAGIC = 0x48435442u;
+// Byte order mark, written in the byte order of the writer
+static const uint32_t BYTE_ORDER_MARK = 0x01020304u;
+// Schema of the file, in the order of the COLUMN_* constants
+static const ColumnDescriptor COLUMNS[COLUMN_COUNT] = {
+	{"temp_sensor1", COLUMN_TYPE_INT32, sizeof(int32_t)},
+	{"temp_sensor2", COLUMN_TYPE_INT32, sizeof(int32_t)},
+	{"temp_average", COLUMN_TYPE_INT32, sizeof(int32_t)},
+	{"format", COLUMN_TYPE_UINT8, sizeof(uint8_t)},
+	{"temp_ok", COLUMN_TYPE_UINT8, sizeof(uint8_t)},
+	{"findings", COLUMN_TYPE_UINT8, sizeof(uint8_t)}
+};
+
+// Declaration of local (module level) functions
+static unsigned int WriteColumn(ColumnExport *writer, const void *data, size_t size);
+static size_t AlignToColumn(size_t size);
+static size_t HeaderSize(void);
+
+
+// Function Definitions
+
+/*---------------------------------------------------
+* Definition of function ColumnExportOpen()
+* Parameters:
+*	writer: writer to be initialized
+*	path: path of the export file, an existing file is replaced
+*	capacity: maximum number of rows of a batch
+* Return value:
+*	open_ok: unsigned integer, 1 if the file was created and the header written, 0 otherwise
+------------------------------------------------------*/
+unsigned int ColumnExportOpen(ColumnExport *writer, const char *path, unsigned int capacity) {
+
+	// Definition of local variables
+	unsigned int open_ok = 0;			// Return value, defensive programming: initialize with 0 (failure)
+	size_t column_size = AlignToColumn(capacity * sizeof(int32_t));	// size of a temperature buffer
+	size_t zero_size = (size_t)capacity + COLUMN_EXPORT_ALIGNMENT;		// size of the zero buffer
+	ColumnFileHeader header;			// header of the file
+
+	memset(writer, 0, sizeof(*writer));
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, FILE_MAGIC, sizeof(header.magic));
+	header.version = COLUMN_EXPORT_VERSION;
+	header.byte_order = BYTE_ORDER_MARK;
+	header.header_size = (uint32_t)HeaderSize();
+	header.column_count = COLUMN_COUNT;
+	header.alignment = COLUMN_EXPORT_ALIGNMENT;
+
+	writer->memory = malloc((3 * column_size) + zero_size);
+	if(writer->memory != 0)
+	{
+		writer->sensor1 = (int32_t *)writer->memory;
+		writer->sensor2 = (int32_t *)((uint8_t *)writer->memory + column_size);
+		writer->average = (int32_t *)((uint8_t *)writer->memory + (2 * column_size));
+		writer->zero = (uint8_t *)writer->memory + (3 * column_size);
+		memset(writer->zero, 0, zero_size);
+		writer->capacity = capacity;
+
+		writer->file = fopen(path, "wb");
+		if(writer->file != 0)
+		{
+			open_ok = (fwrite(&header, sizeof(header), 1, writer->file) == 1)
+					&& (fwrite(COLUMNS, sizeof(COLUMNS), 1, writer->file) == 1);
+			if(open_ok == 0)
+			{
+				fclose(writer->file);
+				writer->file = 0;
+			}
+		}
+		if(open_ok == 0)
+		{
+			free(writer->memory);
+			writer->memory = 0;
+		}
+	}
+
+	return open_ok;
+}
+
+
+/*---------------------------------------------------
+* Definition of function ColumnExportWriteBatch()
+* Writes the channels first .. first + count - 1 of the store as one record batch
+* Parameters:
+*	writer: writer opened with ColumnExportOpen()
+*	store: channel store, scanned with ChannelStoreScan()
+*	findings: findings of the sensor health monitoring (SensorHealth findings), 0 if not used
+*	first: index of the first channel
+*	count: number of channels, at most the capacity of the writer
+*	sequence: number of the scan
+*	timestamp_ns: time of the scan in ns
+* Return value:
+*	write_ok: unsigned integer, 1 if the batch was written, 0 otherwise
+------------------------------------------------------*/
+unsigned int ColumnExportWriteBatch(ColumnExport *writer, const ChannelStore *store, const uint8_t *findings,
+		unsigned int first, unsigned int count, uint64_t sequence, uint64_t timestamp_ns) {
+
+	// Definition of local variables
+	unsigned int write_ok = 0;			// Return value, defensive programming: initialize with 0 (failure)
+	unsigned int rows = 0;				// number of rows of the batch
+	unsigned int row = 0;				// Loop index
+	unsigned int column = 0;			// Loop index over the columns
+	int32_t sum = 0;					// sum of both readings
+	unsigned int invalid1 = 0;			// 1 if the reading of sensor 1 is invalid
+	unsigned int invalid2 = 0;			// 1 if the reading of sensor 2 is invalid
+	ColumnBatchHeader header;			// header of the batch
+	// Local copies of the array pointers, see ChannelStoreScan()
+	const int32_t *scan_sensor1 = store->scan_sensor1 + first;
+	const int32_t *scan_sensor2 = store->scan_sensor2 + first;
+	int32_t *sensor1 = writer->sensor1;
+	int32_t *sensor2 = writer->sensor2;
+	int32_t *average = writer->average;
+
+	if(first < store->count)
+	{
+		rows = ((store->count - first) < count) ? (store->count - first) : count;
+	}
+
+	if((writer->file != 0) && (rows <= writer->capacity))
+	{
+		/*Readings in the registered format; average as in DisplayTemp(), rounded half away from zero,
+		invalid if one of the readings is invalid*/
+		for(row = 0; row < rows; row++)
+		{
+			invalid1 = (scan_sensor1[row] == CHANNEL_INVALID_UNITS);
+			invalid2 = (scan_sensor2[row] == CHANNEL_INVALID_UNITS);
+			sensor1[row] = invalid1 ? COLUMN_INVALID_CENTI : ChannelStoreNativeCenti(store, first + row, scan_sensor1[row]);
+			sensor2[row] = invalid2 ? COLUMN_INVALID_CENTI : ChannelStoreNativeCenti(store, first + row, scan_sensor2[row]);
+			sum = (invalid1 | invalid2) ? 0 : (sensor1[row] + sensor2[row]);
+			sum = (sum + (sum > 0) - (sum < 0)) / 2;
+			average[row] = (invalid1 | invalid2) ? COLUMN_INVALID_CENTI : sum;
+		}
+
+		memset(&header, 0, sizeof(header));
+		header.magic = BATCH_MAGIC;
+		header.row_count = rows;
+		header.first_channel = first;
+		header.column_count = COLUMN_COUNT;
+		header.sequence = sequence;
+		header.timestamp_ns = timestamp_ns;
+		for(column = 0; column < COLUMN_COUNT; column++)
+		{
+			header.body_size += AlignToColumn((size_t)rows * COLUMNS[column].element_size);
+		}
+
+		write_ok = (fwrite(&header, sizeof(header), 1, writer->file) == 1);
+		write_ok &= WriteColumn(writer, sensor1, rows * sizeof(int32_t));
+		write_ok &= WriteColumn(writer, sensor2, rows * sizeof(int32_t));
+		write_ok &= WriteColumn(writer, average, rows * sizeof(int32_t));
+		write_ok &= WriteColumn(writer, store->format + first, rows);
+		write_ok &= WriteColumn(writer, store->temp_ok + first, rows);
+		write_ok &= WriteColumn(writer, (findings != 0) ? (findings + first) : writer->zero, rows);
+
+		writer->batches += write_ok;
+		writer->rows += write_ok * rows;
+	}
+	writer->failures += 1u - write_ok;
+
+	return write_ok;
+}
+
+
+/*---------------------------------------------------
+* Definition of function ColumnExportClose()
+* Parameters:
+*	writer: writer opened with ColumnExportOpen()
+* Return value:
+*	close_ok: unsigned integer, 1 if all batches were written and the file was closed, 0 otherwise
+------------------------------------------------------*/
+unsigned int ColumnExportClose(ColumnExport *writer) {
+
+	// Definition of local variables
+	unsigned int close_ok = 0;			// Return value, defensive programming: initialize with 0 (failure)
+
+	if(writer->file != 0)
+	{
+		close_ok = (fclose(writer->file) == 0) && (writer->failures == 0);
+		writer->file = 0;
+	}
+	free(writer->memory);
+	writer->memory = 0;
+	writer->sensor1 = 0;
+	writer->sensor2 = 0;
+	writer->average = 0;
+	writer->zero = 0;
+
+	return close_ok;
+}
+
+
+/*---------------------------------------------------
+* Definition of function ColumnExportCheckFile()
+* Parameters:
+*	image: export file in memory (e.g. mapped with mmap()), aligned to COLUMN_EXPORT_ALIGNMENT
+*	size: size of the file in bytes
+* Return value:
+*	file_ok: unsigned integer, 1 if the header corresponds to this version, schema and byte order, 0 otherwise
+------------------------------------------------------*/
+unsigned int ColumnExportCheckFile(const unsigned char *image, size_t size) {
+
+	// Definition of local variables
+	unsigned int file_ok = 0;			// Return value, defensive programming: initialize with 0 (failure)
+	ColumnFileHeader header;			// header of the file
+
+	if(size >= HeaderSize())
+	{
+		memcpy(&header, image, sizeof(header));
+		file_ok = (memcmp(header.magic, FILE_MAGIC, sizeof(header.magic)) == 0)
+				&& (header.version == COLUMN_EXPORT_VERSION) && (header.byte_order == BYTE_ORDER_MARK)
+				&& (header.header_size == HeaderSize()) && (header.column_count == COLUMN_COUNT)
+				&& (header.alignment == COLUMN_EXPORT_ALIGNMENT)
+				&& (memcmp(image + sizeof(header), COLUMNS, sizeof(COLUMNS)) == 0);
+	}
+
+	return file_ok;
+}
+
+
+/*---------------------------------------------------
+* Definition of function ColumnExportNextBatch()
+* Parameters:
+*	image: export file in memory, checked with ColumnExportCheckFile()
+*	size: size of the file in bytes
+*	offset: position of the next batch, 0 for the first batch; set to the position after the batch
+*	view: header and column buffers of the batch, the buffers point into image
+* Return value:
+*	batch_ok: unsigned integer, 1 if a complete batch was found, 0 at the end of the file or for an invalid batch
+------------------------------------------------------*/
+unsigned int ColumnExportNextBatch(const unsigned char *image, size_t size, size_t *offset, ColumnBatchView *view) {
+
+	// Definition of local variables
+	unsigned int batch_ok = 0;			// Return value, defensive programming: initialize with 0 (failure)
+	size_t position = (*offset == 0) ? HeaderSize() : *offset;	// position of the batch header
+	size_t body = 0;					// size of the column buffers of the header
+	unsigned int column = 0;			// Loop index over the columns
+
+	if((position <= size) && ((size - position) >= sizeof(view->header)))
+	{
+		memcpy(&view->header, image + position, sizeof(view->header));
+		position += sizeof(view->header);
+		for(column = 0; column < COLUMN_COUNT; column++)
+		{
+			view->column[column] = image + position + body;
+			body += AlignToColumn((size_t)view->header.row_count * COLUMNS[column].element_size);
+		}
+		if((view->header.magic == BATCH_MAGIC) && (view->header.column_count == COLUMN_COUNT)
+				&& (view->header.body_size == body) && ((size - position) >= body))
+		{
+			*offset = position + body;
+			batch_ok = 1;
+		}
+	}
+
+	return batch_ok;
+}
+
+
+
+// Definition of local (module level) functions
+
+/*---------------------------------------------------
+* Definition of function WriteColumn()
+* Parameters:
+*	writer: writer opened with ColumnExportOpen()
+*	data: values of the column
+*	size: size of the values in bytes
+* Return value:
+*	write_ok: unsigned integer, 1 if the values and the padding were written, 0 otherwise
+------------------------------------------------------*/
+static unsigned int WriteColumn(ColumnExport *writer, const void *data, size_t size) {
+
+	// Definition of local variables
+	size_t padding = AlignToColumn(size) - size;	// zero bytes up to the next buffer
+
+	return ((size == 0) || (fwrite(data, size, 1, writer->file) == 1))
+			&& ((padding == 0) || (fwrite(writer->zero, padding, 1, writer->file) == 1));
+}
+
+
+/*---------------------------------------------------
+* Definition of function AlignToColumn()
+* Parameters:
+*	size: size in bytes
+* Return value:
+*	aligned: size rounded up to the next multiple of COLUMN_EXPORT_ALIGNMENT
+------------------------------------------------------*/
+static size_t AlignToColumn(size_t size) {
+
+	return (size + COLUMN_EXPORT_ALIGNMENT - 1) & ~(size_t)(COLUMN_EXPORT_ALIGNMENT - 1);
+}
+
+
+/*---------------------------------------------------
+* Definition of function HeaderSize()
+* Parameters: none
+* Return value:
+*	size: size of the file header and the column descriptors in bytes
+------------------------------------------------------*/
+static size_t HeaderSize(void) {
+
+	return sizeof(ColumnFileHeader) + sizeof(COLUMNS);
+}
+
+
+// End of file columnExport.c
@@ -0,0 +1,136 @@
+/* ---------------------------------------------------------------------------------------------
+ * Module Name: Safe Temperature Monitoring
+ * File Name: columnExport.h
+ * Corresponding Source-File: columnExport.c
+ * Created on: 19.10.2026
+ * Development Group: CKN GmbH
+ * Project: FSQM SW Development Exercise
+ * Dependencies: channelStore.h, stdio.h (file operations), stdlib.h (memory is only allocated in ColumnExportOpen())
+ *
+ * Description: This file contains the function prototypes of the columnar export of the results.
+ * The implementation of the functions can be found in the corresponding source file columnExport.c
+ *
+ *  the export file is a columnar file, similar to the Arrow IPC format, which can be mapped into memory
+ *  and used without parsing (zero copy):
+ *  - file header (64 bytes) and one descriptor (32 bytes) per column (name, type, element size)
+ *  - any number of record batches: batch header (64 bytes) followed by one buffer per column;
+ *    every buffer starts at a multiple of 64 bytes, the values are stored in the byte order of the writer
+ *    (see byte_order in the file header)
+ *
+ *  the rows of a batch are the channels first_channel .. first_channel + row_count - 1 of the store:
+ *  readings and their average in centi-degree of the registered format of the channel (exact, as
+ *  ChannelStoreNativeCenti(); COLUMN_INVALID_CENTI: invalid), the registered format which gives the
+ *  unit of these values, the result of the scan and the findings of the sensor health monitoring;
+ *  the readings are converted from the scan arrays into preallocated buffers, all other columns are
+ *  copied directly from the arrays of the channel store (no formatting per row)
+ * ----------------------------------------------------------------------------------------------
+ * Versions:
+ *
+ * Version: 0.1 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * Initial version, definition of functions
+ *
+ * Version: 0.2 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * Readings and average exported in centi-degree of the registered format (file format version 2)
+ *
+ * ----------------------------------------------------------------------------------------------  */
+
+#ifndef COLUMNEXPORT_H_
+#define COLUMNEXPORT_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "channelStore.h"
+
+// Declaration of constants (enumeration constants, usable as array sizes)
+enum {
+	COLUMN_EXPORT_VERSION = 2,		// version of the file format, increased with every change of the schema
+	COLUMN_EXPORT_ALIGNMENT = 64	// alignment of headers and column buffers in bytes
+};
+
+// Columns of a record batch, in the order of the buffers
+enum {
+	COLUMN_SENSOR1 = 0,				// int32, reading of sensor 1 in centi-degree of the format
+	COLUMN_SENSOR2,					// int32, reading of sensor 2 in centi-degree of the format
+	COLUMN_AVERAGE,					// int32, average of both readings in centi-degree of the format (as in DisplayTemp())
+	COLUMN_FORMAT,					// uint8, registered format 'C' or 'F', unit of the temperature columns
+	COLUMN_RESULT,					// uint8, result 7, 3, 5 or 6
+	COLUMN_FINDINGS,				// uint8, findings of the sensor health monitoring (0 if not used)
+	COLUMN_COUNT					// number of columns
+};
+
+// Types of the columns
+enum {
+	COLUMN_TYPE_INT16 = 1,
+	COLUMN_TYPE_UINT8 = 2,
+	COLUMN_TYPE_INT32 = 3
+};
+
+// Marker of an invalid reading (or an average with an invalid reading) in the temperature columns
+enum {
+	COLUMN_INVALID_CENTI = INT32_MIN
+};
+
+// Declaration of types
+// Header of the file
+typedef struct {
+	char magic[8];					// "MTCOLUMN"
+	uint32_t version;				// COLUMN_EXPORT_VERSION
+	uint32_t byte_order;			// 0x01020304 in the byte order of the writer
+	uint32_t header_size;			// size of file header and column descriptors in bytes
+	uint32_t column_count;			// number of columns
+	uint32_t alignment;				// COLUMN_EXPORT_ALIGNMENT
+	uint32_t reserved[9];			// 0
+} ColumnFileHeader;
+
+// Descriptor of a column
+typedef struct {
+	char name[24];					// name of the column
+	uint32_t type;					// COLUMN_TYPE_*
+	uint32_t element_size;			// size of a value in bytes
+} ColumnDescriptor;
+
+// Header of a record batch
+typedef struct {
+	uint32_t magic;					// "BTCH"
+	uint32_t row_count;				// number of rows (channels)
+	uint32_t first_channel;			// index of the channel of the first row
+	uint32_t column_count;			// number of column buffers
+	uint64_t sequence;				// number of the scan
+	uint64_t timestamp_ns;			// time of the scan in ns
+	uint64_t body_size;				// size of all column buffers in bytes
+	uint64_t reserved[3];			// 0
+} ColumnBatchHeader;
+
+// Writer of an export file
+typedef struct {
+	FILE *file;						// export file
+	int32_t *sensor1;				// scratch buffer of the column of sensor 1
+	int32_t *sensor2;				// scratch buffer of the column of sensor 2
+	int32_t *average;				// scratch buffer of the average column
+	uint8_t *zero;					// zero filled buffer (findings if not used, padding)
+	unsigned int capacity;			// maximum number of rows of a batch
+	unsigned long batches;			// number of written batches
+	unsigned long long rows;		// number of written rows
+	unsigned int failures;			// number of failed writes
+	void *memory;					// memory block of the buffers
+} ColumnExport;
+
+// View of a record batch in a mapped file, the columns point into the file
+typedef struct {
+	ColumnBatchHeader header;		// header of the batch
+	const void *column[COLUMN_COUNT];	// buffers of the columns
+} ColumnBatchView;
+
+extern unsigned int ColumnExportOpen(ColumnExport *writer, const char *path, unsigned int capacity);
+extern unsigned int ColumnExportWriteBatch(ColumnExport *writer, const ChannelStore *store, const uint8_t *findings,
+		unsigned int first, unsigned int count, uint64_t sequence, uint64_t timestamp_ns);
+extern unsigned int ColumnExportClose(ColumnExport *writer);
+extern unsigned int ColumnExportCheckFile(const unsigned char *image, size_t size);
+extern unsigned int ColumnExportNextBatch(const unsigned char *image, size_t size, size_t *offset, ColumnBatchView *view);
+
+#endif /* COLUMNEXPORT_H_ */
@@ -0,0 +1,231 @@
+/* ---------------------------------------------------------------------------------------------
+* Module Name: Columnar Export Testing for ColumnExportWriteBatch()
+* File Name: columnexport_testing.c
+* Corresponding Header-File: columnexport_testing.h
+* Created on: 19.10.2026
+* Development Group: CKN GmbH
+* Project: FSQM SW Development Exercise (Columnar Export Testing Functions)
+* Dependencies: ColumnExportWriteBatch(), ColumnExportNextBatch(), stdio.h (hardware dependent),
+* 		write access to the working directory
+*
+* Description: This file contains the columnar export testing function
+*
+* PerformColumnExportTest() is a function, which exports two record batches of a channel store,
+* reads the file back and checks the column buffers of the batches, also for the exact round trip of
+* Fahrenheit readings
+*
+* ----------------------------------------------------------------------------------------------
+* Versions:
+* Version: 0.1 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* 2 columnar export tests were implemented
+*
+* Version: 0.2 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Fahrenheit round trip test added
+*
+* ----------------------------------------------------------------------------------------------*/
+// Include system header files
+#include <stdio.h> // stdio.h is necessary for printing/reading via standard IO
+#include <stdlib.h> // stdlib.h is necessary for malloc/free
+#include <string.h> // string.h is necessary for string operations
+// Include own header files
+#include "channelStore.h"
+#include "columnExport.h"
+// Definition of global constants (only if really necessary, see coding rules)
+// No globals
+// Definition of global variables (should be avoided, see coding rules)
+// No globals
+// Declaration of local functions
+static unsigned char *ReadExport(const char *path, size_t *size);
+// Definition of global and local functions (sorted by topic, if possible)
+
+/*---------------------------------------------------
+* Definition of function PerformColumnExportTest()
+* Parameters:
+* None
+* Return value:
+* test_complete: unsigned integer, 1 if all tests were succesful, 0 if one or more tests failed
+------------------------------------------------------*/
+unsigned int PerformColumnExportTest(void) {
+	// Definition of local variables
+	const char *path = "monitorTemp_export_test.bin"; // path of the export file
+	const uint8_t findings[3] = {0x00, 0x01, 0x10}; // findings of the sensor health monitoring
+	ColumnExport writer; // writer under test
+	ChannelStore store; // channel store with 3 channels: OK, alarm in Fahrenheit, no reading
+	ChannelStore fahrenheit; // channel store with 2 Fahrenheit channels
+	ColumnBatchView view[3]; // batches read back
+	unsigned int batches = 0; // number of batches read back
+	unsigned int channel = 0; // index of a registered channel
+	unsigned int write_ok = 0; // results of ColumnExportWriteBatch() and ColumnExportClose()
+	unsigned int file_ok = 0; // result of ColumnExportCheckFile()
+	unsigned char *image = 0; // export file in memory
+	size_t size = 0; // size of the export file
+	size_t offset = 0; // position of the next batch
+	const int32_t *sensor1 = 0; // column of sensor 1 of the Fahrenheit batch
+	const int32_t *sensor2 = 0; // column of sensor 2 of the Fahrenheit batch
+	const int32_t *average = 0; // average column of the first batch
+	const uint8_t *result = 0; // result column of the first batch
+	const uint8_t *format = 0; // format column of the second batch
+	const uint8_t *health = 0; // findings column of the second batch
+	char message[40]; // String array for test result message
+	unsigned int total_tests = 0; // Total number of tests
+	unsigned int successful_tests = 0; // Total number of successful test
+
+	unsigned int test_complete = 0; // 1 if all tests OK, 0 if one or more tests failed
+	// For printf() function, buffer setting (no buffering)
+	setvbuf(stdout, NULL, _IONBF, 0);
+
+	if ((ChannelStoreInit(&store, 3) == 0) || (ChannelStoreInit(&fahrenheit, 2) == 0)) {
+		printf("\n\nCXT: channel store could not be allocated\n");
+		ChannelStoreFree(&store);
+		return 0;
+	}
+	ChannelStoreRegister(&store, "OK", 'C', -10.0, 80.0, 3.0, &channel);
+	ChannelStoreSetReading(&store, channel, 55.1, 55.5);
+	ChannelStoreRegister(&store, "alarm", 'F', 32.0, 212.0, 9.0, &channel);
+	ChannelStoreSetReading(&store, channel, 230.0, 230.0);
+	ChannelStoreRegister(&store, "no reading", 'C', -10.0, 80.0, 3.0, &channel);
+	ChannelStoreScan(&store, 0, store.count);
+	// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+	// Columnar export tests (CXT)
+	// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+	// CXT1: Two batches are written and read back without copying
+	total_tests++;
+	printf("\n\nCXT1: Test with 2 batches of 3 and 2 channels, columns read back\n");
+	// Initialize test result message with negative test result, will only be changed if test is successful
+	strcpy(message, "CXT1 FAILED, Batches: \0");
+	if (ColumnExportOpen(&writer, path, 3) == 1) {
+		write_ok = ColumnExportWriteBatch(&writer, &store, 0, 0, 3, 1, 1000);
+		write_ok &= ColumnExportWriteBatch(&writer, &store, findings, 1, 5, 2, 2000);
+		write_ok &= ColumnExportClose(&writer);
+	}
+	image = ReadExport(path, &size);
+	if (image != 0) {
+		file_ok = ColumnExportCheckFile(image, size);
+		while ((file_ok == 1) && (batches < 3) && (ColumnExportNextBatch(image, size, &offset, &view[batches]) == 1)) {
+			batches++;
+		}
+	}
+	// Expected: 2 batches, average (in the registered format) and results of the first batch, format and findings of the second batch
+	if ((write_ok == 1) && (batches == 2) && (view[0].header.row_count == 3) && (view[1].header.row_count == 2)
+			&& (view[1].header.first_channel == 1) && (view[1].header.sequence == 2)) {
+		average = view[0].column[COLUMN_AVERAGE];
+		result = view[0].column[COLUMN_RESULT];
+		format = view[1].column[COLUMN_FORMAT];
+		health = view[1].column[COLUMN_FINDINGS];
+		if ((average[0] == 5530) && (average[1] == 23000) && (average[2] == COLUMN_INVALID_CENTI)
+				&& (result[0] == 7) && (result[1] == 3) && (result[2] == 5)
+				&& (format[0] == 'F') && (health[0] == 0x01) && (health[1] == 0x10)) {
+			strcpy(message, "CXT1 SUCCESFUL, Batches: \0");
+			successful_tests++;
+		}
+	}
+	// Print test result
+	printf("\n%s%d", message, batches);
+	// End of CXT1
+
+	// CXT2: A file with a different byte order or version is rejected
+	total_tests++;
+	printf("\n\nCXT2: Test with modified byte order mark, file rejected\n");
+	// Initialize test result message with negative test result, will only be changed if test is successful
+	strcpy(message, "CXT2 FAILED, Return value: \0");
+	file_ok = 1;
+	if (image != 0) {
+		image[offsetof(ColumnFileHeader, byte_order)] ^= 0xFF;
+		file_ok = ColumnExportCheckFile(image, size);
+	}
+	// Expected return value: 0
+	if (file_ok == 0) {
+		strcpy(message, "CXT2 SUCCESFUL, Return value: \0");
+		successful_tests++;
+	}
+	// Print test result
+	printf("\n%s%d", message, file_ok);
+	// End of CXT2
+
+	// CXT3: Fahrenheit readings are exported exactly in °F
+	total_tests++;
+	printf("\n\nCXT3: Test with readings 70.01/70.02° F and -40.01/-40.02° F, exported in centi-degree Fahrenheit\n");
+	// Initialize test result message with negative test result, will only be changed if test is successful
+	strcpy(message, "CXT3 FAILED, Average: \0");
+	free(image);
+	ChannelStoreRegister(&fahrenheit, "room", 'F', 32.0, 212.0, 9.0, &channel);
+	ChannelStoreSetReading(&fahrenheit, channel, 70.01, 70.02);
+	ChannelStoreRegister(&fahrenheit, "freezer", 'F', -60.0, 32.0, 9.0, &channel);
+	ChannelStoreSetReading(&fahrenheit, channel, -40.01, -40.02);
+	ChannelStoreScan(&fahrenheit, 0, fahrenheit.count);
+	write_ok = 0;
+	batches = 0;
+	offset = 0;
+	if (ColumnExportOpen(&writer, path, 2) == 1) {
+		write_ok = ColumnExportWriteBatch(&writer, &fahrenheit, 0, 0, 2, 3, 3000);
+		write_ok &= ColumnExportClose(&writer);
+	}
+	image = ReadExport(path, &size);
+	if ((image != 0) && (ColumnExportCheckFile(image, size) == 1)
+			&& (ColumnExportNextBatch(image, size, &offset, &view[0]) == 1)) {
+		batches = 1;
+	}
+	// Expected: the entered values in centi-degree Fahrenheit, average rounded half away from zero, format 'F'
+	if ((write_ok == 1) && (batches == 1) && (view[0].header.row_count == 2)) {
+		sensor1 = view[0].column[COLUMN_SENSOR1];
+		sensor2 = view[0].column[COLUMN_SENSOR2];
+		average = view[0].column[COLUMN_AVERAGE];
+		format = view[0].column[COLUMN_FORMAT];
+		result = view[0].column[COLUMN_RESULT];
+		if ((sensor1[0] == 7001) && (sensor2[0] == 7002) && (average[0] == 7002)
+				&& (sensor1[1] == -4001) && (sensor2[1] == -4002) && (average[1] == -4002)
+				&& (format[0] == 'F') && (format[1] == 'F') && (result[0] == 7) && (result[1] == 7)) {
+			strcpy(message, "CXT3 SUCCESFUL, Average: \0");
+			successful_tests++;
+		}
+	}
+	// Print test result
+	printf("\n%s%d", message, (average != 0) ? (int)average[0] : 0);
+	// End of CXT3
+
+	free(image);
+	remove(path);
+	ChannelStoreFree(&fahrenheit);
+	ChannelStoreFree(&store);
+
+	test_complete = (successful_tests == total_tests);
+
+	return test_complete;
+
+}
+
+
+/*---------------------------------------------------
+* Definition of function ReadExport()
+* Parameters:
+*	path: path of the export file
+*	size: size of the file in bytes
+* Return value:
+*	image: export file in memory (to be released with free()), 0 if the file could not be read
+------------------------------------------------------*/
+static unsigned char *ReadExport(const char *path, size_t *size) {
+	// Definition of local variables
+	FILE *file = fopen(path, "rb"); // export file for reading
+	long length = 0; // size of the export file
+	unsigned char *image = 0; // Return value
+
+	*size = 0;
+	if ((file != 0) && (fseek(file, 0, SEEK_END) == 0) && ((length = ftell(file)) > 0) && (fseek(file, 0, SEEK_SET) == 0)) {
+		image = malloc((size_t)length);
+		if ((image != 0) && (fread(image, 1, (size_t)length, file) == (size_t)length)) {
+			*size = (size_t)length;
+		} else {
+			free(image);
+			image = 0;
+		}
+	}
+	if (file != 0) {
+		fclose(file);
+	}
+
+	return image;
+}
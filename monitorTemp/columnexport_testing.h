@@ -0,0 +1,33 @@
+/* ---------------------------------------------------------------------------------------------
+ * Module Name: Safe Temperature Monitoring
+ * File Name: columnexport_testing.h
+ * Corresponding Source-File: columnexport_testing.c
+ * Created on: 19.10.2026
+ * Development Group: CKN GmbH
+ * Project: FSQM SW Development Exercise
+ * Dependencies: ColumnExportWriteBatch(), stdio.h (hardware dependent)
+ *
+ * Description: This file contains the test cases for the columnar export of the Safe Temperature Monitoring module
+ *
+
+ * ----------------------------------------------------------------------------------------------
+ * Versions:
+ *
+ * Version: 0.1 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * Initial version, definition of functions
+ *
+ * Version: 0.2 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * Fahrenheit round trip test added
+ *
+ * ----------------------------------------------------------------------------------------------  */
+
+#ifndef COLUMNEXPORT_TESTING_H_
+#define COLUMNEXPORT_TESTING_H_
+
+extern unsigned int PerformColumnExportTest(void);
+
+#endif /* COLUMNEXPORT_TESTING_H_ */
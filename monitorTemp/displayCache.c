@@ -0,0 +1,401 @@
+/* ---------------------------------------------------------------------------------------------
+* Module Name: Safe Temperature Monitoring
+* File Name: displayCache.c
+* Corresponding Header-File: displayCache.h
+* Created on: 19.10.2026
+* Development Group: CKN GmbH
+* Project: FSQM SW Development Exercise
+* Dependencies: channelStore.c, stdlib.h (memory is only allocated in DisplayCacheInit())
+*
+* Description: This file contains the functions of the cached display rendering.
+*
+*  displayCacheRender() compares the value of every channel at display precision (average of both
+*  readings in centi-degree of the registered format, computed with integers from the scan units of the
+*  channel store, which hold the readings of both formats exactly)
+*  and the result with the shown line; only changed lines are rendered into the frame buffer,
+*  unchanged channels cost one comparison
+*
+*  the text is formatted without printf(): the value is already a fixed point number (centi-degree),
+*  so formatting is an integer to text conversion into a fixed field, exact and independent of the locale;
+*  the value in the respective other format is converted from the shown value with integers, rounded
+*  half away from zero
+*
+*  displayCacheTakeDirty() returns the changed part of the frame buffer for the display driver
+*
+* ----------------------------------------------------------------------------------------------
+* Versions:
+* Version: 0.1 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Initial version, cached display rendering
+*
+* Version: 0.2 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Shared constants and helpers taken from monitorCommon.h
+*
+* Version: 0.3 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Values taken from the scan units of the channel store in the registered format
+*
+* Version: 0.4 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Value in the respective other format rendered as by DisplayTemp(), shown values initialized, deviation of the messages documented
+*
+* ----------------------------------------------------------------------------------------------*/
+
+// Include system header files
+#include <stdint.h> // stdint.h is necessary for the fixed size values
+#include <stdlib.h> // stdlib.h is necessary for malloc/free
+#include <string.h> // string.h is necessary for memset
+// Include own header files
+#include "channelStore.h"
+#include "monitorCommon.h"
+#include "displayCache.h"
+
+// Definition of local (module level) constants
+// Layout of a line: name, value and unit, value and unit in the other format, message and '\n'
+enum {
+	NAME_WIDTH = 24,				// name (at most 23 characters) and a space
+	VALUE_WIDTH = 10,				// value, right aligned, 2 decimal places
+	UNIT_WIDTH = 5,					// " °C " or " °F " (the degree sign has 2 bytes in UTF-8)
+	MESSAGE_WIDTH = DISPLAY_LINE_LENGTH - NAME_WIDTH - (2 * (VALUE_WIDTH + UNIT_WIDTH)) - 1
+};
+// 32 °F in centi-degree Fahrenheit, offset of the conversion between both formats
+static const int32_t FREEZING_CENTI_F = 3200;
+// Shown value of a channel without valid readings
+static const int32_t INVALID_TEMP = INT32_MIN;
+
+// Declaration of local (module level) functions
+static void RenderLine(char *line, const ChannelInfo *info, int32_t temp, unsigned int temp_ok);
+static void RenderTemp(char *field, int32_t temp, char format);
+static int32_t DivideRounded(int32_t numerator, int32_t divisor);
+static void FormatCenti(char *field, unsigned int width, int32_t centi);
+static void CopyField(char *field, unsigned int width, const char *text);
+
+
+// Function Definitions
+
+/*---------------------------------------------------
+* Definition of function DisplayCacheInit()
+* Parameters:
+*	cache: display to be initialized
+*	capacity: maximum number of channels, must be at least the capacity of the channel store
+* Return value:
+*	init_ok: unsigned integer, 1 if the memory could be allocated, 0 otherwise
+------------------------------------------------------*/
+unsigned int DisplayCacheInit(DisplayCache *cache, unsigned int capacity) {
+
+	// Definition of local variables
+	unsigned int init_ok = 0;			// Return value, defensive programming: initialize with 0 (failure)
+	size_t frame_size = AlignToCacheLine((size_t)capacity * DISPLAY_LINE_LENGTH);	// size of the frame buffer
+	size_t temp_size = AlignToCacheLine(capacity * sizeof(int32_t));	// size of the shown values
+	size_t ok_size = AlignToCacheLine(capacity * sizeof(uint8_t));		// size of the shown results
+	uintptr_t next = 0;					// start of the next array
+	unsigned int line = 0;				// Loop index
+
+	memset(cache, 0, sizeof(*cache));
+	cache->memory = malloc(frame_size + temp_size + ok_size + CACHE_LINE);
+
+	if(cache->memory != 0)
+	{
+		next = AlignToCacheLine((uintptr_t)cache->memory);
+		cache->frame = (char *)next;
+		next += frame_size;
+		cache->shown_temp = (int32_t *)next;
+		next += temp_size;
+		cache->shown_ok = (uint8_t *)next;
+
+		/*Empty lines; no line was rendered yet*/
+		memset(cache->frame, ' ', (size_t)capacity * DISPLAY_LINE_LENGTH);
+		for(line = 0; line < capacity; line++)
+		{
+			cache->frame[(line * DISPLAY_LINE_LENGTH) + DISPLAY_LINE_LENGTH - 1] = '\n';
+		}
+		cache->capacity = capacity;
+		DisplayCacheInvalidate(cache);
+		init_ok = 1;
+	}
+
+	return init_ok;
+}
+
+
+/*---------------------------------------------------
+* Definition of function DisplayCacheFree()
+* Parameters:
+*	cache: display initialized with DisplayCacheInit()
+* Return value: none
+------------------------------------------------------*/
+void DisplayCacheFree(DisplayCache *cache) {
+
+	free(cache->memory);
+	memset(cache, 0, sizeof(*cache));
+}
+
+
+/*---------------------------------------------------
+* Definition of function DisplayCacheRender()
+* Renders the lines of the channels first .. first + count - 1, whose value at display precision or
+* result has changed since they were rendered last; the results of the last scan are shown
+* Parameters:
+*	cache: display initialized with DisplayCacheInit()
+*	store: channel store, scanned with ChannelStoreScan()
+*	first: index of the first channel
+*	count: number of channels, limited to the registered channels
+* Return value:
+*	changed: number of rendered lines
+------------------------------------------------------*/
+unsigned int DisplayCacheRender(DisplayCache *cache, const ChannelStore *store, unsigned int first, unsigned int count) {
+
+	// Definition of local variables
+	unsigned int changed = 0;			// Return value, number of rendered lines
+	unsigned int end = first;			// channel after the last channel
+	unsigned int channel = 0;			// Loop index
+	int32_t sensor1 = 0;				// reading of sensor 1 in scan units
+	int32_t sensor2 = 0;				// reading of sensor 2 in scan units
+	int32_t sum = 0;					// sum of both readings in centi-degree of the registered format
+	int32_t temp = 0;					// value at display precision
+	unsigned int temp_ok = 0;			// result of the last scan
+
+	if(first < store->count)
+	{
+		end = ((store->count - first) < count) ? store->count : (first + count);
+	}
+	end = (end < cache->capacity) ? end : cache->capacity;
+
+	for(channel = first; channel < end; channel++)
+	{
+		/*Average as in DisplayTemp() of the readings in the registered format (exact in scan units),
+		  rounded half away from zero (see ColumnExportWriteBatch())*/
+		sensor1 = store->scan_sensor1[channel];
+		sensor2 = store->scan_sensor2[channel];
+		temp = INVALID_TEMP;
+		if((sensor1 != CHANNEL_INVALID_UNITS) && (sensor2 != CHANNEL_INVALID_UNITS))
+		{
+			sum = ChannelStoreNativeCenti(store, channel, sensor1) + ChannelStoreNativeCenti(store, channel, sensor2);
+			temp = (sum + (sum > 0) - (sum < 0)) / 2;
+		}
+		temp_ok = store->temp_ok[channel];
+
+		if((temp == cache->shown_temp[channel]) && (temp_ok == cache->shown_ok[channel]))
+		{
+			cache->unchanged++;
+		}
+		else
+		{
+			RenderLine(cache->frame + ((size_t)channel * DISPLAY_LINE_LENGTH), &store->info[channel], temp, temp_ok);
+			cache->shown_temp[channel] = temp;
+			cache->shown_ok[channel] = (uint8_t)temp_ok;
+			if(cache->dirty_first == cache->dirty_end)
+			{
+				cache->dirty_first = channel;
+				cache->dirty_end = channel + 1;
+			}
+			cache->dirty_first = (channel < cache->dirty_first) ? channel : cache->dirty_first;
+			cache->dirty_end = (channel >= cache->dirty_end) ? (channel + 1) : cache->dirty_end;
+			changed++;
+		}
+	}
+	cache->rendered += changed;
+
+	return changed;
+}
+
+
+/*---------------------------------------------------
+* Definition of function DisplayCacheTakeDirty()
+* Returns the lines, which were rendered since the last call, and starts a new dirty range
+* Parameters:
+*	cache: display initialized with DisplayCacheInit()
+*	size: returns the size of the changed part in bytes, 0 if no line was rendered
+* Return value:
+*	lines: first changed line in the frame buffer
+------------------------------------------------------*/
+const char *DisplayCacheTakeDirty(DisplayCache *cache, size_t *size) {
+
+	// Definition of local variables
+	const char *lines = cache->frame + ((size_t)cache->dirty_first * DISPLAY_LINE_LENGTH);	// Return value
+
+	*size = (size_t)(cache->dirty_end - cache->dirty_first) * DISPLAY_LINE_LENGTH;
+	cache->dirty_first = 0;
+	cache->dirty_end = 0;
+
+	return lines;
+}
+
+
+/*---------------------------------------------------
+* Definition of function DisplayCacheInvalidate()
+* All lines are rendered again by the next DisplayCacheRender() (e.g. after a reset of the display)
+* Parameters:
+*	cache: display initialized with DisplayCacheInit()
+* Return value: none
+------------------------------------------------------*/
+void DisplayCacheInvalidate(DisplayCache *cache) {
+
+	// Definition of local variables
+	unsigned int line = 0;				// Loop index
+
+	for(line = 0; line < cache->capacity; line++)
+	{
+		cache->shown_temp[line] = INVALID_TEMP;
+	}
+	memset(cache->shown_ok, 0, cache->capacity);
+}
+
+
+/*---------------------------------------------------
+* Definition of function RenderLine()
+* Parameters:
+*	line: line in the frame buffer, DISPLAY_LINE_LENGTH bytes
+*	info: name and format of the channel
+*	temp: value in centi-degree of the format, INVALID_TEMP if there are no valid readings
+*	temp_ok: result of the last scan
+* Return value: none
+------------------------------------------------------*/
+static void RenderLine(char *line, const ChannelInfo *info, int32_t temp, unsigned int temp_ok) {
+
+	// Definition of local variables
+	char *field = line + NAME_WIDTH;	// value and unit in the registered format
+	char *other = field + VALUE_WIDTH + UNIT_WIDTH;	// value and unit in the respective other format
+	char format = (info->format == 'F') ? 'F' : 'C';	// registered format
+	int32_t other_temp = INVALID_TEMP;	// value in centi-degree of the other format
+	const char *message = "---";		// message of the result
+
+	if(temp_ok == 7)
+	{
+		message = "Temperature range OK";
+	}
+	else if(temp_ok == 3)
+	{
+		message = "alarm";
+	}
+	else if(temp_ok == 5)
+	{
+		message = "Function error";
+	}
+	else if(temp_ok == 6)
+	{
+		message = "Sensor failure";
+	}
+
+	/*Conversion as CalcC2F() and CalcF2C(), of the shown value*/
+	if((temp != INVALID_TEMP) && (format == 'C'))
+	{
+		other_temp = DivideRounded(temp * 9, 5) + FREEZING_CENTI_F;
+	}
+	else if(temp != INVALID_TEMP)
+	{
+		other_temp = DivideRounded((temp - FREEZING_CENTI_F) * 5, 9);
+	}
+
+	CopyField(line, NAME_WIDTH - 1, info->name);
+	RenderTemp(field, temp, format);
+	RenderTemp(other, other_temp, (format == 'F') ? 'C' : 'F');
+	CopyField(other + VALUE_WIDTH + UNIT_WIDTH, MESSAGE_WIDTH, message);
+}
+
+
+/*---------------------------------------------------
+* Definition of function RenderTemp()
+* Parameters:
+*	field: value field followed by the unit field in the line, VALUE_WIDTH + UNIT_WIDTH bytes
+*	temp: value in centi-degree, INVALID_TEMP if there are no valid readings
+*	format: 'F' or 'C', unit of the value
+* Return value: none
+------------------------------------------------------*/
+static void RenderTemp(char *field, int32_t temp, char format) {
+
+	// Definition of local variables
+	char *unit = field + VALUE_WIDTH;	// unit field
+
+	if(temp == INVALID_TEMP)
+	{
+		CopyField(field, VALUE_WIDTH, "       ---");
+	}
+	else
+	{
+		FormatCenti(field, VALUE_WIDTH, temp);
+	}
+	unit[0] = ' ';
+	unit[1] = (char)0xC2;
+	unit[2] = (char)0xB0;
+	unit[3] = format;
+	unit[4] = ' ';
+}
+
+
+/*---------------------------------------------------
+* Definition of function DivideRounded()
+* Parameters:
+*	numerator: dividend
+*	divisor: divisor, greater than 0
+* Return value:
+*	quotient: numerator / divisor, rounded half away from zero
+------------------------------------------------------*/
+static int32_t DivideRounded(int32_t numerator, int32_t divisor) {
+
+	return ((2 * numerator) + (((numerator > 0) - (numerator < 0)) * divisor)) / (2 * divisor);
+}
+
+
+/*---------------------------------------------------
+* Definition of function FormatCenti()
+* Replaces printf("%.2f"): writes a centi-degree value right aligned with 2 decimal places
+* Parameters:
+*	field: field in the line, filled completely
+*	width: width of the field, must be sufficient for the value (10 for every 32 bit value below 1e7)
+*	centi: value in centi-degree
+* Return value: none
+------------------------------------------------------*/
+static void FormatCenti(char *field, unsigned int width, int32_t centi) {
+
+	// Definition of local variables
+	uint32_t magnitude = (centi < 0) ? (0u - (uint32_t)centi) : (uint32_t)centi;	// magnitude of the value
+	unsigned int position = width;		// position of the next character, written from the end
+	unsigned int places = 0;			// number of written digits
+
+	/*2 decimal places, the decimal point and at least one digit before it*/
+	while((position > 1) && ((places < 3) || (magnitude != 0)))
+	{
+		if(places == 2)
+		{
+			position--;
+			field[position] = '.';
+		}
+		position--;
+		field[position] = (char)('0' + (magnitude % 10));
+		magnitude /= 10;
+		places++;
+	}
+	if((centi < 0) && (position > 0))
+	{
+		position--;
+		field[position] = '-';
+	}
+	memset(field, ' ', position);
+}
+
+
+/*---------------------------------------------------
+* Definition of function CopyField()
+* Parameters:
+*	field: field in the line
+*	width: width of the field, filled completely (text truncated or padded with spaces)
+*	text: text terminated with '\0'
+* Return value: none
+------------------------------------------------------*/
+static void CopyField(char *field, unsigned int width, const char *text) {
+
+	// Definition of local variables
+	unsigned int position = 0;			// Loop index
+
+	for(position = 0; (position < width) && (text[position] != '\0'); position++)
+	{
+		field[position] = text[position];
+	}
+	memset(field + position, ' ', width - position);
+}
@@ -0,0 +1,70 @@
+/* ---------------------------------------------------------------------------------------------
+ * Module Name: Safe Temperature Monitoring
+ * File Name: displayCache.h
+ * Corresponding Source-File: displayCache.c
+ * Created on: 19.10.2026
+ * Development Group: CKN GmbH
+ * Project: FSQM SW Development Exercise
+ * Dependencies: channelStore.h, stdlib.h (memory is only allocated in DisplayCacheInit())
+ *
+ * Description: This file contains the function prototypes of the cached display rendering of a channel store.
+ * The implementation of the functions can be found in the corresponding source file displayCache.c
+ *
+ *  the display is a preallocated frame buffer with one line of DISPLAY_LINE_LENGTH bytes per channel:
+ *  name, average of both readings in the registered format and in the respective other format (as
+ *  printed by DisplayTemp()) with 2 decimal places and unit, and the message of the result;
+ *  a line is only rendered again, if the shown value (at display precision) or the result has changed,
+ *  the changed lines are collected in a dirty range, so that only this part has to be sent to the display
+ *
+ *  deviation from DisplayTemp(): the message follows the documented meaning of the results (7 "Temperature
+ *  range OK", 3 "alarm", 5 "Function error", 6 "Sensor failure"); DisplayTemp() shows "Temperature range OK"
+ *  for 3 and "alarm" for 7, this mapping is not taken over; the other format is converted from the shown
+ *  average at display precision, so it can differ in the last place from the float conversion of DisplayTemp()
+ * ----------------------------------------------------------------------------------------------
+ * Versions:
+ *
+ * Version: 0.1 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * Initial version, definition of functions
+ *
+ * Version: 0.2 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * Value in the respective other format rendered as by DisplayTemp(), shown values initialized, deviation of the messages documented
+ *
+ * ----------------------------------------------------------------------------------------------  */
+
+#ifndef DISPLAYCACHE_H_
+#define DISPLAYCACHE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include "channelStore.h"
+
+// Declaration of constants (enumeration constants, usable as array sizes)
+enum {
+	DISPLAY_LINE_LENGTH = 80		// bytes of a line in the frame buffer, including '\n'
+};
+
+// Declaration of types
+// Display of the channels of a store; element i of every array belongs to channel i
+typedef struct {
+	char *frame;					// frame buffer, capacity lines of DISPLAY_LINE_LENGTH bytes
+	int32_t *shown_temp;			// shown average in centi-degree of the registered format, INT32_MIN if invalid or never shown
+	uint8_t *shown_ok;				// shown result, 0 if the line was never rendered
+	unsigned int capacity;			// maximum number of channels
+	unsigned int dirty_first;		// first changed line since DisplayCacheTakeDirty()
+	unsigned int dirty_end;			// line after the last changed line, dirty_first if nothing changed
+	unsigned long long rendered;	// number of rendered lines
+	unsigned long long unchanged;	// number of lines which were not rendered again
+	void *memory;					// memory block of all arrays
+} DisplayCache;
+
+extern unsigned int DisplayCacheInit(DisplayCache *cache, unsigned int capacity);
+extern void DisplayCacheFree(DisplayCache *cache);
+extern unsigned int DisplayCacheRender(DisplayCache *cache, const ChannelStore *store, unsigned int first, unsigned int count);
+extern const char *DisplayCacheTakeDirty(DisplayCache *cache, size_t *size);
+extern void DisplayCacheInvalidate(DisplayCache *cache);
+
+#endif /* DISPLAYCACHE_H_ */
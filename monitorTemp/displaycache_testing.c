@@ -0,0 +1,201 @@
+/* ---------------------------------------------------------------------------------------------
+* Module Name: Display Cache Testing for DisplayCacheRender()
+* File Name: displaycache_testing.c
+* Corresponding Header-File: displaycache_testing.h
+* Created on: 19.10.2026
+* Development Group: CKN GmbH
+* Project: FSQM SW Development Exercise (Display Cache Testing Functions)
+* Dependencies: DisplayCacheRender(), DisplayCacheTakeDirty(), stdio.h (hardware dependent)
+*
+* Description: This file contains the display cache testing function
+*
+* PerformDisplayCacheTest() is a function, which renders a channel store, changes the readings
+* below and above the display precision and checks the rendered lines and the dirty range
+*
+* ----------------------------------------------------------------------------------------------
+* Versions:
+* Version: 0.1 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* 3 display cache tests were implemented
+*
+* Version: 0.2 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Test of a Fahrenheit value at the precision of the reading was implemented
+*
+* Version: 0.3 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Lines with the other format, test of the initial and invalidated shown values
+*
+* ----------------------------------------------------------------------------------------------*/
+// Include system header files
+#include <stdio.h> // stdio.h is necessary for printing/reading via standard IO
+#include <string.h> // string.h is necessary for string operations
+// Include own header files
+#include "channelStore.h"
+#include "displayCache.h"
+// Definition of global constants (only if really necessary, see coding rules)
+// No globals
+// Definition of global variables (should be avoided, see coding rules)
+// No globals
+// Definition of global and local functions (sorted by topic, if possible)
+
+/*---------------------------------------------------
+* Definition of function PerformDisplayCacheTest()
+* Parameters:
+* None
+* Return value:
+* test_complete: unsigned integer, 1 if all tests were succesful, 0 if one or more tests failed
+------------------------------------------------------*/
+unsigned int PerformDisplayCacheTest(void) {
+	// Definition of local variables
+	// Expected lines of the channels (DISPLAY_LINE_LENGTH bytes each)
+	const char *expected_ok = "OK                           55.30 \xC2\xB0" "C     131.54 \xC2\xB0" "F Temperature range OK     \n";
+	const char *expected_alarm = "alarm                       230.00 \xC2\xB0" "F     110.00 \xC2\xB0" "C alarm                    \n";
+	const char *expected_none = "no reading                     --- \xC2\xB0" "C        --- \xC2\xB0" "F Function error           \n";
+	DisplayCache cache; // display under test
+	DisplayCache fresh; // display which was never rendered
+	unsigned int line = 0; // index of a line
+	unsigned int not_shown = 0; // number of lines without shown value
+	ChannelStore store; // channel store with 3 channels: OK, alarm in Fahrenheit, no reading
+	unsigned int channel = 0; // index of a registered channel
+	unsigned int changed = 0; // result of DisplayCacheRender()
+	const char *lines = 0; // changed lines of DisplayCacheTakeDirty()
+	size_t size = 0; // size of the changed lines
+	char message[40]; // String array for test result message
+	unsigned int total_tests = 0; // Total number of tests
+	unsigned int successful_tests = 0; // Total number of successful test
+
+	unsigned int test_complete = 0; // 1 if all tests OK, 0 if one or more tests failed
+	// For printf() function, buffer setting (no buffering)
+	setvbuf(stdout, NULL, _IONBF, 0);
+
+	if (ChannelStoreInit(&store, 3) == 0) {
+		printf("\n\nDPT: channel store could not be allocated\n");
+		return 0;
+	}
+	if (DisplayCacheInit(&cache, 3) == 0) {
+		printf("\n\nDPT: display could not be allocated\n");
+		ChannelStoreFree(&store);
+		return 0;
+	}
+	ChannelStoreRegister(&store, "OK", 'C', -10.0, 80.0, 3.0, &channel);
+	ChannelStoreSetReading(&store, channel, 55.1, 55.5);
+	ChannelStoreRegister(&store, "alarm", 'F', 32.0, 212.0, 9.0, &channel);
+	ChannelStoreSetReading(&store, channel, 230.0, 230.0);
+	ChannelStoreRegister(&store, "no reading", 'C', -10.0, 80.0, 3.0, &channel);
+	ChannelStoreScan(&store, 0, store.count);
+	// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+	// Display cache tests (DPT)
+	// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+	// DPT1: First rendering, all lines are rendered
+	total_tests++;
+	printf("\n\nDPT1: Test with 3 channels (OK, alarm in Fahrenheit, no reading), first rendering\n");
+	// Initialize test result message with negative test result, will only be changed if test is successful
+	strcpy(message, "DPT1 FAILED, Rendered lines: \0");
+	changed = DisplayCacheRender(&cache, &store, 0, store.count);
+	lines = DisplayCacheTakeDirty(&cache, &size);
+	// Expected: 3 rendered lines, the whole frame is dirty
+	if ((changed == 3) && (lines == cache.frame) && (size == (3 * DISPLAY_LINE_LENGTH))
+			&& (memcmp(lines, expected_ok, DISPLAY_LINE_LENGTH) == 0)
+			&& (memcmp(lines + DISPLAY_LINE_LENGTH, expected_alarm, DISPLAY_LINE_LENGTH) == 0)
+			&& (memcmp(lines + (2 * DISPLAY_LINE_LENGTH), expected_none, DISPLAY_LINE_LENGTH) == 0)) {
+		strcpy(message, "DPT1 SUCCESFUL, Rendered lines: \0");
+		successful_tests++;
+	}
+	// Print test result
+	printf("\n%s%d", message, changed);
+	// End of DPT1
+
+	// DPT2: Changed readings with the same average at display precision are not rendered again
+	total_tests++;
+	printf("\n\nDPT2: Test with readings 55.11 / 55.49 instead of 55.1 / 55.5 (average 55.30), no rendering\n");
+	// Initialize test result message with negative test result, will only be changed if test is successful
+	strcpy(message, "DPT2 FAILED, Rendered lines: \0");
+	ChannelStoreSetReading(&store, 0, 55.11, 55.49);
+	ChannelStoreScan(&store, 0, store.count);
+	changed = DisplayCacheRender(&cache, &store, 0, store.count);
+	DisplayCacheTakeDirty(&cache, &size);
+	// Expected: no rendered line, nothing dirty
+	if ((changed == 0) && (size == 0) && (cache.unchanged == 3)) {
+		strcpy(message, "DPT2 SUCCESFUL, Rendered lines: \0");
+		successful_tests++;
+	}
+	// Print test result
+	printf("\n%s%d", message, changed);
+	// End of DPT2
+
+	// DPT3: A changed value is rendered again, only its line is dirty
+	total_tests++;
+	printf("\n\nDPT3: Test with changed reading of the Fahrenheit channel, 1 line rendered\n");
+	// Initialize test result message with negative test result, will only be changed if test is successful
+	strcpy(message, "DPT3 FAILED, Rendered lines: \0");
+	ChannelStoreSetReading(&store, 1, 104.0, 104.0);
+	ChannelStoreScan(&store, 0, store.count);
+	changed = DisplayCacheRender(&cache, &store, 0, store.count);
+	lines = DisplayCacheTakeDirty(&cache, &size);
+	// Expected: 1 rendered line (104.00 °F = 40.00 °C, range OK), the dirty range is the second line
+	if ((changed == 1) && (lines == (cache.frame + DISPLAY_LINE_LENGTH)) && (size == DISPLAY_LINE_LENGTH)
+			&& (memcmp(lines + 24, "    104.00 \xC2\xB0" "F      40.00 \xC2\xB0" "C Temperature range OK", 50) == 0)) {
+		strcpy(message, "DPT3 SUCCESFUL, Rendered lines: \0");
+		successful_tests++;
+	}
+	// Print test result
+	printf("\n%s%d", message, changed);
+	// End of DPT3
+
+	// DPT4: A Fahrenheit value is shown with the precision of the reading (100.01 °F is 37.78 °C, i.e. 100.00 °F)
+	total_tests++;
+	printf("\n\nDPT4: Test with readings 100.01 / 100.01 of the Fahrenheit channel, shown as 100.01\n");
+	// Initialize test result message with negative test result, will only be changed if test is successful
+	strcpy(message, "DPT4 FAILED, Rendered lines: \0");
+	ChannelStoreSetReading(&store, 1, 100.01, 100.01);
+	ChannelStoreScan(&store, 0, store.count);
+	changed = DisplayCacheRender(&cache, &store, 0, store.count);
+	lines = DisplayCacheTakeDirty(&cache, &size);
+	// Expected: 1 rendered line with the values as printed by DisplayTemp() (37.783333 °C)
+	if ((changed == 1) && (lines == (cache.frame + DISPLAY_LINE_LENGTH)) && (size == DISPLAY_LINE_LENGTH)
+			&& (memcmp(lines + 24, "    100.01 \xC2\xB0" "F      37.78 \xC2\xB0" "C Temperature range OK", 50) == 0)) {
+		strcpy(message, "DPT4 SUCCESFUL, Rendered lines: \0");
+		successful_tests++;
+	}
+	// Print test result
+	printf("\n%s%d", message, changed);
+	// End of DPT4
+
+	// DPT5: No value is shown after DisplayCacheInit() and DisplayCacheInvalidate(), all lines are rendered again
+	total_tests++;
+	printf("\n\nDPT5: Test with a new display and an invalidated display, no shown values, 3 lines rendered\n");
+	// Initialize test result message with negative test result, will only be changed if test is successful
+	strcpy(message, "DPT5 FAILED, Rendered lines: \0");
+	if (DisplayCacheInit(&fresh, 3) == 1) {
+		for (line = 0; line < 3; line++) {
+			not_shown += (fresh.shown_temp[line] == INT32_MIN) && (fresh.shown_ok[line] == 0);
+		}
+		DisplayCacheFree(&fresh);
+	}
+	DisplayCacheInvalidate(&cache);
+	for (line = 0; line < 3; line++) {
+		not_shown += (cache.shown_temp[line] == INT32_MIN) && (cache.shown_ok[line] == 0);
+	}
+	changed = DisplayCacheRender(&cache, &store, 0, store.count);
+	DisplayCacheTakeDirty(&cache, &size);
+	// Expected: 6 lines without shown value, 3 rendered lines
+	if ((not_shown == 6) && (changed == 3) && (size == (3 * DISPLAY_LINE_LENGTH))) {
+		strcpy(message, "DPT5 SUCCESFUL, Rendered lines: \0");
+		successful_tests++;
+	}
+	// Print test result
+	printf("\n%s%d", message, changed);
+	// End of DPT5
+
+	DisplayCacheFree(&cache);
+	ChannelStoreFree(&store);
+
+	test_complete = (successful_tests == total_tests);
+
+	return test_complete;
+
+}
@@ -0,0 +1,33 @@
+/* ---------------------------------------------------------------------------------------------
+ * Module Name: Safe Temperature Monitoring
+ * File Name: displaycache_testing.h
+ * Corresponding Source-File: displaycache_testing.c
+ * Created on: 19.10.2026
+ * Development Group: CKN GmbH
+ * Project: FSQM SW Development Exercise
+ * Dependencies: DisplayCacheRender(), stdio.h (hardware dependent)
+ *
+ * Description: This file contains the test cases for the cached display rendering of the Safe Temperature Monitoring module
+ *
+
+ * ----------------------------------------------------------------------------------------------
+ * Versions:
+ *
+ * Version: 0.1 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * Initial version, definition of functions
+ *
+ * Version: 0.2 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * Lines with the other format, test of the initial and invalidated shown values
+ *
+ * ----------------------------------------------------------------------------------------------  */
+
+#ifndef DISPLAYCACHE_TESTING_H_
+#define DISPLAYCACHE_TESTING_H_
+
+extern unsigned int PerformDisplayCacheTest(void);
+
+#endif /* DISPLAYCACHE_TESTING_H_ */
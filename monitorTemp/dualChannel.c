@@ -0,0 +1,432 @@
+/* ---------------------------------------------------------------------------------------------
+* Module Name: Safe Temperature Monitoring
+* File Name: dualChannel.c
+* Corresponding Header-File: dualChannel.h
+* Created on: 19.10.2026
+* Development Group: CKN GmbH
+* Project: FSQM SW Development Exercise
+* Dependencies: monitorTemp.c, monitorCommon.c, POSIX threads (link with -pthread),
+* 		pinning of the channels to cores is only available on Linux (hardware dependent)
+*
+* Description: This file contains the functions for the diverse redundant (dual channel)
+* evaluation of a batch of channels.
+*
+*  channel A evaluates every channel with ValidateTempBatch() (floating point, see monitorTemp.c)
+*
+*  channel B evaluates every channel with EvaluateTempFixed(), which is a diverse implementation:
+*  all temperatures are converted to integer centi-degree, the checks are carried out with integer
+*  arithmetic and combined without an if/else chain
+*
+*  the results of both channels are cross-compared at the end of each batch; the result of a
+*  channel is only accepted if both channels agree, otherwise it is forced to 5 (function failure)
+*
+*  NOTE: limits with a finer resolution than 0.01 degree are rounded by channel B, i.e. both channels
+*  may disagree directly at such a limit; this is reported as 5 (fail safe)
+*
+* ----------------------------------------------------------------------------------------------
+* Versions:
+* Version: 0.1 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Initial version, dual channel evaluation with cross-comparison
+*
+* Version: 0.2 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Channel A uses the branch free ValidateTempBatch()
+*
+* Version: 0.3 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Shared constants and helpers taken from monitorCommon.h
+*
+* Version: 0.4 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Cleanup of a failed initialization joins the started thread and destroys the primitives, _GNU_SOURCE guarded
+*
+* ----------------------------------------------------------------------------------------------*/
+
+// pthread_setaffinity_np() is a GNU extension, it is only used on Linux
+#if defined(__linux__)
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include <sched.h>
+#endif
+
+// Include system header files
+#include <pthread.h> // pthread.h is necessary for the evaluation threads
+// Include own header files
+#include "dualChannel.h"
+#include "monitorCommon.h"
+
+// Definition of local (module level) constants
+// Absolute temperatures in centi-degree: see monitorCommon.h
+
+// Declaration of local (module level) functions
+static void *DualChannelThread(void *argument);
+static void PinToCore(int core);
+
+
+// Function Definitions
+
+/*---------------------------------------------------
+* Definition of function DualChannelInit()
+* Parameters:
+*	dual: context of the dual channel evaluation
+*	core_a: core for channel A, negative for no pinning
+*	core_b: core for channel B, negative for no pinning
+* Return value:
+*	init_ok: unsigned integer, 1 if both threads were started, 0 otherwise (nothing is left to be released)
+------------------------------------------------------*/
+unsigned int DualChannelInit(DualChannel *dual, int core_a, int core_b) {
+
+	// Definition of local variables
+	unsigned int init_ok = 0;			// Return value, defensive programming: initialize with 0 (failure)
+	unsigned int channel = 0;			// Loop index over both channels
+	unsigned int started = 0;			// Number of started threads
+	unsigned int running[2] = {0, 0};	// 1 for every started thread
+	unsigned int primitives = 0;		// Number of created primitives (lock, start, done)
+
+	dual->batch = 0;
+	dual->result[0] = 0;
+	dual->result[1] = 0;
+	dual->generation = 0;
+	dual->finished = 0;
+	dual->shutdown = 0;
+	dual->worker[0].core = core_a;
+	dual->worker[1].core = core_b;
+
+	primitives = (pthread_mutex_init(&dual->lock, 0) == 0);
+	primitives += (primitives == 1) && (pthread_cond_init(&dual->start, 0) == 0);
+	primitives += (primitives == 2) && (pthread_cond_init(&dual->done, 0) == 0);
+
+	if(primitives == 3)
+	{
+		for(channel = 0; channel < 2; channel++)
+		{
+			dual->worker[channel].dual = dual;
+			dual->worker[channel].channel = channel;
+			running[channel] = (pthread_create(&dual->thread[channel], 0, DualChannelThread, &dual->worker[channel]) == 0);
+			started += running[channel];
+		}
+		init_ok = (started == 2);
+
+		if(init_ok == 0)
+		{
+			/*Stop the thread which might have been started (channel A or B)*/
+			pthread_mutex_lock(&dual->lock);
+			dual->shutdown = 1;
+			pthread_cond_broadcast(&dual->start);
+			pthread_mutex_unlock(&dual->lock);
+			for(channel = 0; channel < 2; channel++)
+			{
+				if(running[channel] == 1)
+				{
+					pthread_join(dual->thread[channel], 0);
+				}
+			}
+		}
+	}
+
+	/*DualChannelShutdown() is only called after a successful initialization, so the primitives are destroyed here*/
+	if(init_ok == 0)
+	{
+		if(primitives >= 3)
+		{
+			pthread_cond_destroy(&dual->done);
+		}
+		if(primitives >= 2)
+		{
+			pthread_cond_destroy(&dual->start);
+		}
+		if(primitives >= 1)
+		{
+			pthread_mutex_destroy(&dual->lock);
+		}
+	}
+
+	return init_ok;
+}
+
+
+/*---------------------------------------------------
+* Definition of function DualChannelShutdown()
+* Parameters:
+*	dual: context of the dual channel evaluation, initialized with DualChannelInit()
+* Return value: none
+------------------------------------------------------*/
+void DualChannelShutdown(DualChannel *dual) {
+
+	pthread_mutex_lock(&dual->lock);
+	dual->shutdown = 1;
+	pthread_cond_broadcast(&dual->start);
+	pthread_mutex_unlock(&dual->lock);
+
+	pthread_join(dual->thread[0], 0);
+	pthread_join(dual->thread[1], 0);
+
+	pthread_cond_destroy(&dual->done);
+	pthread_cond_destroy(&dual->start);
+	pthread_mutex_destroy(&dual->lock);
+}
+
+
+/*---------------------------------------------------
+* Definition of function MonitorTempDualChannel()
+* Parameters:
+*	dual: context of the dual channel evaluation, initialized with DualChannelInit()
+*	batch: channels to be evaluated, shared by both channels
+*	temp_ok: result per channel (batch->count elements), 7, 3 or 5 as for MonitorTemp(),
+*		5 if the channels do not agree
+*	result_a: scratch array for the results of channel A (batch->count elements)
+*	result_b: scratch array for the results of channel B (batch->count elements)
+* Return value:
+*	mismatches: unsigned integer, number of channels for which channel A and B do not agree
+------------------------------------------------------*/
+unsigned int MonitorTempDualChannel(DualChannel *dual, const TempBatch *batch, unsigned int *temp_ok,
+		unsigned int *result_a, unsigned int *result_b) {
+
+	// Definition of local variables
+	unsigned int mismatches = 0;		// Return value: number of channels with different results
+
+	/*Hand the batch over to both channels*/
+	pthread_mutex_lock(&dual->lock);
+	dual->batch = batch;
+	dual->result[0] = result_a;
+	dual->result[1] = result_b;
+	dual->finished = 0;
+	dual->generation++;
+	pthread_cond_broadcast(&dual->start);
+
+	/*Wait until both channels have finished*/
+	while(dual->finished < 2)
+	{
+		pthread_cond_wait(&dual->done, &dual->lock);
+	}
+	pthread_mutex_unlock(&dual->lock);
+
+	/*Cross-comparison of both channels*/
+	mismatches = CompareDualChannel(result_a, result_b, temp_ok, batch->count);
+
+	return mismatches;
+}
+
+
+/*---------------------------------------------------
+* Definition of function CompareDualChannel()
+* The loop does not contain any branch, so that the compiler can vectorize it
+* Parameters:
+*	result_a: results of channel A
+*	result_b: results of channel B
+*	temp_ok: combined result, result of channel A if both channels agree, 5 otherwise
+*	count: number of elements of all arrays
+* Return value:
+*	mismatches: unsigned integer, number of channels for which channel A and B do not agree
+------------------------------------------------------*/
+unsigned int CompareDualChannel(const unsigned int *result_a, const unsigned int *result_b,
+		unsigned int *temp_ok, unsigned int count) {
+
+	// Definition of local variables
+	unsigned int mismatches = 0;		// Return value: number of channels with different results
+	unsigned int index = 0;				// Loop index
+	unsigned int differ = 0;			// 1 if the channels do not agree
+	unsigned int mask = 0;				// all bits set if the channels do not agree
+
+	for(index = 0; index < count; index++)
+	{
+		differ = (result_a[index] != result_b[index]);
+		mask = 0u - differ;
+		temp_ok[index] = (result_a[index] & ~mask) | (5u & mask);
+		mismatches += differ;
+	}
+
+	return mismatches;
+}
+
+
+/*---------------------------------------------------
+* Definition of function EvaluateTempFixed()
+* Diverse implementation of EvaluateTemp() (channel B), all checks are carried out in centi-degree
+* Parameters:
+*	format: char 'F' or 'C'
+*	min_temp: minimum allowed temperature as float
+*	max_temp: maximum allowed temperature as float
+*	max_deltatemp: maximum allowed delta temperature between sensor 1 and sensor 2 as float
+*	temp_sensor1: actual measured temperature of sensor 1 as float
+*	temp_sensor2: actual measured temperature of sensor 2 as float
+* Return value:
+*	temp_ok: unsigned integer, 7 for temperature range OK, 5 for function failure (i.e. invalid values or sensor failure),
+* 		3 for "out of temperature range", alarm
+------------------------------------------------------*/
+unsigned int EvaluateTempFixed(char format, float min_temp, float max_temp, float max_deltatemp,
+		float temp_sensor1, float temp_sensor2) {
+
+	// Definition of local variables
+	unsigned int temp_ok = 5;			// Return value, defensive programming: initialize with value 5 (failure)
+	unsigned int valid = 0;				// 1 if all parameters are plausible
+	long abs_min = 0;					// absolute minimum temperature of the format in centi-degree
+	long abs_max = 0;					// absolute maximum temperature of the format in centi-degree
+	long min_c = 0;						// min_temp in centi-degree
+	long max_c = 0;						// max_temp in centi-degree
+	long delta_c = 0;					// max_deltatemp in centi-degree
+	long sensor1_c = 0;					// temp_sensor1 in centi-degree
+	long sensor2_c = 0;					// temp_sensor2 in centi-degree
+
+	/*Absolute limits of the format, an invalid format leaves valid at 0*/
+	if((format == 'C') || (format == 'c'))
+	{
+		abs_min = ABS_MINTEMP_C_CENTI;
+		abs_max = ABS_MAXTEMP_C_CENTI;
+		valid = 1;
+	}
+	else if((format == 'F') || (format == 'f'))
+	{
+		abs_min = ABS_MINTEMP_F_CENTI;
+		abs_max = ABS_MAXTEMP_F_CENTI;
+		valid = 1;
+	}
+
+	/*All conversions are carried out, the results are combined afterwards*/
+	valid &= ToCentiDegree(min_temp, &min_c);
+	valid &= ToCentiDegree(max_temp, &max_c);
+	valid &= ToCentiDegree(max_deltatemp, &delta_c);
+	valid &= ToCentiDegree(temp_sensor1, &sensor1_c);
+	valid &= ToCentiDegree(temp_sensor2, &sensor2_c);
+
+	/*Plausibility check of all parameters*/
+	valid &= (min_c >= abs_min) & (max_c <= abs_max) & (min_c <= max_c) & (delta_c <= (max_c - min_c));
+	valid &= (sensor1_c >= abs_min) & (sensor1_c <= abs_max);
+	valid &= (sensor2_c >= abs_min) & (sensor2_c <= abs_max);
+
+	if(valid == 1)
+	{
+		temp_ok = CheckTempFixed(min_c, max_c, delta_c, sensor1_c, sensor2_c);
+	}
+
+	return temp_ok;
+}
+
+
+/*---------------------------------------------------
+* Definition of function CheckTempFixed()
+* Diverse implementation of CheckTemp() (channel B)
+* Parameters:
+*	min_temp: minimum allowed temperature in centi-degree
+*	max_temp: maximum allowed temperature in centi-degree
+*	max_deltatemp: maximum allowed delta temperature between sensor 1 and sensor 2 in centi-degree
+*	temp_sensor1: actual measured temperature of sensor 1 in centi-degree
+*	temp_sensor2: actual measured temperature of sensor 2 in centi-degree
+* Return value:
+*	temp_ok: unsigned integer, 7 for temperature range OK, 3 for "out of temperature range", alarm
+------------------------------------------------------*/
+unsigned int CheckTempFixed(long min_temp, long max_temp, long max_deltatemp, long temp_sensor1, long temp_sensor2) {
+
+	// Definition of local variables
+	unsigned int alarm = 0;				// 1 if one of the checks fails
+	long whole1 = 0;					// magnitude of sensor 1 in whole degrees
+	long whole2 = 0;					// magnitude of sensor 2 in whole degrees
+
+	/*CheckTemp() compares the magnitudes in whole degrees (truncated), the same is done here*/
+	whole1 = temp_sensor1 / 100;
+	whole2 = temp_sensor2 / 100;
+	whole1 = (whole1 < 0) ? -whole1 : whole1;
+	whole2 = (whole2 < 0) ? -whole2 : whole2;
+
+	alarm = (((whole1 - whole2) * 100) > max_deltatemp);
+	alarm |= (temp_sensor1 < min_temp) | (temp_sensor2 < min_temp);
+	alarm |= (temp_sensor1 > max_temp) | (temp_sensor2 > max_temp);
+
+	return 7u - (4u * alarm);
+}
+
+
+
+// Definition of local (module level) functions
+
+/*---------------------------------------------------
+* Definition of function DualChannelThread()
+* Evaluation thread of one channel, waits for batches until DualChannelShutdown() is called
+* Parameters:
+*	argument: DualChannelWorker of the thread
+* Return value: none (0)
+------------------------------------------------------*/
+static void *DualChannelThread(void *argument) {
+
+	// Definition of local variables
+	DualChannelWorker *worker = argument;	// arguments of this thread
+	DualChannel *dual = worker->dual;		// context of the dual channel evaluation
+	const TempBatch *batch = 0;				// batch to be evaluated
+	unsigned int *result = 0;				// result array of this channel
+	unsigned int seen = 0;					// last evaluated generation
+	unsigned int index = 0;					// Loop index
+
+	PinToCore(worker->core);
+
+	pthread_mutex_lock(&dual->lock);
+	while(dual->shutdown == 0)
+	{
+		if(dual->generation == seen)
+		{
+			pthread_cond_wait(&dual->start, &dual->lock);
+		}
+		else
+		{
+			seen = dual->generation;
+			batch = dual->batch;
+			result = dual->result[worker->channel];
+			pthread_mutex_unlock(&dual->lock);
+
+			/*The batch is only read, both channels work on the same memory*/
+			if(worker->channel == 0)
+			{
+				ValidateTempBatch(batch, 0, result);
+			}
+			else
+			{
+				for(index = 0; index < batch->count; index++)
+				{
+					result[index] = EvaluateTempFixed(batch->format[index], batch->min_temp[index], batch->max_temp[index],
+							batch->max_deltatemp[index], batch->temp_sensor1[index], batch->temp_sensor2[index]);
+				}
+			}
+
+			pthread_mutex_lock(&dual->lock);
+			dual->finished++;
+			pthread_cond_signal(&dual->done);
+		}
+	}
+	pthread_mutex_unlock(&dual->lock);
+
+	return 0;
+}
+
+
+/*---------------------------------------------------
+* Definition of function PinToCore()
+* WARNING: PinToCore() is hardware dependent, the thread is only pinned on Linux
+* Parameters:
+*	core: core for the calling thread, negative for no pinning
+* Return value: none
+------------------------------------------------------*/
+static void PinToCore(int core) {
+
+#if defined(__linux__)
+	// Definition of local variables
+	cpu_set_t cpus;						// set containing only the requested core
+
+	if(core >= 0)
+	{
+		CPU_ZERO(&cpus);
+		CPU_SET(core, &cpus);
+		/*If pinning fails (e.g. core not available), the thread runs unpinned*/
+		(void)pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus);
+	}
+#else
+	(void)core;
+#endif
+}
+
+
+// End of file dualChannel.c
@@ -0,0 +1,72 @@
+/* ---------------------------------------------------------------------------------------------
+ * Module Name: Safe Temperature Monitoring
+ * File Name: dualChannel.h
+ * Corresponding Source-File: dualChannel.c
+ * Created on: 19.10.2026
+ * Development Group: CKN GmbH
+ * Project: FSQM SW Development Exercise
+ * Dependencies: monitorTemp.h, POSIX threads (link with -pthread),
+ * 		pinning of the channels to cores is only available on Linux (hardware dependent)
+ *
+ * Description: This file contains the function prototypes for the diverse redundant (dual channel)
+ * evaluation of a batch of channels. The implementation of the functions can be found in the
+ * corresponding source file dualChannel.c
+ *
+ *  channel A evaluates the batch with ValidateTempBatch() (floating point implementation)
+ *
+ *  channel B evaluates the same batch with EvaluateTempFixed() (diverse integer implementation,
+ *  all temperatures in centi-degree)
+ *
+ *  monitorTempDualChannel() runs both channels in parallel on separate cores and cross-compares
+ *  the results; every channel for which the results do not match is forced to 5 (function failure)
+ * ----------------------------------------------------------------------------------------------
+ * Versions:
+ *
+ * Version: 0.1 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * Initial version, definition of functions
+ *
+ * ----------------------------------------------------------------------------------------------  */
+
+#ifndef DUALCHANNEL_H_
+#define DUALCHANNEL_H_
+
+#include <pthread.h>
+#include "monitorTemp.h"
+
+// Declaration of types
+// Arguments of one evaluation thread (channel A = 0, channel B = 1)
+typedef struct DualChannel DualChannel;
+typedef struct {
+	DualChannel *dual;				// context the thread belongs to
+	unsigned int channel;			// 0: channel A (float), 1: channel B (fixed point)
+	int core;						// core the thread is pinned to, negative: no pinning
+} DualChannelWorker;
+
+// Context of the dual channel evaluation; both threads are created once by DualChannelInit()
+// and wait for batches, so no thread is created in the scan loop
+struct DualChannel {
+	pthread_t thread[2];			// evaluation threads of channel A and B
+	DualChannelWorker worker[2];	// arguments of the evaluation threads
+	pthread_mutex_t lock;			// protects all following members
+	pthread_cond_t start;			// signalled when a new batch is available
+	pthread_cond_t done;			// signalled when a channel has finished the batch
+	const TempBatch *batch;			// shared batch, read by both channels
+	unsigned int *result[2];		// result arrays of channel A and B
+	unsigned int generation;		// incremented for every batch
+	unsigned int finished;			// number of channels which have finished the actual batch
+	unsigned int shutdown;			// 1 if the threads shall terminate
+};
+
+extern unsigned int DualChannelInit(DualChannel *dual, int core_a, int core_b);
+extern void DualChannelShutdown(DualChannel *dual);
+extern unsigned int MonitorTempDualChannel(DualChannel *dual, const TempBatch *batch, unsigned int *temp_ok,
+		unsigned int *result_a, unsigned int *result_b);
+extern unsigned int CompareDualChannel(const unsigned int *result_a, const unsigned int *result_b,
+		unsigned int *temp_ok, unsigned int count);
+extern unsigned int EvaluateTempFixed(char format, float min_temp, float max_temp, float max_deltatemp,
+		float temp_sensor1, float temp_sensor2);
+extern unsigned int CheckTempFixed(long min_temp, long max_temp, long max_deltatemp, long temp_sensor1, long temp_sensor2);
+
+#endif /* DUALCHANNEL_H_ */
@@ -0,0 +1,132 @@
+/* ---------------------------------------------------------------------------------------------
+* Module Name: Dual Channel Testing for MonitorTempDualChannel()
+* File Name: dualchannel_testing.c
+* Corresponding Header-File: dualchannel_testing.h
+* Created on: 19.10.2026
+* Development Group: CKN GmbH
+* Project: FSQM SW Development Exercise (Dual Channel Testing Functions for MonitorTempDualChannel())
+* Dependencies: MonitorTempDualChannel(), TestVectorGet(), stdio.h (hardware dependent)
+*
+* Description: This file contains the dual channel testing function for MonitorTempDualChannel()
+*
+* PerformDualChannelTest() is a function, which evaluates the test vectors of the other test functions
+* with both channels and checks that the channels agree, and that disagreeing channels are reported as 5
+*
+* ----------------------------------------------------------------------------------------------
+* Versions:
+* Version: 0.1 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* 2 dual channel tests were implemented
+*
+* Version: 0.2 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Vectors taken from the shared table of testVectors.c
+*
+* ----------------------------------------------------------------------------------------------*/
+// Include system header files
+#include <stdio.h> // stdio.h is necessary for printing/reading via standard IO
+#include <string.h> // string.h is necessary for string operations
+// Include own header files
+#include "monitorTemp.h"
+#include "dualChannel.h"
+#include "testVectors.h"
+// Definition of global constants (only if really necessary, see coding rules)
+// No globals
+// Definition of global variables (should be avoided, see coding rules)
+// No globals
+// Definition of global and local functions (sorted by topic, if possible)
+
+/*---------------------------------------------------
+* Definition of function PerformDualChannelTest()
+* Parameters:
+* None
+* Return value:
+* test_complete: unsigned integer, 1 if all tests were succesful, 0 if one or more tests failed
+------------------------------------------------------*/
+unsigned int PerformDualChannelTest(void) {
+	// Definition of local variables
+	// Test vectors of BBT1, BBT2, NT1, NT2, BT1, BT2, ST1, ST2, CCT1, CCT2 (testVectors.c)
+	char format[10];
+	float min_temp[10];
+	float max_temp[10];
+	float max_deltatemp[10];
+	float temp_sensor1[10];
+	float temp_sensor2[10];
+	const TestVector *vector = 0; // vector of the actual channel
+	TempBatch batch = {format, min_temp, max_temp, max_deltatemp, temp_sensor1, temp_sensor2, 10};
+	unsigned int temp_ok[10]; // combined results
+	unsigned int result_a[10]; // results of channel A
+	unsigned int result_b[10]; // results of channel B
+	unsigned int mismatches = 0; // number of channels, for which channel A and B do not agree
+	unsigned int index = 0; // loop index
+	unsigned int correct = 0; // number of correct results
+	DualChannel dual; // context of the dual channel evaluation
+	char message[40]; // String array for test result message
+	unsigned int total_tests = 0; // Total number of tests
+	unsigned int successful_tests = 0; // Total number of successful test
+
+	unsigned int test_complete = 0; // 1 if all tests OK, 0 if one or more tests failed
+	// For printf() function, buffer setting (no buffering)
+	setvbuf(stdout, NULL, _IONBF, 0);
+
+	if (DualChannelInit(&dual, 0, 1) == 0) {
+		printf("\n\nDCT: dual channel evaluation could not be started\n");
+		return 0;
+	}
+	for (index = 0; index < 10; index++) {
+		vector = TestVectorGet(TEST_VECTOR_BBT1 + index);
+		format[index] = vector->format;
+		min_temp[index] = vector->min_temp;
+		max_temp[index] = vector->max_temp;
+		max_deltatemp[index] = vector->max_deltatemp;
+		temp_sensor1[index] = vector->temp_sensor1;
+		temp_sensor2[index] = vector->temp_sensor2;
+	}
+	// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+	// Dual channel tests (DCT)
+	// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+	// DCT1: Both channels agree on the test vectors of the other tests
+	total_tests++;
+	printf("\n\nDCT1: Test with the vectors of the other tests, both channels agree\n");
+	// Initialize test result message with negative test result, will only be changed if test is successful
+	strcpy(message, "DCT1 FAILED, Mismatches: \0");
+	mismatches = MonitorTempDualChannel(&dual, &batch, temp_ok, result_a, result_b);
+	correct = 0;
+	for (index = 0; index < 10; index++) {
+		correct += (temp_ok[index] == TestVectorGet(TEST_VECTOR_BBT1 + index)->expected);
+	}
+	// Expected: no mismatch, all results as expected
+	if ((mismatches == 0) && (correct == 10)) {
+		strcpy(message, "DCT1 SUCCESFUL, Mismatches: \0");
+		successful_tests++;
+	}
+	// Print test result
+	printf("\n%s%d", message, mismatches);
+	// End of DCT1
+
+	// DCT2: A limit finer than 0.01 degree is rounded by channel B, the channels disagree
+	total_tests++;
+	printf("\n\nDCT2: Test with minimum temperature -273.154° C, channels disagree\n");
+	// Initialize test result message with negative test result, will only be changed if test is successful
+	strcpy(message, "DCT2 FAILED, Return value: \0");
+	min_temp[0] = -273.154;
+	batch.count = 1;
+	mismatches = MonitorTempDualChannel(&dual, &batch, temp_ok, result_a, result_b);
+	// Expected return value: 5 (Failure), reported as mismatch
+	if ((mismatches == 1) && (temp_ok[0] == 5)) {
+		strcpy(message, "DCT2 SUCCESFUL, Return value: \0");
+		successful_tests++;
+	}
+	// Print test result
+	printf("\n%s%d", message, temp_ok[0]);
+	// End of DCT2
+
+	DualChannelShutdown(&dual);
+
+	test_complete = (successful_tests == total_tests);
+
+	return test_complete;
+
+}
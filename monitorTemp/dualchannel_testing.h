@@ -0,0 +1,28 @@
+/* ---------------------------------------------------------------------------------------------
+ * Module Name: Safe Temperature Monitoring
+ * File Name: dualchannel_testing.h
+ * Corresponding Source-File: dualchannel_testing.c
+ * Created on: 19.10.2026
+ * Development Group: CKN GmbH
+ * Project: FSQM SW Development Exercise
+ * Dependencies: MonitorTempDualChannel(), stdio.h (hardware dependent)
+ *
+ * Description: This file contains the test cases for the dual channel evaluation of the Safe Temperature Monitoring module
+ *
+
+ * ----------------------------------------------------------------------------------------------
+ * Versions:
+ *
+ * Version: 0.1 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * Initial version, definition of functions
+ *
+ * ----------------------------------------------------------------------------------------------  */
+
+#ifndef DUALCHANNEL_TESTING_H_
+#define DUALCHANNEL_TESTING_H_
+
+extern unsigned int PerformDualChannelTest(void);
+
+#endif /* DUALCHANNEL_TESTING_H_ */
@@ -0,0 +1,417 @@
+/* ---------------------------------------------------------------------------------------------
+* Module Name: Safe Temperature Monitoring
+* File Name: limitIndex.c
+* Corresponding Header-File: limitIndex.h
+* Created on: 19.10.2026
+* Development Group: CKN GmbH
+* Project: FSQM SW Development Exercise
+* Dependencies: channelStore.c, stdlib.h (memory is only allocated in LimitIndexInit())
+*
+* Description: This file contains the functions of the closest-to-limit index.
+*
+*  every bucket is a doubly linked list of channels, the links are arrays indexed by the channel, so the
+*  index needs no memory after LimitIndexInit(); an update unlinks the channel from its old bucket and
+*  links it to the front of the new one, a channel whose margin stays in its bucket is not touched
+*
+*  the buckets are ordered by margin, a two level bitmap of the non-empty buckets (1024 words, 16 summary
+*  words) finds the next non-empty bucket with at most 18 words read, so LimitIndexTopK() walks the
+*  nearest channels in O(K) without searching the empty buckets
+*
+*  LimitIndexUpdate() is called after ChannelStoreScan() with the same range of channels; the index is
+*  not protected against concurrent access, only one thread updates and queries it
+*
+* ----------------------------------------------------------------------------------------------
+* Versions:
+* Version: 0.1 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Initial version, bucketed index of the margins to the limits
+*
+* Version: 0.2 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Shared constants and helpers taken from monitorCommon.h
+*
+* Version: 0.3 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Margins calculated in scan units with the delta in whole degrees of the registered unit
+*
+* ----------------------------------------------------------------------------------------------*/
+
+// Include system header files
+#include <stdint.h> // stdint.h is necessary for the fixed size arrays
+#include <stdlib.h> // stdlib.h is necessary for malloc/free
+#include <string.h> // string.h is necessary for memset
+// Include own header files
+#include "channelStore.h"
+#include "monitorCommon.h"
+#include "limitIndex.h"
+
+// Definition of local (module level) constants
+// End of a list of channels
+static const int32_t NO_CHANNEL = -1;
+// Bucket of the margin 0, margins below are alarms
+static const int32_t BUCKET_OFFSET = LIMIT_INDEX_BUCKETS / 2;
+// Bits of a word of the bitmaps
+static const unsigned int WORD_BITS = 64;
+// Word with all bits set
+static const uint64_t ALL_BITS = UINT64_MAX;
+
+// Declaration of local (module level) functions
+static int32_t MarginOfChannel(const ChannelStore *store, unsigned int channel);
+static void LinkChannel(LimitIndex *index, unsigned int channel, unsigned int bucket);
+static void UnlinkChannel(LimitIndex *index, unsigned int channel);
+static unsigned int NextBucket(const LimitIndex *index, unsigned int from);
+static unsigned int LowestBit(uint64_t bits);
+
+
+// Function Definitions
+
+/*---------------------------------------------------
+* Definition of function LimitIndexInit()
+* Parameters:
+*	index: index to be initialized, empty
+*	capacity: maximum number of channels, at least the capacity of the channel store
+* Return value:
+*	init_ok: unsigned integer, 1 if the memory could be allocated, 0 otherwise
+------------------------------------------------------*/
+unsigned int LimitIndexInit(LimitIndex *index, unsigned int capacity) {
+
+	// Definition of local variables
+	unsigned int init_ok = 0;			// Return value, defensive programming: initialize with 0 (failure)
+	size_t head_size = AlignToCacheLine(LIMIT_INDEX_BUCKETS * sizeof(int32_t));	// size of the list heads
+	size_t bitmap_size = AlignToCacheLine(LIMIT_INDEX_WORDS * sizeof(uint64_t));	// size of the bitmap
+	size_t link_size = AlignToCacheLine((size_t)capacity * sizeof(int32_t));		// size of an array of links or margins
+	size_t bucket_size = AlignToCacheLine((size_t)capacity * sizeof(uint16_t));		// size of the buckets of the channels
+	size_t flag_size = AlignToCacheLine((size_t)capacity);							// size of the indexed flags
+	uint8_t *block = 0;					// aligned start of the memory block
+	unsigned int bucket = 0;			// Loop index
+
+	memset(index, 0, sizeof(*index));
+	index->memory = malloc(head_size + bitmap_size + (3 * link_size) + bucket_size + flag_size + CACHE_LINE);
+
+	if(index->memory != 0)
+	{
+		block = (uint8_t *)AlignToCacheLine((uintptr_t)index->memory);
+		index->head = (int32_t *)block;
+		index->occupied = (uint64_t *)(block + head_size);
+		index->next = (int32_t *)(block + head_size + bitmap_size);
+		index->prev = (int32_t *)(block + head_size + bitmap_size + link_size);
+		index->margin = (int32_t *)(block + head_size + bitmap_size + (2 * link_size));
+		index->bucket = (uint16_t *)(block + head_size + bitmap_size + (3 * link_size));
+		index->indexed = block + head_size + bitmap_size + (3 * link_size) + bucket_size;
+
+		for(bucket = 0; bucket < LIMIT_INDEX_BUCKETS; bucket++)
+		{
+			index->head[bucket] = NO_CHANNEL;
+		}
+		memset(index->occupied, 0, bitmap_size);
+		memset(index->indexed, 0, flag_size);
+		index->capacity = capacity;
+		init_ok = 1;
+	}
+
+	return init_ok;
+}
+
+
+/*---------------------------------------------------
+* Definition of function LimitIndexFree()
+* Parameters:
+*	index: index initialized with LimitIndexInit()
+* Return value: none
+------------------------------------------------------*/
+void LimitIndexFree(LimitIndex *index) {
+
+	free(index->memory);
+	memset(index, 0, sizeof(*index));
+}
+
+
+/*---------------------------------------------------
+* Definition of function LimitIndexUpdate()
+* Moves the channels to the bucket of their actual margin, channels with an invalid reading are removed
+* Parameters:
+*	index: index initialized with LimitIndexInit()
+*	store: channel store with the actual readings
+*	first: index of the first channel
+*	count: number of channels, limited to the registered channels and the capacity of the index
+* Return value:
+*	moved: unsigned integer, number of channels which were inserted, moved or removed
+------------------------------------------------------*/
+unsigned int LimitIndexUpdate(LimitIndex *index, const ChannelStore *store, unsigned int first, unsigned int count) {
+
+	// Definition of local variables
+	unsigned int moved = 0;				// Return value: number of changed channels
+	unsigned int end = first;			// channel after the last channel
+	unsigned int channel = 0;			// Loop index
+	unsigned int valid = 0;				// 1 if both readings are valid
+	int32_t margin = 0;					// actual margin of the channel
+	unsigned int bucket = 0;			// bucket of the actual margin
+	unsigned int changed = 0;			// 1 if the channel is inserted, moved or removed
+
+	if(first < store->count)
+	{
+		end = ((store->count - first) < count) ? store->count : (first + count);
+	}
+	end = (end < index->capacity) ? end : index->capacity;
+
+	for(channel = first; channel < end; channel++)
+	{
+		valid = (store->scan_sensor1[channel] != CHANNEL_INVALID_UNITS) && (store->scan_sensor2[channel] != CHANNEL_INVALID_UNITS);
+		margin = (valid == 1) ? MarginOfChannel(store, channel) : 0;
+		/*Margins beyond the outer buckets are sorted into them*/
+		bucket = (unsigned int)(((margin < -BUCKET_OFFSET) ? -BUCKET_OFFSET :
+				((margin >= BUCKET_OFFSET) ? (BUCKET_OFFSET - 1) : margin)) + BUCKET_OFFSET);
+
+		changed = (index->indexed[channel] == 1) && ((valid == 0) || (bucket != index->bucket[channel]));
+		if(changed == 1)
+		{
+			UnlinkChannel(index, channel);
+		}
+		if((valid == 1) && (index->indexed[channel] == 0))
+		{
+			LinkChannel(index, channel, bucket);
+			changed = 1;
+		}
+		index->margin[channel] = margin;
+		moved += changed;
+	}
+
+	return moved;
+}
+
+
+/*---------------------------------------------------
+* Definition of function LimitIndexTopK()
+* Returns the indexed channels with the smallest margins, ordered by margin (alarms first)
+* Parameters:
+*	index: index updated with LimitIndexUpdate()
+*	k: maximum number of channels to be returned
+*	channels: returns the channel numbers, array of at least k elements
+*	margins: returns the margins in centi-degree, array of at least k elements
+* Return value:
+*	found: unsigned integer, number of returned channels, less than k if fewer channels are indexed
+------------------------------------------------------*/
+unsigned int LimitIndexTopK(const LimitIndex *index, unsigned int k, unsigned int *channels, int32_t *margins) {
+
+	// Definition of local variables
+	unsigned int found = 0;				// Return value: number of returned channels
+	unsigned int bucket = NextBucket(index, 0);	// actual non-empty bucket
+	int32_t channel = NO_CHANNEL;		// Loop index over the channels of a bucket
+
+	while((found < k) && (bucket < LIMIT_INDEX_BUCKETS))
+	{
+		for(channel = index->head[bucket]; (channel != NO_CHANNEL) && (found < k); channel = index->next[channel])
+		{
+			channels[found] = (unsigned int)channel;
+			margins[found] = index->margin[channel];
+			found++;
+		}
+		bucket = NextBucket(index, bucket + 1);
+	}
+
+	return found;
+}
+
+
+/*---------------------------------------------------
+* Definition of function LimitIndexMargin()
+* Parameters:
+*	index: index updated with LimitIndexUpdate()
+*	channel: index of a channel
+*	margin: returns the margin of the last update in centi-degree
+* Return value:
+*	indexed: unsigned integer, 1 if the channel is in the index, 0 otherwise (margin not changed)
+------------------------------------------------------*/
+unsigned int LimitIndexMargin(const LimitIndex *index, unsigned int channel, int32_t *margin) {
+
+	// Definition of local variables
+	unsigned int indexed = 0;			// Return value, defensive programming: initialize with 0 (not indexed)
+
+	if((channel < index->capacity) && (index->indexed[channel] == 1))
+	{
+		*margin = index->margin[channel];
+		indexed = 1;
+	}
+
+	return indexed;
+}
+
+
+/*---------------------------------------------------
+* Definition of function MarginOfChannel()
+* Parameters:
+*	store: channel store with valid readings of the channel
+*	channel: index of a registered channel
+* Return value:
+*	margin: smallest distance to the limits in centi-degree Celsius (rounded down), negative exactly if
+*	ChannelStoreScan() reports an alarm
+------------------------------------------------------*/
+static int32_t MarginOfChannel(const ChannelStore *store, unsigned int channel) {
+
+	// Definition of local variables
+	int32_t margin = 0;					// Return value: smallest margin
+	int32_t sensor1 = store->scan_sensor1[channel];	// reading of sensor 1 in scan units
+	int32_t sensor2 = store->scan_sensor2[channel];	// reading of sensor 2 in scan units
+	int32_t lower = 0;					// margin to min_temp or max_temp
+
+	/*Same comparisons as ChannelStoreScan() in scan units, the delta in whole degrees of the registered unit*/
+	margin = store->max_deltatemp[channel] - store->scan_delta[channel];
+
+	lower = ((sensor1 < sensor2) ? sensor1 : sensor2) - store->min_temp[channel];
+	margin = (lower < margin) ? lower : margin;
+	lower = store->max_temp[channel] - ((sensor1 > sensor2) ? sensor1 : sensor2);
+	margin = (lower < margin) ? lower : margin;
+
+	/*Rounded down, so the sign of the margin is kept*/
+	margin = (margin < 0) ? -((CHANNEL_UNITS_PER_CENTI_C - 1 - margin) / CHANNEL_UNITS_PER_CENTI_C)
+			: (margin / CHANNEL_UNITS_PER_CENTI_C);
+
+	return margin;
+}
+
+
+/*---------------------------------------------------
+* Definition of function LinkChannel()
+* Parameters:
+*	index: index, the channel is not indexed
+*	channel: channel to be inserted at the front of the bucket
+*	bucket: bucket of the margin of the channel
+* Return value: none
+------------------------------------------------------*/
+static void LinkChannel(LimitIndex *index, unsigned int channel, unsigned int bucket) {
+
+	// Definition of local variables
+	int32_t first = index->head[bucket];	// previous first channel of the bucket
+	unsigned int word = bucket / WORD_BITS;	// word of the bucket in the bitmap
+
+	index->next[channel] = first;
+	index->prev[channel] = NO_CHANNEL;
+	if(first != NO_CHANNEL)
+	{
+		index->prev[first] = (int32_t)channel;
+	}
+	index->head[bucket] = (int32_t)channel;
+	index->bucket[channel] = (uint16_t)bucket;
+	index->indexed[channel] = 1;
+	index->count++;
+
+	index->occupied[word] |= (uint64_t)1 << (bucket % WORD_BITS);
+	index->summary[word / WORD_BITS] |= (uint64_t)1 << (word % WORD_BITS);
+}
+
+
+/*---------------------------------------------------
+* Definition of function UnlinkChannel()
+* Parameters:
+*	index: index, the channel is indexed
+*	channel: channel to be removed from its bucket
+* Return value: none
+------------------------------------------------------*/
+static void UnlinkChannel(LimitIndex *index, unsigned int channel) {
+
+	// Definition of local variables
+	unsigned int bucket = index->bucket[channel];	// bucket of the channel
+	unsigned int word = bucket / WORD_BITS;		// word of the bucket in the bitmap
+	int32_t next = index->next[channel];		// next channel of the bucket
+	int32_t prev = index->prev[channel];		// previous channel of the bucket
+
+	if(prev == NO_CHANNEL)
+	{
+		index->head[bucket] = next;
+	}
+	else
+	{
+		index->next[prev] = next;
+	}
+	if(next != NO_CHANNEL)
+	{
+		index->prev[next] = prev;
+	}
+	index->indexed[channel] = 0;
+	index->count--;
+
+	if(index->head[bucket] == NO_CHANNEL)
+	{
+		index->occupied[word] &= ~((uint64_t)1 << (bucket % WORD_BITS));
+		if(index->occupied[word] == 0)
+		{
+			index->summary[word / WORD_BITS] &= ~((uint64_t)1 << (word % WORD_BITS));
+		}
+	}
+}
+
+
+/*---------------------------------------------------
+* Definition of function NextBucket()
+* Parameters:
+*	index: index
+*	from: first bucket to be checked
+* Return value:
+*	bucket: first non-empty bucket from the bucket from on, LIMIT_INDEX_BUCKETS if there is none
+------------------------------------------------------*/
+static unsigned int NextBucket(const LimitIndex *index, unsigned int from) {
+
+	// Definition of local variables
+	unsigned int bucket = LIMIT_INDEX_BUCKETS;	// Return value, defensive programming: initialize with no bucket
+	unsigned int word = from / WORD_BITS;		// word of the bitmap
+	unsigned int group = 0;						// word of the summary
+	uint64_t bits = 0;							// remaining bits of a word
+
+	if(from < LIMIT_INDEX_BUCKETS)
+	{
+		bits = index->occupied[word] & (ALL_BITS << (from % WORD_BITS));
+		if(bits != 0)
+		{
+			bucket = (word * WORD_BITS) + LowestBit(bits);
+		}
+		else
+		{
+			/*The following words of the bitmap are found in the summary*/
+			word++;
+			group = word / WORD_BITS;
+			bits = (word < LIMIT_INDEX_WORDS) ? (index->summary[group] & (ALL_BITS << (word % WORD_BITS))) : 0;
+			while((bits == 0) && (++group < LIMIT_INDEX_SUMMARY))
+			{
+				bits = index->summary[group];
+			}
+			if(bits != 0)
+			{
+				word = (group * WORD_BITS) + LowestBit(bits);
+				bucket = (word * WORD_BITS) + LowestBit(index->occupied[word]);
+			}
+		}
+	}
+
+	return bucket;
+}
+
+
+/*---------------------------------------------------
+* Definition of function LowestBit()
+* Parameters:
+*	bits: word, not 0
+* Return value:
+*	position: position of the lowest set bit, 0 .. 63
+------------------------------------------------------*/
+static unsigned int LowestBit(uint64_t bits) {
+
+	// Definition of local variables
+	unsigned int position = 0;			// Return value: position of the lowest set bit
+
+#if defined(__GNUC__)
+	position = (unsigned int)__builtin_ctzll(bits);
+#else
+	while((bits & 1) == 0)
+	{
+		bits >>= 1;
+		position++;
+	}
+#endif
+
+	return position;
+}
+
+
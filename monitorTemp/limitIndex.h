@@ -0,0 +1,71 @@
+/* ---------------------------------------------------------------------------------------------
+ * Module Name: Safe Temperature Monitoring
+ * File Name: limitIndex.h
+ * Corresponding Source-File: limitIndex.c
+ * Created on: 19.10.2026
+ * Development Group: CKN GmbH
+ * Project: FSQM SW Development Exercise
+ * Dependencies: channelStore.h, stdlib.h (memory is only allocated in LimitIndexInit())
+ *
+ * Description: This file contains the function prototypes of the closest-to-limit index.
+ * The implementation of the functions can be found in the corresponding source file limitIndex.c
+ *
+ *  the margin of a channel is the smallest distance to one of its limits, with the same comparisons as
+ *  ChannelStoreScan(): max_temp - larger reading, smaller reading - min_temp and max_deltatemp - delta of
+ *  the magnitudes in whole degrees of the registered unit; it is calculated in scan units and rounded down
+ *  to centi-degree Celsius, so a negative margin is an alarm for Celsius and Fahrenheit channels
+ *
+ *  the channels are kept in one bucket per centi-degree of margin, an update moves a channel between
+ *  two buckets in constant time and a query of the K channels nearest to alarm takes O(K) steps,
+ *  independent of the number of channels; channels with an invalid reading are not in the index
+ * ----------------------------------------------------------------------------------------------
+ * Versions:
+ *
+ * Version: 0.1 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * Initial version, definition of functions
+ *
+ * Version: 0.2 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * Margins calculated in scan units with the delta in whole degrees of the registered unit
+ *
+ * ----------------------------------------------------------------------------------------------  */
+
+#ifndef LIMITINDEX_H_
+#define LIMITINDEX_H_
+
+#include <stdint.h>
+#include "channelStore.h"
+
+// Declaration of constants (enumeration constants, usable as array sizes)
+enum {
+	LIMIT_INDEX_BUCKETS = 65536,	// margins -327.68 .. 327.67 degree, larger margins share the outer buckets
+	LIMIT_INDEX_WORDS = LIMIT_INDEX_BUCKETS / 64,	// 64 bit words of the bitmap of non-empty buckets
+	LIMIT_INDEX_SUMMARY = LIMIT_INDEX_WORDS / 64	// 64 bit words of the bitmap of non-empty words
+};
+
+// Declaration of types
+// Index of the channels ordered by margin; the lists are linked by channel numbers, -1 ends a list
+typedef struct {
+	int32_t *head;					// first channel of every bucket
+	int32_t *next;					// next channel in the bucket of the channel
+	int32_t *prev;					// previous channel in the bucket of the channel, -1 for the first
+	int32_t *margin;				// margin of the channel in centi-degree, only valid if the channel is indexed
+	uint16_t *bucket;				// bucket of the channel
+	uint8_t *indexed;				// 1 if the channel is in the index
+	uint64_t *occupied;				// bit per bucket, set if the bucket is not empty
+	uint64_t summary[LIMIT_INDEX_SUMMARY];	// bit per word of occupied, set if the word is not 0
+	unsigned int capacity;			// maximum number of channels
+	unsigned int count;				// number of indexed channels
+	void *memory;					// memory block of all arrays
+} LimitIndex;
+
+extern unsigned int LimitIndexInit(LimitIndex *index, unsigned int capacity);
+extern void LimitIndexFree(LimitIndex *index);
+extern unsigned int LimitIndexUpdate(LimitIndex *index, const ChannelStore *store, unsigned int first, unsigned int count);
+extern unsigned int LimitIndexTopK(const LimitIndex *index, unsigned int k, unsigned int *channels, int32_t *margins);
+extern unsigned int LimitIndexMargin(const LimitIndex *index, unsigned int channel, int32_t *margin);
+
+#endif /* LIMITINDEX_H_ */
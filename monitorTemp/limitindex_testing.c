@@ -0,0 +1,226 @@
+/* ---------------------------------------------------------------------------------------------
+* Module Name: Limit Index Testing for LimitIndexUpdate() and LimitIndexTopK()
+* File Name: limitindex_testing.c
+* Corresponding Header-File: limitindex_testing.h
+* Created on: 19.10.2026
+* Development Group: CKN GmbH
+* Project: FSQM SW Development Exercise (Limit Index Testing Functions)
+* Dependencies: LimitIndexUpdate(), LimitIndexTopK(), LimitIndexMargin(), ChannelStoreScan(), EvaluateTemp(),
+* 		stdio.h (hardware dependent)
+*
+* Description: This file contains the limit index testing function
+*
+* PerformLimitIndexTest() is a function, which checks the order of the channels nearest to alarm,
+* the incremental update of changed and invalid readings and the margins of a large channel store
+* against the results of ChannelStoreScan()
+*
+* ----------------------------------------------------------------------------------------------
+* Versions:
+* Version: 0.1 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* 3 limit index tests were implemented
+*
+* Version: 0.2 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Test of the margins of Fahrenheit channels was implemented
+*
+* ----------------------------------------------------------------------------------------------*/
+// Include system header files
+#include <stdio.h> // stdio.h is necessary for printing/reading via standard IO
+#include <stdlib.h> // stdlib.h is necessary for rand()
+#include <string.h> // string.h is necessary for string operations
+// Include own header files
+#include "monitorTemp.h"
+#include "channelStore.h"
+#include "limitIndex.h"
+// Definition of global constants (only if really necessary, see coding rules)
+// No globals
+// Definition of global variables (should be avoided, see coding rules)
+// No globals
+// Definition of global and local functions (sorted by topic, if possible)
+
+/*---------------------------------------------------
+* Definition of function PerformLimitIndexTest()
+* Parameters:
+* None
+* Return value:
+* test_complete: unsigned integer, 1 if all tests were succesful, 0 if one or more tests failed
+------------------------------------------------------*/
+unsigned int PerformLimitIndexTest(void) {
+	// Definition of local variables
+	LimitIndex index; // index of the small store
+	LimitIndex large_index; // index of the large store
+	ChannelStore store; // channel store with 4 channels
+	ChannelStore large; // channel store with 100000 channels
+	LimitIndex fleet_index; // index of the Fahrenheit channels
+	ChannelStore fleet; // channel store with 1000 Fahrenheit channels
+	float sensor1 = 0; // random reading of sensor 1 in degree Fahrenheit
+	unsigned int channels[100]; // channels nearest to alarm
+	int32_t margins[100]; // margins of the channels nearest to alarm
+	unsigned int found = 0; // number of returned channels
+	unsigned int moved = 0; // number of changed channels of an update
+	unsigned int registered = 0; // index of a registered channel
+	unsigned int channel = 0; // Loop index over the channels
+	unsigned int round = 0; // Loop index over the update rounds
+	unsigned int change = 0; // Loop index over the changed channels
+	int reading = 0; // random reading in centi-degree
+	int32_t margin = 0; // margin of a channel
+	unsigned int indexed = 0; // 1 if the channel is in the index
+	unsigned int below = 0; // number of channels with a smaller margin than the last returned channel
+	unsigned int errors = 0; // number of wrong margins or orders
+	char message[40]; // String array for test result message
+	unsigned int total_tests = 0; // Total number of tests
+	unsigned int successful_tests = 0; // Total number of successful test
+
+	unsigned int test_complete = 0; // 1 if all tests OK, 0 if one or more tests failed
+	// For printf() function, buffer setting (no buffering)
+	setvbuf(stdout, NULL, _IONBF, 0);
+
+	if ((ChannelStoreInit(&store, 4) == 0) || (LimitIndexInit(&index, 4) == 0)) {
+		printf("\n\nLIT: memory could not be allocated\n");
+		ChannelStoreFree(&store);
+		return 0;
+	}
+	// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+	// Limit index tests (LIT)
+	// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+	// LIT1: 4 channels (limits -10 .. 80 degree, delta 3 degree) ordered by margin, alarm first
+	total_tests++;
+	printf("\n\nLIT1: Test with the margins 3.00, 1.00, 0.50 and -1.00 degree, 3 nearest channels\n");
+	// Initialize test result message with negative test result, will only be changed if test is successful
+	strcpy(message, "LIT1 FAILED, Channels: \0");
+	for (channel = 0; channel < 4; channel++) {
+		ChannelStoreRegister(&store, "channel", 'C', -10.0, 80.0, 3.0, &registered);
+	}
+	ChannelStoreSetReading(&store, 0, 50.0f, 50.0f); // margin to max_deltatemp 300
+	ChannelStoreSetReading(&store, 1, 79.0f, 79.0f); // margin to max_temp 100
+	ChannelStoreSetReading(&store, 2, -9.5f, -9.5f); // margin to min_temp 50
+	ChannelStoreSetReading(&store, 3, 81.0f, 81.0f); // alarm, margin to max_temp -100
+	ChannelStoreScan(&store, 0, store.count);
+	moved = LimitIndexUpdate(&index, &store, 0, store.count);
+	found = LimitIndexTopK(&index, 3, channels, margins);
+	// Expected: channels 3, 2 and 1 with the margins -100, 50 and 100
+	if ((moved == 4) && (found == 3) && (channels[0] == 3) && (margins[0] == -100) && (channels[1] == 2)
+			&& (margins[1] == 50) && (channels[2] == 1) && (margins[2] == 100)) {
+		strcpy(message, "LIT1 SUCCESFUL, Channels: \0");
+		successful_tests++;
+	}
+	// Print test result
+	printf("\n%s%d", message, found);
+	// End of LIT1
+
+	// LIT2: Channel 3 back to normal, channel 0 with an invalid reading, channel 1 unchanged
+	total_tests++;
+	printf("\n\nLIT2: Test with changed readings of channel 3 (30.00 degree) and channel 0 (invalid)\n");
+	// Initialize test result message with negative test result, will only be changed if test is successful
+	strcpy(message, "LIT2 FAILED, Changed channels: \0");
+	ChannelStoreSetReading(&store, 3, 30.0f, 30.0f); // margin to max_deltatemp 300
+	ChannelStoreSetReading(&store, 0, -300.0f, 50.0f); // below absolute zero, invalid
+	ChannelStoreScan(&store, 0, store.count);
+	moved = LimitIndexUpdate(&index, &store, 0, store.count);
+	found = LimitIndexTopK(&index, 10, channels, margins);
+	indexed = LimitIndexMargin(&index, 0, &margin);
+	// Expected: 2 changed channels, channels 2, 1 and 3, channel 0 not in the index
+	if ((moved == 2) && (found == 3) && (index.count == 3) && (channels[0] == 2) && (channels[1] == 1)
+			&& (channels[2] == 3) && (margins[2] == 300) && (indexed == 0)) {
+		strcpy(message, "LIT2 SUCCESFUL, Changed channels: \0");
+		successful_tests++;
+	}
+	// Print test result
+	printf("\n%s%d", message, moved);
+	// End of LIT2
+
+	// LIT3: 100000 channels, 10 rounds with 1000 changed readings, margins and order of the 100 nearest channels
+	total_tests++;
+	printf("\n\nLIT3: Test with 100000 channels, 10 rounds of 1000 random readings -15.00 .. 85.00 degree\n");
+	// Initialize test result message with negative test result, will only be changed if test is successful
+	strcpy(message, "LIT3 FAILED, Errors: \0");
+	if ((ChannelStoreInit(&large, 100000) == 1) && (LimitIndexInit(&large_index, 100000) == 1)) {
+		srand(42);
+		for (channel = 0; channel < 100000; channel++) {
+			ChannelStoreRegister(&large, "channel", 'C', -10.0, 80.0, 3.0, &registered);
+			ChannelStoreSetReading(&large, channel, 35.0f, 35.0f);
+		}
+		for (round = 0; round < 10; round++) {
+			for (change = 0; change < 1000; change++) {
+				channel = (unsigned int)rand() % 100000;
+				reading = (rand() % 10001) - 1500;
+				ChannelStoreSetReading(&large, channel, (float)reading / 100.0f,
+						(float)(reading - 400 + (rand() % 801)) / 100.0f);
+			}
+			ChannelStoreScan(&large, 0, large.count);
+			LimitIndexUpdate(&large_index, &large, 0, large.count);
+			found = LimitIndexTopK(&large_index, 100, channels, margins);
+			errors += (found != 100);
+			below = 0;
+			for (channel = 0; channel < large.count; channel++) {
+				indexed = LimitIndexMargin(&large_index, channel, &margin);
+				// alarm exactly for negative margins, invalid readings not indexed
+				errors += (indexed == 1) ? ((margin < 0) != (large.temp_ok[channel] == 3)) : (large.temp_ok[channel] != 5);
+				below += (indexed == 1) && (found > 0) && (margin < margins[found - 1]);
+			}
+			// no channel with a smaller margin was left out
+			errors += (below >= found);
+			for (change = 1; change < found; change++) {
+				errors += (margins[change] < margins[change - 1]);
+			}
+		}
+		// Expected: no errors
+		if (errors == 0) {
+			strcpy(message, "LIT3 SUCCESFUL, Errors: \0");
+			successful_tests++;
+		}
+		LimitIndexFree(&large_index);
+	}
+	ChannelStoreFree(&large);
+	// Print test result
+	printf("\n%s%d", message, errors);
+	// End of LIT3
+
+	// LIT4: Fahrenheit channels, the sign of the margin corresponds to the scan, also for the delta in whole degrees Fahrenheit
+	total_tests++;
+	printf("\n\nLIT4: Test with 1000 Fahrenheit channels (32 .. 212 degree, delta 3.9 degree), random readings\n");
+	// Initialize test result message with negative test result, will only be changed if test is successful
+	strcpy(message, "LIT4 FAILED, Errors: \0");
+	errors = 0;
+	if ((ChannelStoreInit(&fleet, 1000) == 1) && (LimitIndexInit(&fleet_index, 1000) == 1)) {
+		srand(212);
+		for (channel = 0; channel < 1000; channel++) {
+			ChannelStoreRegister(&fleet, "channel", 'F', 32.0, 212.0, 3.9, &registered);
+			sensor1 = 28.0f + ((float)rand() / (float)RAND_MAX) * 188.0f;
+			ChannelStoreSetReading(&fleet, channel, sensor1, sensor1 + (((float)rand() / (float)RAND_MAX) - 0.5f) * 10.0f);
+		}
+		// 4 whole degrees Fahrenheit between the magnitudes, but only 2.22 degree Celsius: alarm
+		ChannelStoreSetReading(&fleet, 0, 100.0f, 96.0f);
+		ChannelStoreScan(&fleet, 0, fleet.count);
+		LimitIndexUpdate(&fleet_index, &fleet, 0, fleet.count);
+		for (channel = 0; channel < fleet.count; channel++) {
+			indexed = LimitIndexMargin(&fleet_index, channel, &margin);
+			// alarm exactly for negative margins
+			errors += (indexed == 0) || ((margin < 0) != (fleet.temp_ok[channel] == 3));
+			errors += (fleet.temp_ok[channel] != EvaluateTemp('F', 32.0, 212.0, 3.9, ChannelStoreNativeTemp(&fleet, channel,
+					fleet.scan_sensor1[channel]), ChannelStoreNativeTemp(&fleet, channel, fleet.scan_sensor2[channel])));
+		}
+		errors += (fleet.temp_ok[0] != 3);
+		// Expected: no errors
+		if (errors == 0) {
+			strcpy(message, "LIT4 SUCCESFUL, Errors: \0");
+			successful_tests++;
+		}
+		LimitIndexFree(&fleet_index);
+	}
+	ChannelStoreFree(&fleet);
+	// Print test result
+	printf("\n%s%d", message, errors);
+	// End of LIT4
+
+	LimitIndexFree(&index);
+	ChannelStoreFree(&store);
+
+	test_complete = (successful_tests == total_tests);
+
+	return test_complete;
+
+}
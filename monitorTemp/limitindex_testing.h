@@ -0,0 +1,28 @@
+/* ---------------------------------------------------------------------------------------------
+ * Module Name: Safe Temperature Monitoring
+ * File Name: limitindex_testing.h
+ * Corresponding Source-File: limitindex_testing.c
+ * Created on: 19.10.2026
+ * Development Group: CKN GmbH
+ * Project: FSQM SW Development Exercise
+ * Dependencies: LimitIndexUpdate(), LimitIndexTopK(), stdio.h (hardware dependent)
+ *
+ * Description: This file contains the test cases for the closest-to-limit index of the Safe Temperature Monitoring module
+ *
+
+ * ----------------------------------------------------------------------------------------------
+ * Versions:
+ *
+ * Version: 0.1 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * Initial version, definition of functions
+ *
+ * ----------------------------------------------------------------------------------------------  */
+
+#ifndef LIMITINDEX_TESTING_H_
+#define LIMITINDEX_TESTING_H_
+
+extern unsigned int PerformLimitIndexTest(void);
+
+#endif /* LIMITINDEX_TESTING_H_ */
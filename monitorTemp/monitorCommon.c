@@ -0,0 +1,80 @@
+/* ---------------------------------------------------------------------------------------------
+* Module Name: Safe Temperature Monitoring
+* File Name: monitorCommon.c
+* Corresponding Header-File: monitorCommon.h
+* Created on: 19.10.2026
+* Development Group: CKN GmbH
+* Project: FSQM SW Development Exercise
+* Dependencies: stddef.h
+*
+* Description: This file contains the internal helper functions shared by the modules around the
+* monitoring core.
+*
+*  toCentiDegree() rounds as ToCenti() in monitorTemp.c, so a value converted here and a value
+*  rounded by CheckTemp() are the same number of centi-degree
+*
+* ----------------------------------------------------------------------------------------------
+* Versions:
+* Version: 0.1 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Initial version, ToCentiDegree() and AlignToCacheLine() moved here
+*
+* ----------------------------------------------------------------------------------------------*/
+
+// Include system header files
+#include <stddef.h> // stddef.h is necessary for size_t
+// Include own header files
+#include "monitorCommon.h"
+
+// Definition of local (module level) constants
+// Largest magnitude which is converted to centi-degree, everything beyond (and NaN) is invalid
+static const float CONVERSION_LIMIT = 1.0e6f;
+
+
+// Function Definitions
+
+/*---------------------------------------------------
+* Definition of function ToCentiDegree()
+* Rounding corresponds to roundf(value * 100) (half away from zero), but without math.h
+* Parameters:
+*	value: temperature in degree as float
+*	centi: converted temperature in centi-degree
+* Return value:
+*	valid: unsigned integer, 1 if the value could be converted, 0 for NaN or too large values
+------------------------------------------------------*/
+unsigned int ToCentiDegree(float value, long *centi) {
+
+	// Definition of local variables
+	unsigned int valid = 0;				// Return value, defensive programming: initialize with 0 (invalid)
+	float scaled = 0;					// value in centi-degree, not rounded
+	float fraction = 0;					// fraction of scaled
+	long whole = 0;						// scaled truncated towards zero
+
+	*centi = 0;
+	if((value > -CONVERSION_LIMIT) && (value < CONVERSION_LIMIT))
+	{
+		scaled = value * 100.0f;
+		whole = (long)scaled;
+		fraction = scaled - (float)whole;
+		whole += (fraction >= 0.5f);
+		whole -= (fraction <= -0.5f);
+		*centi = whole;
+		valid = 1;
+	}
+
+	return valid;
+}
+
+
+/*---------------------------------------------------
+* Definition of function AlignToCacheLine()
+* Parameters:
+*	size: size in bytes (or address)
+* Return value:
+*	aligned: size rounded up to the next multiple of the cache line size
+------------------------------------------------------*/
+size_t AlignToCacheLine(size_t size) {
+
+	return (size + (size_t)CACHE_LINE - 1) & ~((size_t)CACHE_LINE - 1);
+}
@@ -0,0 +1,46 @@
+/* ---------------------------------------------------------------------------------------------
+ * Module Name: Safe Temperature Monitoring
+ * File Name: monitorCommon.h
+ * Corresponding Source-File: monitorCommon.c
+ * Created on: 19.10.2026
+ * Development Group: CKN GmbH
+ * Project: FSQM SW Development Exercise
+ * Dependencies: stddef.h, stdint.h
+ *
+ * Description: This file contains the internal constants and helper functions, which are shared by
+ * the modules around the monitoring core (dual channel evaluation, channel store and the modules
+ * working on the channel store). It is not part of the interface of the monitoring core.
+ * The implementation of the functions can be found in the corresponding source file monitorCommon.c
+ *
+ *  the absolute temperatures in centi-degree must correspond to ABS_MINTEMP_C etc. in monitorTemp.c,
+ *  every other module takes them (and the marker of an invalid reading) from this file only
+ * ----------------------------------------------------------------------------------------------
+ * Versions:
+ *
+ * Version: 0.1 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * Initial version, constants and helpers of dualChannel.c and channelStore.c moved here
+ *
+ * ----------------------------------------------------------------------------------------------  */
+
+#ifndef MONITORCOMMON_H_
+#define MONITORCOMMON_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Declaration of constants (enumeration constants)
+enum {
+	ABS_MAXTEMP_C_CENTI = 100000,	// absolute maximum temperature in centi-degree Celsius
+	ABS_MAXTEMP_F_CENTI = 183200,	// absolute maximum temperature in centi-degree Fahrenheit
+	ABS_MINTEMP_C_CENTI = -27315,	// absolute minimum temperature in centi-degree Celsius
+	ABS_MINTEMP_F_CENTI = -45967,	// absolute minimum temperature in centi-degree Fahrenheit
+	INVALID_READING = INT16_MIN,	// marker of an invalid reading in the 16 bit arrays of the channel store
+	CACHE_LINE = 64					// size of a cache line, arrays of many channels start at a cache line
+};
+
+extern unsigned int ToCentiDegree(float value, long *centi);
+extern size_t AlignToCacheLine(size_t size);
+
+#endif /* MONITORCOMMON_H_ */
@@ -25,6 +25,11 @@
  *  calcC2F() is an auxiliary function, which calculates temperature in Celsius to Fahrenheit
  *
  *  calcF2C() is an auxiliary function, which calculates temperature in Fahrenheit to Celcius
+ *
+ *  Freestanding build: if MONITORTEMP_FREESTANDING is defined by the build (-DMONITORTEMP_FREESTANDING),
+ *  no header of the C library is included and neither libc nor libm is needed; displayTemp() then
+ *  formats the text itself and passes it to MonitorTempOutput(), which must be provided by the
+ *  application (e.g. display driver or UART); see tools/footprint_report.sh for the size and stack report
 *
 *
 * ----------------------------------------------------------------------------------------------
@@ -35,13 +40,33 @@
 * Description of Modifications:
 * New implementation of MonitorTemp() function
 *
+* Version: 0.2 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Plausibility checks and CheckTemp() call moved from MonitorTemp() to EvaluateTemp(),
+* so that channels can be evaluated without display (e.g. in batches)
+*
+* Version: 0.3 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* EvaluateTemp() evaluates all checks in a single pass without branches (ValidateChannel()),
+* the result code is derived from the violation mask; EvaluateTempEx(), ValidateTemp() and
+* ValidateTempBatch() return the mask; NaN is detected as invalid value
+*
+* Version: 0.4 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* roundf() and abs() replaced by RoundToCenti() and Magnitude() (same results), so the evaluation does
+* not need libm and stdlib; freestanding build of DisplayTemp() with output hook MonitorTempOutput()
+*
 * ----------------------------------------------------------------------------------------------*/
 
 // Include system header files
+// The freestanding build does not use the C library, the evaluation does not need it in any case
+#if !defined(MONITORTEMP_FREESTANDING)
 #include <stdio.h> // stdio.h is necessary for printing/reading via standard IO
-#include <math.h>  //math.h is necessary for performing mathematical operations
 #include <string.h> // string.h is necessary for string operations
-#include <stdlib.h> // string.h is necessary for abs operations
+#endif
 // Include own header files
 #include "monitorTemp.h"
 // Definition of local (module level) constants
@@ -58,6 +83,15 @@ static const float ABS_MINTEMP_F = -459.67;
 
 // Declaration of local (module level) functions
 // Note: It might be necessary to define a local (help) function for rounding of decimal (float) values...
+static unsigned int ValidateChannel(char format, float min_temp, float max_temp, float max_deltatemp,
+		float temp_sensor1, float temp_sensor2);
+static float RoundToCenti(float value);
+static int ToCenti(float value);
+static int Magnitude(int value);
+#if defined(MONITORTEMP_FREESTANDING)
+static unsigned int AppendText(char *text, unsigned int used, unsigned int size, const char *append);
+static unsigned int AppendTemp(char *text, unsigned int used, unsigned int size, float value);
+#endif
 
 
 // Function Definitions
@@ -82,91 +116,152 @@ unsigned int MonitorTemp(char format, float min_temp, float max_temp, float max_
 	unsigned int temp_ok = 3; 				// Return value: result of temperature monitoring; defensive programming: initialize with value 3 (failure)
 
 
-	/*Plausibility Check for the parameter 'format' */
+	temp_ok = EvaluateTemp(format, min_temp, max_temp, max_deltatemp, temp_sensor1, temp_sensor2);
 
-	if((format == 'C') || (format == 'c'))
+	/*Overwriting the format to simplify the display, invalid formats have already been reported by EvaluateTemp*/
+	if(format == 'c')
 	{
-		/*Overwriting the format to simplify further operations*/
 		format = 'C';
 	}
-	else if((format == 'F') || (format == 'f'))
+	else if(format == 'f')
 	{
-		/*Overwriting the format to simplify further operations*/
 		format = 'F';
 	}
-	else
-	{
-		/*Invalid format passed to the function*/
-		temp_ok = 5;
-	}
 
-	/*Plausibility Check for the parameter 'min_temp' and 'max_temp' */
+	/*Invoke DisplayTemp function to print the results*/
+	DisplayTemp(format, temp_sensor1, temp_sensor2, temp_ok);
 
-	if(((format == 'C') && (min_temp < ABS_MINTEMP_C)) || ((format == 'F') && (min_temp < ABS_MINTEMP_F)))
-	{
-		/*Invalid min_temp passed to the function*/
-		temp_ok = 5;
-	}
+	return temp_ok;
+}
 
-	if(((format == 'C') && (max_temp > ABS_MAXTEMP_C)) || ((format == 'F') && (max_temp > ABS_MAXTEMP_F)))
-	{
-		/*Invalid max_temp passed to the function*/
-		temp_ok = 5;
-	}
 
-	if((min_temp > max_temp) || (max_temp < min_temp))
-	{
-		/*Invalid max_temp or min_temp passed to the function*/
-		temp_ok = 5;
-	}
+/*---------------------------------------------------
+* Definition of function EvaluateTemp()
+* Parameters:
+*	format: char 'F' or 'C'
+*	min_temp: minimum allowed temperature as float
+*	max_temp: maximum allowed temperature as float
+*	max_deltatemp: maximum allowed delta temperature between sensor 1 and sensor 2 as float
+*	temp_sensor1: actual measured temperature of sensor 1 as float
+*	temp_sensor2: actual measured temperature of sensor 2 as float
+* Return value:
+*	temp_ok: unsigned integer, 7 for temperature range OK, 5 for function failure (i.e. invalid values or sensor failure),
+* 		3 for "out of temperature range", alarm
+------------------------------------------------------*/
+unsigned int EvaluateTemp(char format, float min_temp, float max_temp, float max_deltatemp, float temp_sensor1, float temp_sensor2) {
 
+	// Definition of local variables
+	unsigned int violation_mask = 0;		// Result of all checks, see ValidateTemp()
 
-	/*Plausibility Check for the parameter 'max_deltatemp' */
 
-	if(max_deltatemp > (max_temp - min_temp))
-	{
-		/*Invalid max_deltatemp passed to the function*/
-		temp_ok = 5;
-	}
+	violation_mask = ValidateChannel(format, min_temp, max_temp, max_deltatemp, temp_sensor1, temp_sensor2);
 
-	/*Plausibility Check for the parameter 'temp_sensor1' */
+	return TempCodeFromMask(violation_mask);
+}
 
-	if(((format == 'C') && (temp_sensor1 < ABS_MINTEMP_C)) || ((format == 'F') && (temp_sensor1 < ABS_MINTEMP_F)))
-	{
-		/*Invalid temp_sensor1 passed to the function*/
-		temp_ok = 5;
-	}
 
-	if(((format == 'C') && (temp_sensor1 > ABS_MAXTEMP_C)) || ((format == 'F') && (temp_sensor1 > ABS_MAXTEMP_F)))
-	{
-		/*Invalid temp_sensor1 passed to the function*/
-		temp_ok = 5;
-	}
+/*---------------------------------------------------
+* Definition of function EvaluateTempEx()
+* Same as EvaluateTemp(), but additionally returns the result of every single check
+* Parameters:
+*	format: char 'F' or 'C'
+*	min_temp: minimum allowed temperature as float
+*	max_temp: maximum allowed temperature as float
+*	max_deltatemp: maximum allowed delta temperature between sensor 1 and sensor 2 as float
+*	temp_sensor1: actual measured temperature of sensor 1 as float
+*	temp_sensor2: actual measured temperature of sensor 2 as float
+*	violation_mask: combination of TEMP_VIOLATION_... and TEMP_ALARM_... bits, 0 if everything is OK
+* Return value:
+*	temp_ok: unsigned integer, 7 for temperature range OK, 5 for function failure (i.e. invalid values or sensor failure),
+* 		3 for "out of temperature range", alarm
+------------------------------------------------------*/
+unsigned int EvaluateTempEx(char format, float min_temp, float max_temp, float max_deltatemp, float temp_sensor1, float temp_sensor2,
+		unsigned int *violation_mask) {
 
-	/*Plausibility Check for the parameter 'temp_sensor2' */
+	*violation_mask = ValidateChannel(format, min_temp, max_temp, max_deltatemp, temp_sensor1, temp_sensor2);
 
-	if(((format == 'C') && (temp_sensor2 < ABS_MINTEMP_C)) || ((format == 'F') && (temp_sensor2 < ABS_MINTEMP_F)))
-	{
-		/*Invalid temp_sensor2 passed to the function*/
-		temp_ok = 5;
-	}
+	return TempCodeFromMask(*violation_mask);
+}
+
+
+/*---------------------------------------------------
+* Definition of function ValidateTemp()
+* Parameters:
+*	format: char 'F' or 'C'
+*	min_temp: minimum allowed temperature as float
+*	max_temp: maximum allowed temperature as float
+*	max_deltatemp: maximum allowed delta temperature between sensor 1 and sensor 2 as float
+*	temp_sensor1: actual measured temperature of sensor 1 as float
+*	temp_sensor2: actual measured temperature of sensor 2 as float
+* Return value:
+*	violation_mask: unsigned integer, combination of TEMP_VIOLATION_... and TEMP_ALARM_... bits, 0 if everything is OK
+------------------------------------------------------*/
+unsigned int ValidateTemp(char format, float min_temp, float max_temp, float max_deltatemp, float temp_sensor1, float temp_sensor2) {
+
+	return ValidateChannel(format, min_temp, max_temp, max_deltatemp, temp_sensor1, temp_sensor2);
+}
 
-	if(((format == 'C') && (temp_sensor2 > ABS_MAXTEMP_C)) || ((format == 'F') && (temp_sensor2 > ABS_MAXTEMP_F)))
+
+/*---------------------------------------------------
+* Definition of function ValidateTempBatch()
+* Evaluates all channels of a batch; the loop does not contain any branch, so the compiler can vectorize it
+* Parameters:
+*	batch: channels to be evaluated
+*	violation_mask: violation mask per channel (batch->count elements), 0 if not needed
+*	temp_ok: result per channel (batch->count elements), 7, 3 or 5 as for EvaluateTemp()
+* Return value: none
+------------------------------------------------------*/
+void ValidateTempBatch(const TempBatch *batch, unsigned int *violation_mask, unsigned int *temp_ok) {
+
+	// Definition of local variables
+	unsigned int index = 0;					// Loop index
+	unsigned int mask = 0;					// violation mask of the actual channel
+	// Local copies of the batch, otherwise the compiler has to reload them after every store to temp_ok
+	unsigned int count = batch->count;
+	const char *format = batch->format;
+	const float *min_temp = batch->min_temp;
+	const float *max_temp = batch->max_temp;
+	const float *max_deltatemp = batch->max_deltatemp;
+	const float *temp_sensor1 = batch->temp_sensor1;
+	const float *temp_sensor2 = batch->temp_sensor2;
+
+	if(violation_mask != 0)
 	{
-		/*Invalid temp_sensor2 passed to the function*/
-		temp_ok = 5;
+		for(index = 0; index < count; index++)
+		{
+			mask = ValidateChannel(format[index], min_temp[index], max_temp[index],
+					max_deltatemp[index], temp_sensor1[index], temp_sensor2[index]);
+			violation_mask[index] = mask;
+			temp_ok[index] = TempCodeFromMask(mask);
+		}
 	}
-
-	/*Invoke CheckTemp if all the passed function parameters are valid*/
-	if(temp_ok != 5)
+	else
 	{
-		temp_ok = CheckTemp(min_temp, max_temp, max_deltatemp, temp_sensor1, temp_sensor2);
+		for(index = 0; index < count; index++)
+		{
+			mask = ValidateChannel(format[index], min_temp[index], max_temp[index],
+					max_deltatemp[index], temp_sensor1[index], temp_sensor2[index]);
+			temp_ok[index] = TempCodeFromMask(mask);
+		}
 	}
+}
 
-	/*Invoke DisplayTemp function to print the results*/
-	DisplayTemp(format, temp_sensor1, temp_sensor2, temp_ok);
 
-	return temp_ok;
+/*---------------------------------------------------
+* Definition of function TempCodeFromMask()
+* Parameters:
+*	violation_mask: combination of TEMP_VIOLATION_... and TEMP_ALARM_... bits
+* Return value:
+*	temp_ok: unsigned integer, 5 if a TEMP_VIOLATION_... bit is set, 3 if a TEMP_ALARM_... bit is set, 7 otherwise
+------------------------------------------------------*/
+unsigned int TempCodeFromMask(unsigned int violation_mask) {
+
+	// Definition of local variables
+	unsigned int invalid = ((violation_mask & TEMP_VIOLATION) != 0);	// 1 for function failure
+	unsigned int alarm = ((violation_mask & TEMP_ALARM) != 0);			// 1 for alarm
+
+	/*7: OK, 5: function failure (has priority), 3: alarm*/
+	return 7u - (2u * invalid) - (4u * alarm * (1u - invalid));
 }
 
 
@@ -188,11 +283,12 @@ unsigned int CheckTemp(float min_temp, float max_temp, float max_deltatemp, floa
 	unsigned int temp_ok = 5; 				// Return value: Result of temperature range check and verification of delte between sensors
 											// Defensive programming: initialize with value 5 (failure)
 
-	/*rounding to 2 decimal places*/
-	temp_sensor1 = roundf(temp_sensor1 * 100) / 100;
-	temp_sensor2 = roundf(temp_sensor2 * 100) / 100;
+	/*rounding to 2 decimal places (as roundf(x * 100) / 100)*/
+	temp_sensor1 = RoundToCenti(temp_sensor1);
+	temp_sensor2 = RoundToCenti(temp_sensor2);
 
-	if((abs(temp_sensor1) - abs(temp_sensor2)) > max_deltatemp)
+	/*the magnitudes are compared in whole degrees (truncated), as abs() on the float values did before*/
+	if((Magnitude((int)temp_sensor1) - Magnitude((int)temp_sensor2)) > max_deltatemp)
 	{
 		temp_ok = 3;	//alarm
 	}
@@ -229,7 +325,13 @@ void DisplayTemp(char format, float temp_sensor1, float temp_sensor2, unsigned i
 	// definition of local variables
 	float temp_f;					// Temperature in Fahrenheit
 	float temp_c;					// Temperature in Celsius
+#if defined(MONITORTEMP_FREESTANDING)
+	char text[128];					// text on display, built without the C library
+	unsigned int used = 0;			// length of the text
+	const char *message;			// message on display
+#else
 	char message[40];				// String array for message on display
+#endif
 
 
 	if(format == 'C')
@@ -237,18 +339,53 @@ void DisplayTemp(char format, float temp_sensor1, float temp_sensor2, unsigned i
 		temp_c = (temp_sensor1 + temp_sensor2) / 2;
 		temp_f = CalcC2F(temp_c);
 
+#if defined(MONITORTEMP_FREESTANDING)
+		used = AppendText(text, used, sizeof(text), "actual temperature in chosen format: ");
+		used = AppendTemp(text, used, sizeof(text), temp_c);
+		used = AppendText(text, used, sizeof(text), " °C\ntemperature in the respective other format: ");
+		used = AppendTemp(text, used, sizeof(text), temp_f);
+		used = AppendText(text, used, sizeof(text), " °F\n");
+#else
 		printf("actual temperature in chosen format: %f °%C\n",temp_c,format);
 		printf("temperature in the respective other format: %f °F\n",temp_f);
+#endif
 	}
 	else	/*allowed temperature formats have already been validated in MonitorTemp*/
 	{
 		temp_f = (temp_sensor1 + temp_sensor2) / 2;
 		temp_c = CalcF2C(temp_f);
 
+#if defined(MONITORTEMP_FREESTANDING)
+		used = AppendText(text, used, sizeof(text), "actual temperature in chosen format: ");
+		used = AppendTemp(text, used, sizeof(text), temp_f);
+		used = AppendText(text, used, sizeof(text), " °Ftemperature in the respective other format: ");
+		used = AppendTemp(text, used, sizeof(text), temp_c);
+		used = AppendText(text, used, sizeof(text), " °C\n");
+#else
 		printf("actual temperature in chosen format: %f °%C",temp_f,format);
 		printf("temperature in the respective other format: %f °C\n",temp_c);
+#endif
 	}
 
+#if defined(MONITORTEMP_FREESTANDING)
+	/*same messages as the hosted build*/
+	if(temp_ok == 3)
+	{
+		message = "Temperature range OK ";
+	}
+	else if(temp_ok == 5)
+	{
+		message = "Function error ";
+	}
+	else
+	{
+		message = "alarm ";
+	}
+
+	used = AppendText(text, used, sizeof(text), "\n");
+	used = AppendText(text, used, sizeof(text), message);
+	MonitorTempOutput(text);
+#else
 	if(temp_ok == 3)
 	{
 		strcpy(message, "Temperature range OK \0");
@@ -263,6 +400,7 @@ void DisplayTemp(char format, float temp_sensor1, float temp_sensor2, unsigned i
 	}
 
 	printf("\n%s", message);
+#endif
 }
 
 
@@ -312,6 +450,193 @@ float CalcF2C(float temp_f) {
 // Definition of local (module level) functions
 // Local help functions may be defined here.
 
+/*---------------------------------------------------
+* Definition of function ValidateChannel()
+* Carries out all plausibility checks and the checks of CheckTemp() in a single pass without branches:
+* every check results in a boolean value, which sets one bit of the violation mask
+* NOTE: The checks are written as "not within the valid range", so that NaN is detected as invalid
+* Parameters:
+*	format: char 'F' or 'C'
+*	min_temp: minimum allowed temperature as float
+*	max_temp: maximum allowed temperature as float
+*	max_deltatemp: maximum allowed delta temperature between sensor 1 and sensor 2 as float
+*	temp_sensor1: actual measured temperature of sensor 1 as float
+*	temp_sensor2: actual measured temperature of sensor 2 as float
+* Return value:
+*	violation_mask: unsigned integer, combination of TEMP_VIOLATION_... and TEMP_ALARM_... bits, 0 if everything is OK
+------------------------------------------------------*/
+static unsigned int ValidateChannel(char format, float min_temp, float max_temp, float max_deltatemp,
+		float temp_sensor1, float temp_sensor2) {
+
+	// Definition of local variables
+	unsigned int violation_mask = 0;		// Return value
+	unsigned int format_c = (format == 'C') | (format == 'c');	// 1 for Celsius
+	unsigned int format_f = (format == 'F') | (format == 'f');	// 1 for Fahrenheit
+	unsigned int format_ok = format_c | format_f;				// 1 for a valid format
+	float abs_min = format_f ? ABS_MINTEMP_F : ABS_MINTEMP_C;	// absolute minimum temperature of the format
+	float abs_max = format_f ? ABS_MAXTEMP_F : ABS_MAXTEMP_C;	// absolute maximum temperature of the format
+	unsigned int sensor1_ok = 0;			// 1 if sensor 1 is within the absolute temperatures
+	unsigned int sensor2_ok = 0;			// 1 if sensor 2 is within the absolute temperatures
+	float sensor1 = 0;						// sensor 1 rounded to 2 decimal places
+	float sensor2 = 0;						// sensor 2 rounded to 2 decimal places
+	unsigned int checked = 0;				// 1 if all parameters are plausible, i.e. CheckTemp() would be called
+
+	/*Plausibility checks of the parameters; limits are only checked for a valid format, as in MonitorTemp() V0.1*/
+	violation_mask |= (1u - format_ok) * TEMP_VIOLATION_FORMAT;
+	violation_mask |= (format_ok & !(min_temp >= abs_min)) * TEMP_VIOLATION_MIN_TEMP;
+	violation_mask |= (format_ok & !(max_temp <= abs_max)) * TEMP_VIOLATION_MAX_TEMP;
+	violation_mask |= (!(min_temp <= max_temp)) * TEMP_VIOLATION_LIMIT_ORDER;
+	violation_mask |= (!(max_deltatemp <= (max_temp - min_temp))) * TEMP_VIOLATION_DELTA_RANGE;
+
+	sensor1_ok = (temp_sensor1 >= abs_min) & (temp_sensor1 <= abs_max);
+	sensor2_ok = (temp_sensor2 >= abs_min) & (temp_sensor2 <= abs_max);
+	violation_mask |= (format_ok & !(temp_sensor1 >= abs_min)) * TEMP_VIOLATION_SENSOR1_LOW;
+	violation_mask |= (format_ok & !(temp_sensor1 <= abs_max)) * TEMP_VIOLATION_SENSOR1_HIGH;
+	violation_mask |= (format_ok & !(temp_sensor2 >= abs_min)) * TEMP_VIOLATION_SENSOR2_LOW;
+	violation_mask |= (format_ok & !(temp_sensor2 <= abs_max)) * TEMP_VIOLATION_SENSOR2_HIGH;
+
+	/*Checks of CheckTemp(); invalid readings are replaced by 0 before the conversion to integer,
+	  the alarm bits are only reported if all parameters are plausible (CheckTemp() is only called then)*/
+	sensor1 = RoundToCenti(sensor1_ok ? temp_sensor1 : 0.0f);
+	sensor2 = RoundToCenti(sensor2_ok ? temp_sensor2 : 0.0f);
+
+	checked = ((violation_mask & TEMP_VIOLATION) == 0);
+
+	violation_mask |= (checked & ((Magnitude((int)sensor1) - Magnitude((int)sensor2)) > max_deltatemp)) * TEMP_ALARM_DELTA;
+	violation_mask |= (checked & ((sensor1 < min_temp) | (sensor2 < min_temp))) * TEMP_ALARM_LOW;
+	violation_mask |= (checked & ((sensor1 > max_temp) | (sensor2 > max_temp))) * TEMP_ALARM_HIGH;
+
+	return violation_mask;
+}
+
+
+/*---------------------------------------------------
+* Definition of function RoundToCenti()
+* Rounding to 2 decimal places without branch, same result as roundf(value * 100) / 100
+* Parameters:
+*	value: temperature as float, must be within +/- 2e7
+* Return value:
+*	rounded: value rounded to 2 decimal places (half away from zero)
+------------------------------------------------------*/
+static float RoundToCenti(float value) {
+
+	return (float)ToCenti(value) / 100;
+}
+
+
+/*---------------------------------------------------
+* Definition of function ToCenti()
+* Parameters:
+*	value: temperature as float, must be within +/- 2e7
+* Return value:
+*	centi: value in centi-degree, rounded half away from zero (as roundf(value * 100))
+------------------------------------------------------*/
+static int ToCenti(float value) {
+
+	// Definition of local variables
+	float scaled = value * 100;				// value in centi-degree, not rounded
+	int whole = (int)scaled;				// scaled truncated towards zero
+	float fraction = scaled - (float)whole;	// fraction of scaled, exact
+
+	whole += (fraction >= 0.5f);
+	whole -= (fraction <= -0.5f);
+
+	return whole;
+}
+
+
+/*---------------------------------------------------
+* Definition of function Magnitude()
+* Replaces abs() of stdlib.h
+* Parameters:
+*	value: integer value
+* Return value:
+*	magnitude: absolute value of value
+------------------------------------------------------*/
+static int Magnitude(int value) {
+
+	return (value < 0) ? -value : value;
+}
+
+
+#if defined(MONITORTEMP_FREESTANDING)
+/*---------------------------------------------------
+* Definition of function AppendText()
+* Replaces strcpy()/strcat() of string.h in the freestanding build
+* Parameters:
+*	text: text buffer
+*	used: length of the text in the buffer
+*	size: size of the buffer in bytes
+*	append: text to be appended, truncated if the buffer is too small
+* Return value:
+*	used: new length of the text, the text is always terminated with '\0'
+------------------------------------------------------*/
+static unsigned int AppendText(char *text, unsigned int used, unsigned int size, const char *append) {
+
+	while((*append != '\0') && ((used + 1) < size))
+	{
+		text[used] = *append;
+		used++;
+		append++;
+	}
+	text[used] = '\0';
+
+	return used;
+}
+
+
+/*---------------------------------------------------
+* Definition of function AppendTemp()
+* Replaces printf("%f") in the freestanding build, the temperature is written with 2 decimal places
+* Parameters:
+*	text: text buffer
+*	used: length of the text in the buffer
+*	size: size of the buffer in bytes
+*	value: temperature as float, "invalid" is written for NaN and values beyond +/- 2e7
+* Return value:
+*	used: new length of the text
+------------------------------------------------------*/
+static unsigned int AppendTemp(char *text, unsigned int used, unsigned int size, float value) {
+
+	// Definition of local variables
+	char digits[16];						// digits of the temperature, written from the end
+	unsigned int position = sizeof(digits) - 1;	// position of the next digit
+	unsigned int centi = 0;					// magnitude of the temperature in centi-degree
+	unsigned int places = 0;				// number of written digits
+
+	if((value > -2.0e7f) && (value < 2.0e7f))
+	{
+		centi = (unsigned int)Magnitude(ToCenti(value));
+		digits[position] = '\0';
+		/*2 decimal places, the decimal point and at least one digit before it*/
+		while((places < 3) || (centi != 0))
+		{
+			if(places == 2)
+			{
+				position--;
+				digits[position] = '.';
+			}
+			position--;
+			digits[position] = (char)('0' + (centi % 10));
+			centi /= 10;
+			places++;
+		}
+		if(value < 0)
+		{
+			position--;
+			digits[position] = '-';
+		}
+		used = AppendText(text, used, size, &digits[position]);
+	}
+	else
+	{
+		used = AppendText(text, used, size, "invalid");
+	}
+
+	return used;
+}
+#endif
+
 
 
 // End of file monitorTemp.c
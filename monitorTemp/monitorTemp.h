@@ -17,6 +17,11 @@
  *  monitorTemp() is the function which evaluates the temperature of two independent sensors;
  *  the function can be used on the US and European market, i.e. it can switch between °C and °F
  *
+ *  evaluateTemp() is the evaluation part of monitorTemp() (plausibility checks and checkTemp()) without display
+ *
+ *  validateTemp() carries out all checks of evaluateTemp() without branches and returns a violation mask,
+ *  evaluateTempEx() returns the mask and the result code, validateTempBatch() evaluates a batch
+ *
  *  checkTemp() is an auxiliary function, which checks the valid temperature range of the measured temperatures
  *
  *  displayTemp() is an auxiliary function, which shows actual temperatures and messages on a display
@@ -25,6 +30,9 @@
  *  calcC2F() is an auxiliary function, which calculates temperature in Celsius to Fahrenheit
  *
  *  calcF2C() is an auxiliary function, which calculates temeprature in Fahrenheit to Celcius
+ *
+ *  MonitorTempOutput() must be provided by the application in the freestanding build (MONITORTEMP_FREESTANDING),
+ *  it receives the text of displayTemp()
  * ----------------------------------------------------------------------------------------------
  * Versions:
  *
@@ -34,6 +42,23 @@
  * Description of Modifications:
  * Initial version, definition of functions, including standard library stdio.h
  *
+ * Version: 0.2 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * EvaluateTemp() separated from MonitorTemp() (evaluation without display),
+ * definition of TempBatch for evaluation of many channels at once
+ *
+ * Version: 0.3 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * Violation mask (TEMP_VIOLATION_... and TEMP_ALARM_... bits), EvaluateTempEx(), ValidateTemp(),
+ * ValidateTempBatch() and TempCodeFromMask()
+ *
+ * Version: 0.4 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * Freestanding build (MONITORTEMP_FREESTANDING) without libc and libm, output hook MonitorTempOutput()
+ *
  * ----------------------------------------------------------------------------------------------  */
 
 // Only make declarations if library hasn't been used before
@@ -53,6 +78,38 @@
 // Note: Global variables should not be used in safety relevant software (only if other solutions are not reasonable)
 // No global variables are used in monitorTemp.c
 
+// Declaration of the violation mask
+// Every check of EvaluateTemp() sets one bit; enumeration constants are used instead of #define statements
+// TEMP_VIOLATION_... bits result in 5 (function failure), TEMP_ALARM_... bits in 3 (alarm)
+enum {
+	TEMP_VIOLATION_FORMAT = 0x001,			// format is neither 'C' nor 'F'
+	TEMP_VIOLATION_MIN_TEMP = 0x002,		// min_temp below the absolute minimum temperature
+	TEMP_VIOLATION_MAX_TEMP = 0x004,		// max_temp above the absolute maximum temperature
+	TEMP_VIOLATION_LIMIT_ORDER = 0x008,		// min_temp above max_temp
+	TEMP_VIOLATION_DELTA_RANGE = 0x010,		// max_deltatemp larger than max_temp - min_temp
+	TEMP_VIOLATION_SENSOR1_LOW = 0x020,		// temp_sensor1 below the absolute minimum temperature
+	TEMP_VIOLATION_SENSOR1_HIGH = 0x040,	// temp_sensor1 above the absolute maximum temperature
+	TEMP_VIOLATION_SENSOR2_LOW = 0x080,		// temp_sensor2 below the absolute minimum temperature
+	TEMP_VIOLATION_SENSOR2_HIGH = 0x100,	// temp_sensor2 above the absolute maximum temperature
+	TEMP_VIOLATION = 0x1FF,					// all TEMP_VIOLATION_... bits
+	TEMP_ALARM_DELTA = 0x200,				// delta between the sensors larger than max_deltatemp
+	TEMP_ALARM_LOW = 0x400,					// a sensor below min_temp
+	TEMP_ALARM_HIGH = 0x800,				// a sensor above max_temp
+	TEMP_ALARM = 0xE00						// all TEMP_ALARM_... bits
+};
+
+// Declaration of types
+// TempBatch describes a batch of channels in "structure of arrays" form, i.e. element i of every array
+// belongs to channel i; the arrays correspond to the parameters of MonitorTemp() and are only read
+typedef struct {
+	const char *format;				// 'F' or 'C' per channel
+	const float *min_temp;			// minimum allowed temperature per channel
+	const float *max_temp;			// maximum allowed temperature per channel
+	const float *max_deltatemp;		// maximum allowed delta temperature between sensor 1 and sensor 2 per channel
+	const float *temp_sensor1;		// actual measured temperature of sensor 1 per channel
+	const float *temp_sensor2;		// actual measured temperature of sensor 2 per channel
+	unsigned int count;				// number of channels in the batch
+} TempBatch;
 
 
 // Declaration of all function prototypes which shall be realized in monitorTemp.c including all parameters and return values
@@ -60,10 +117,19 @@
 // this safes memory, because memory is claimed by the compiler only, if the function is really used (and then defined) in the application.
 // Further explanations for each function can be found in monitorTemp.c
 extern unsigned int MonitorTemp(char format, float min_temp, float max_temp, float max_deltatemp, float temp_sensor1, float temp_sensor2);
+extern unsigned int EvaluateTemp(char format, float min_temp, float max_temp, float max_deltatemp, float temp_sensor1, float temp_sensor2);
+extern unsigned int EvaluateTempEx(char format, float min_temp, float max_temp, float max_deltatemp, float temp_sensor1, float temp_sensor2,
+		unsigned int *violation_mask);
+extern unsigned int ValidateTemp(char format, float min_temp, float max_temp, float max_deltatemp, float temp_sensor1, float temp_sensor2);
+extern void ValidateTempBatch(const TempBatch *batch, unsigned int *violation_mask, unsigned int *temp_ok);
+extern unsigned int TempCodeFromMask(unsigned int violation_mask);
 extern unsigned int CheckTemp(float min_temp, float max_temp, float max_deltatemp, float temp_sensor1, float temp_sensor2);
 extern void DisplayTemp(char format, float temp_sensor1, float temp_sensor2, unsigned int temp_ok);
 extern float CalcC2F(float temp_c);
 extern float CalcF2C(float temp_f);
+#if defined(MONITORTEMP_FREESTANDING)
+extern void MonitorTempOutput(const char *text);	// provided by the application (display driver, UART, ...)
+#endif
 
 
 #endif // MONITORTEMP_H_
@@ -31,6 +31,19 @@
 #include "blackboxtesting.h"
 #include "negative_boundary_whitebox_testing.h"
 #include "statistical_codecov_testing.h"
+#include "dualchannel_testing.h"
+#include "channelstore_testing.h"
+#include "scanarena_testing.h"
+#include "telemetry_testing.h"
+#include "pipeline_testing.h"
+#include "checkpoint_testing.h"
+#include "sensorhealth_testing.h"
+#include "columnexport_testing.h"
+#include "displaycache_testing.h"
+#include "rollup_testing.h"
+#include "quantilesketch_testing.h"
+#include "selftest_testing.h"
+#include "limitindex_testing.h"
 
 
 /* -----------------------------------------------------------
@@ -74,6 +87,58 @@ int main(void) {
 	test_result = PerformStatisticalTest();
 	printf("\n\nResult of Statistical Tests: %d (1: OK, 0: Fail)\n\n\n", test_result);
 
+	// Dual Channel Tests
+	test_result = PerformDualChannelTest();
+	printf("\n\nResult of Dual Channel Tests: %d (1: OK, 0: Fail)\n\n\n", test_result);
+
+	// Channel Store Tests
+	test_result = PerformChannelStoreTest();
+	printf("\n\nResult of Channel Store Tests: %d (1: OK, 0: Fail)\n\n\n", test_result);
+
+	// Scan Arena Tests
+	test_result = PerformScanArenaTest();
+	printf("\n\nResult of Scan Arena Tests: %d (1: OK, 0: Fail)\n\n\n", test_result);
+
+	// Telemetry Tests
+	test_result = PerformTelemetryTest();
+	printf("\n\nResult of Telemetry Tests: %d (1: OK, 0: Fail)\n\n\n", test_result);
+
+	// Pipeline Tests
+	test_result = PerformPipelineTest();
+	printf("\n\nResult of Pipeline Tests: %d (1: OK, 0: Fail)\n\n\n", test_result);
+
+	// Checkpoint Tests
+	test_result = PerformCheckpointTest();
+	printf("\n\nResult of Checkpoint Tests: %d (1: OK, 0: Fail)\n\n\n", test_result);
+
+	// Sensor Health Tests
+	test_result = PerformSensorHealthTest();
+	printf("\n\nResult of Sensor Health Tests: %d (1: OK, 0: Fail)\n\n\n", test_result);
+
+	// Column Export Tests
+	test_result = PerformColumnExportTest();
+	printf("\n\nResult of Column Export Tests: %d (1: OK, 0: Fail)\n\n\n", test_result);
+
+	// Display Cache Tests
+	test_result = PerformDisplayCacheTest();
+	printf("\n\nResult of Display Cache Tests: %d (1: OK, 0: Fail)\n\n\n", test_result);
+
+	// Rollup Tests
+	test_result = PerformRollupTest();
+	printf("\n\nResult of Rollup Tests: %d (1: OK, 0: Fail)\n\n\n", test_result);
+
+	// Quantile Sketch Tests
+	test_result = PerformQuantileSketchTest();
+	printf("\n\nResult of Quantile Sketch Tests: %d (1: OK, 0: Fail)\n\n\n", test_result);
+
+	// Self-Test Tests
+	test_result = PerformSelfTestTest();
+	printf("\n\nResult of Self-Test Tests: %d (1: OK, 0: Fail)\n\n\n", test_result);
+
+	// Limit Index Tests
+	test_result = PerformLimitIndexTest();
+	printf("\n\nResult of Limit Index Tests: %d (1: OK, 0: Fail)\n\n\n", test_result);
+
 	return 0;
 
 }
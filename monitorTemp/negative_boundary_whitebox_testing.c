@@ -28,6 +28,11 @@
 * Description of Modifications:
 * Initial version, definition of functions, ...
 *
+* Version: 0.2 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* White box tests WBT3 and WBT4 for the violation mask of EvaluateTempEx()
+*
 * ----------------------------------------------------------------------------------------------*/
 // Include system header files
 #include <stdio.h> // stdio.h is necessary for printing/reading via standard IO
@@ -183,7 +188,8 @@ unsigned int PerformBoundaryTest(void){
 unsigned int PerformWhiteBoxTest(void){
 
 	// Definition of local variables
-//	unsigned int temp_ok = 5; // result of temperature monitoring, valid results are 7 (temp OK)
+	unsigned int temp_ok = 5; // result of temperature monitoring, valid results are 7 (temp OK)
+	unsigned int violation_mask = 0; // result of every single check of EvaluateTempEx()
 	float temp_f = 0;
 	// 5 (sensor or function failure) or 3 (out of temperature range alarm)
 	char message[40]; // String array for test result message
@@ -232,6 +238,41 @@ unsigned int PerformWhiteBoxTest(void){
 	printf("\n%s%f", message, temp_f);
 	// End of WBT2
 
+	// +++++++++++++++++++++++++++++++++++++++
+	// Second part: violation mask of EvaluateTempEx()
+	// +++++++++++++++++++++++++++++++++++++++
+	// WBT3: Check that every failed plausibility check is reported
+	total_tests++;
+	printf("\n\n WBT3: Test of the violation mask with swapped limits and sensor 2 above 1000° C\n");
+	// Initialize test result message with negative test result, will only be changed if test is successful
+	strcpy(message, "WBT3 FAILED, Violation mask: \0");
+	// Parameters for EvaluateTempEx: Format, Min Temp, Max Temp, Max Delta, Temp Sensor 1, Temp Sensor 2
+	temp_ok = EvaluateTempEx('C', 80.0, -10.0, 3.0, 50.0, 1001.0, &violation_mask);
+	// Expected return value: 5 (Failure), limit order, delta range and sensor 2 high reported, no alarm
+	if ((temp_ok == 5) && (violation_mask == (TEMP_VIOLATION_LIMIT_ORDER | TEMP_VIOLATION_DELTA_RANGE | TEMP_VIOLATION_SENSOR2_HIGH))) {
+		strcpy(message, "WBT3 SUCCESFUL, Violation mask: \0");
+		successful_tests++;
+	}
+	// Print test result
+	printf("\n%s0x%03X", message, violation_mask);
+	// End of WBT3
+
+	// WBT4: Check that every failed check of CheckTemp() is reported
+	total_tests++;
+	printf("\n\n WBT4: Test of the violation mask with sensor 1 above max temperature and too large delta\n");
+	// Initialize test result message with negative test result, will only be changed if test is successful
+	strcpy(message, "WBT4 FAILED, Violation mask: \0");
+	// Parameters for EvaluateTempEx: Format, Min Temp, Max Temp, Max Delta, Temp Sensor 1, Temp Sensor 2
+	temp_ok = EvaluateTempEx('F', 32.0, 212.0, 5.0, 220.0, 200.0, &violation_mask);
+	// Expected return value: 3 (alarm), delta and high alarm reported
+	if ((temp_ok == 3) && (violation_mask == (TEMP_ALARM_DELTA | TEMP_ALARM_HIGH))) {
+		strcpy(message, "WBT4 SUCCESFUL, Violation mask: \0");
+		successful_tests++;
+	}
+	// Print test result
+	printf("\n%s0x%03X", message, violation_mask);
+	// End of WBT4
+
 	test_complete = (successful_tests == total_tests);
 	return test_complete;
 
@@ -0,0 +1,512 @@
+/* ---------------------------------------------------------------------------------------------
+* Module Name: Safe Temperature Monitoring
+* File Name: pipeline.c
+* Corresponding Header-File: pipeline.h
+* Created on: 19.10.2026
+* Development Group: CKN GmbH
+* Project: FSQM SW Development Exercise
+* Dependencies: monitorTemp.c, scanArena.c, telemetry.c, POSIX threads (link with -pthread),
+* 		stdlib.h (memory is only allocated in PipelineInit())
+*
+* Description: This file contains the functions of the pipelined monitoring.
+*
+*  pipelineInit() allocates all slots and queues in one memory block; all slots are queued as free
+*
+*  pipelineRun() starts one thread per stage and returns when the acquisition has no more batches
+*  and all batches in flight have been published; the end of the batches is passed through the
+*  queues as an invalid slot index, so every stage finishes its queued batches first
+*
+*  a slot is only used by one stage at a time, the queues transfer the ownership, also of the scan arena
+*  and the event pool of the slot: the evaluation acquires the events, the publication releases them
+*
+* ----------------------------------------------------------------------------------------------
+* Versions:
+* Version: 0.1 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Initial version, staged pipeline with bounded queues
+*
+* Version: 0.2 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Evaluation stage uses the branch free ValidateTempBatch()
+*
+* Version: 0.3 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Scan arena and event pool in every slot, events of alarms and failures
+*
+* ----------------------------------------------------------------------------------------------*/
+
+// Include system header files
+#include <pthread.h> // pthread.h is necessary for the stage threads
+#include <stdlib.h> // stdlib.h is necessary for malloc/free
+#include <string.h> // string.h is necessary for memset
+// Include own header files
+#include "monitorTemp.h"
+#include "monitorCommon.h"
+#include "scanArena.h"
+#include "telemetry.h"
+#include "pipeline.h"
+
+// Definition of local (module level) constants
+// Stages of the pipeline
+static const unsigned int STAGE_ACQUIRE = 0;
+static const unsigned int STAGE_FILTER = 1;
+static const unsigned int STAGE_EVALUATE = 2;
+static const unsigned int STAGE_PUBLISH = 3;
+
+// Declaration of local (module level) functions
+static unsigned int QueueInit(PipelineQueue *queue, unsigned int *index, unsigned int size);
+static void QueueFree(PipelineQueue *queue);
+static void QueuePush(PipelineQueue *queue, unsigned int index);
+static unsigned int QueuePop(PipelineQueue *queue);
+static void EvaluateSlot(PipelineSlot *slot);
+static void ReleaseEvents(PipelineSlot *slot);
+static void FreeSlots(Pipeline *pipeline, unsigned int count);
+static void *PipelineThread(void *argument);
+
+
+// Function Definitions
+
+/*---------------------------------------------------
+* Definition of function PipelineInit()
+* Parameters:
+*	pipeline: pipeline to be initialized
+*	slot_count: number of slots, i.e. maximum number of batches in flight (at least 1)
+*	channel_count: maximum number of channels of a batch
+*	acquire: acquisition of a batch, sets slot->batch.count and fills the arrays of the slot
+*	filter: filter of a batch (e.g. of the readings), 0 if not used
+*	publish: publication of the results (slot->temp_ok)
+*	context: context of the application functions
+* Return value:
+*	init_ok: unsigned integer, 1 if the pipeline was initialized, 0 otherwise
+------------------------------------------------------*/
+unsigned int PipelineInit(Pipeline *pipeline, unsigned int slot_count, unsigned int channel_count,
+		PipelineAcquire acquire, PipelineStage filter, PipelineStage publish, void *context) {
+
+	// Definition of local variables
+	unsigned int init_ok = 0;			// Return value, defensive programming: initialize with 0 (failure)
+	size_t slot_size = 0;				// size of the arrays of one slot in bytes
+	unsigned char *next = 0;			// start of the next array
+	unsigned int *rings = 0;			// ring buffers of the queues
+	unsigned int index = 0;				// Loop index
+	unsigned int queues = 0;			// number of initialized queues
+	unsigned int slots = 0;				// number of slots with scan arena and event pool
+	size_t scratch_size = AlignToCacheLine(channel_count * sizeof(unsigned int))
+			+ AlignToCacheLine(channel_count * sizeof(ScanEvent *));	// scratch memory of a batch
+	PipelineSlot *slot = 0;				// actual slot
+
+	memset(pipeline, 0, sizeof(*pipeline));
+	slot_size = channel_count * ((5 * sizeof(float)) + sizeof(unsigned int) + sizeof(char));
+	slot_size = (slot_size + 7u) & ~(size_t)7u;
+
+	if(slot_count > 0)
+	{
+		pipeline->memory = malloc((slot_count * (sizeof(PipelineSlot) + slot_size))
+				+ (PIPELINE_STAGES * (slot_count + 1) * sizeof(unsigned int)));
+	}
+
+	if(pipeline->memory != 0)
+	{
+		pipeline->slots = pipeline->memory;
+		pipeline->slot_count = slot_count;
+		next = (unsigned char *)(pipeline->slots + slot_count);
+
+		for(index = 0; index < slot_count; index++)
+		{
+			slot = &pipeline->slots[index];
+			slot->min_temp = (float *)next;
+			slot->max_temp = slot->min_temp + channel_count;
+			slot->max_deltatemp = slot->max_temp + channel_count;
+			slot->temp_sensor1 = slot->max_deltatemp + channel_count;
+			slot->temp_sensor2 = slot->temp_sensor1 + channel_count;
+			slot->temp_ok = (unsigned int *)(slot->temp_sensor2 + channel_count);
+			slot->format = (char *)(slot->temp_ok + channel_count);
+			slot->capacity = channel_count;
+			slot->batch.format = slot->format;
+			slot->batch.min_temp = slot->min_temp;
+			slot->batch.max_temp = slot->max_temp;
+			slot->batch.max_deltatemp = slot->max_deltatemp;
+			slot->batch.temp_sensor1 = slot->temp_sensor1;
+			slot->batch.temp_sensor2 = slot->temp_sensor2;
+			slot->batch.count = 0;
+			slot->event_count = 0;
+			next += slot_size;
+			if((ScanArenaInit(&slot->arena, scratch_size) == 1) && (EventPoolInit(&slot->events, channel_count) == 1))
+			{
+				slots++;
+			}
+			else
+			{
+				ScanArenaFree(&slot->arena);
+				break;
+			}
+		}
+
+		/*The queues can hold all slots and the end marker, so a push never has to wait*/
+		rings = (unsigned int *)((unsigned char *)(pipeline->slots + slot_count) + (slot_count * slot_size));
+		for(index = 0; (index < PIPELINE_STAGES) && (slots == slot_count); index++)
+		{
+			queues += QueueInit(&pipeline->queue[index], rings + (index * (slot_count + 1)), slot_count + 1);
+			TelemetryHistogramInit(&pipeline->stage_latency[index]);
+		}
+		TelemetryHistogramInit(&pipeline->end_to_end);
+
+		if((queues == PIPELINE_STAGES) && (slots == slot_count))
+		{
+			for(index = 0; index < slot_count; index++)
+			{
+				QueuePush(&pipeline->queue[STAGE_ACQUIRE], index);
+			}
+			pipeline->acquire = acquire;
+			pipeline->filter = filter;
+			pipeline->publish = publish;
+			pipeline->context = context;
+			init_ok = 1;
+		}
+		else
+		{
+			for(index = 0; index < queues; index++)
+			{
+				QueueFree(&pipeline->queue[index]);
+			}
+			FreeSlots(pipeline, slots);
+			free(pipeline->memory);
+			pipeline->memory = 0;
+		}
+	}
+
+	return init_ok;
+}
+
+
+/*---------------------------------------------------
+* Definition of function PipelineRun()
+* Parameters:
+*	pipeline: pipeline initialized with PipelineInit()
+* Return value:
+*	batches: unsigned long, number of published batches (of all runs)
+------------------------------------------------------*/
+unsigned long PipelineRun(Pipeline *pipeline) {
+
+	// Definition of local variables
+	unsigned int stage = 0;				// Loop index over the stages
+	unsigned int started = 0;			// number of started threads
+
+	for(stage = 0; stage < PIPELINE_STAGES; stage++)
+	{
+		pipeline->worker[stage].pipeline = pipeline;
+		pipeline->worker[stage].stage = stage;
+		if(pthread_create(&pipeline->thread[stage], 0, PipelineThread, &pipeline->worker[stage]) != 0)
+		{
+			/*The end marker lets the started stages finish, after the slots which are already free*/
+			QueuePush(&pipeline->queue[STAGE_ACQUIRE], pipeline->slot_count);
+			break;
+		}
+		started++;
+	}
+
+	for(stage = 0; stage < started; stage++)
+	{
+		pthread_join(pipeline->thread[stage], 0);
+	}
+
+	return pipeline->batches;
+}
+
+
+/*---------------------------------------------------
+* Definition of function PipelineFree()
+* Parameters:
+*	pipeline: pipeline initialized with PipelineInit(), not running
+* Return value: none
+------------------------------------------------------*/
+void PipelineFree(Pipeline *pipeline) {
+
+	// Definition of local variables
+	unsigned int stage = 0;				// Loop index over the stages
+
+	for(stage = 0; stage < PIPELINE_STAGES; stage++)
+	{
+		QueueFree(&pipeline->queue[stage]);
+	}
+	FreeSlots(pipeline, pipeline->slot_count);
+	free(pipeline->memory);
+	pipeline->memory = 0;
+	pipeline->slots = 0;
+}
+
+
+
+// Definition of local (module level) functions
+
+/*---------------------------------------------------
+* Definition of function QueueInit()
+* Parameters:
+*	queue: queue to be initialized
+*	index: ring buffer of the queue
+*	size: number of elements of the ring buffer
+* Return value:
+*	init_ok: unsigned integer, 1 if the queue was initialized, 0 otherwise
+------------------------------------------------------*/
+static unsigned int QueueInit(PipelineQueue *queue, unsigned int *index, unsigned int size) {
+
+	// Definition of local variables
+	unsigned int init_ok = 0;			// Return value, defensive programming: initialize with 0 (failure)
+
+	queue->index = index;
+	queue->size = size;
+	queue->head = 0;
+	queue->length = 0;
+
+	if(pthread_mutex_init(&queue->lock, 0) == 0)
+	{
+		if(pthread_cond_init(&queue->not_empty, 0) == 0)
+		{
+			init_ok = 1;
+		}
+		else
+		{
+			pthread_mutex_destroy(&queue->lock);
+		}
+	}
+
+	return init_ok;
+}
+
+
+/*---------------------------------------------------
+* Definition of function QueueFree()
+* Parameters:
+*	queue: queue initialized with QueueInit()
+* Return value: none
+------------------------------------------------------*/
+static void QueueFree(PipelineQueue *queue) {
+
+	pthread_cond_destroy(&queue->not_empty);
+	pthread_mutex_destroy(&queue->lock);
+}
+
+
+/*---------------------------------------------------
+* Definition of function QueuePush()
+* Parameters:
+*	queue: queue initialized with QueueInit()
+*	index: slot index (or end marker) to be queued; the queue is large enough for all slots
+* Return value: none
+------------------------------------------------------*/
+static void QueuePush(PipelineQueue *queue, unsigned int index) {
+
+	pthread_mutex_lock(&queue->lock);
+	if(queue->length < queue->size)
+	{
+		queue->index[(queue->head + queue->length) % queue->size] = index;
+		queue->length++;
+	}
+	pthread_cond_signal(&queue->not_empty);
+	pthread_mutex_unlock(&queue->lock);
+}
+
+
+/*---------------------------------------------------
+* Definition of function QueuePop()
+* Waits until an index is queued
+* Parameters:
+*	queue: queue initialized with QueueInit()
+* Return value:
+*	index: unsigned integer, slot index or end marker
+------------------------------------------------------*/
+static unsigned int QueuePop(PipelineQueue *queue) {
+
+	// Definition of local variables
+	unsigned int index = 0;				// Return value
+
+	pthread_mutex_lock(&queue->lock);
+	while(queue->length == 0)
+	{
+		pthread_cond_wait(&queue->not_empty, &queue->lock);
+	}
+	index = queue->index[queue->head];
+	queue->head = (queue->head + 1) % queue->size;
+	queue->length--;
+	pthread_mutex_unlock(&queue->lock);
+
+	return index;
+}
+
+
+/*---------------------------------------------------
+* Definition of function EvaluateSlot()
+* Evaluates the batch of the slot and creates an event for every channel with alarm or failure;
+* violation masks and events are taken from the preallocated memory of the slot
+* Parameters:
+*	slot: slot with an acquired batch
+* Return value: none
+------------------------------------------------------*/
+static void EvaluateSlot(PipelineSlot *slot) {
+
+	// Definition of local variables
+	TempBatch *batch = &slot->batch;	// batch of the slot
+	unsigned int index = 0;				// Loop index over the channels
+	ScanEvent *event = 0;				// event of the actual channel
+
+	/*The arena is large enough for a batch of capacity channels, so the allocations do not fail*/
+	ScanArenaReset(&slot->arena);
+	slot->violation_mask = ScanArenaAlloc(&slot->arena, batch->count * sizeof(unsigned int));
+	slot->event = ScanArenaAlloc(&slot->arena, batch->count * sizeof(ScanEvent *));
+	slot->event_count = 0;
+
+	ValidateTempBatch(batch, slot->violation_mask, slot->temp_ok);
+
+	for(index = 0; index < batch->count; index++)
+	{
+		event = (slot->temp_ok[index] != 7) ? EventPoolAcquire(&slot->events) : 0;
+		if(event != 0)
+		{
+			event->cycle = slot->sequence;
+			event->channel = index;
+			event->temp_ok = slot->temp_ok[index];
+			event->temp_sensor1 = batch->temp_sensor1[index];
+			event->temp_sensor2 = batch->temp_sensor2[index];
+			slot->event[slot->event_count] = event;
+			slot->event_count++;
+		}
+	}
+}
+
+
+/*---------------------------------------------------
+* Definition of function ReleaseEvents()
+* Parameters:
+*	slot: slot after the publication
+* Return value: none
+------------------------------------------------------*/
+static void ReleaseEvents(PipelineSlot *slot) {
+
+	// Definition of local variables
+	unsigned int index = 0;				// Loop index over the events
+
+	for(index = 0; index < slot->event_count; index++)
+	{
+		EventPoolRelease(&slot->events, slot->event[index]);
+	}
+	slot->event_count = 0;
+}
+
+
+/*---------------------------------------------------
+* Definition of function FreeSlots()
+* Parameters:
+*	pipeline: pipeline with allocated slots
+*	count: number of slots with scan arena and event pool
+* Return value: none
+------------------------------------------------------*/
+static void FreeSlots(Pipeline *pipeline, unsigned int count) {
+
+	// Definition of local variables
+	unsigned int index = 0;				// Loop index over the slots
+
+	for(index = 0; index < count; index++)
+	{
+		EventPoolFree(&pipeline->slots[index].events);
+		ScanArenaFree(&pipeline->slots[index].arena);
+	}
+}
+
+
+/*---------------------------------------------------
+* Definition of function PipelineThread()
+* Thread of one stage: takes a slot from the input queue of the stage, processes it and passes it
+* to the next stage (the publication returns it to the free slots)
+* Parameters:
+*	argument: PipelineWorker of the thread
+* Return value: none (0)
+------------------------------------------------------*/
+static void *PipelineThread(void *argument) {
+
+	// Definition of local variables
+	PipelineWorker *worker = argument;		// arguments of this thread
+	Pipeline *pipeline = worker->pipeline;	// pipeline of this thread
+	unsigned int stage = worker->stage;		// stage of this thread
+	unsigned int next = (stage + 1) % PIPELINE_STAGES;	// stage the slot is passed to
+	unsigned int end = pipeline->slot_count;	// end marker
+	unsigned int running = 1;				// 0 after the end marker
+	unsigned int index = 0;					// index of the actual slot
+	unsigned long sequence = 0;				// number of the next acquired batch
+	PipelineSlot *slot = 0;					// actual slot
+	TempBatch *batch = 0;					// batch of the actual slot
+	uint64_t start = 0;						// start of the processing in ns
+	uint64_t stop = 0;						// end of the processing in ns
+
+	while(running == 1)
+	{
+		index = QueuePop(&pipeline->queue[stage]);
+
+		if(index == end)
+		{
+			/*End marker, is passed on (except by the publication, which is the last stage)*/
+			if(stage != STAGE_PUBLISH)
+			{
+				QueuePush(&pipeline->queue[next], end);
+			}
+			running = 0;
+		}
+		else
+		{
+			slot = &pipeline->slots[index];
+			batch = &slot->batch;
+			start = TelemetryNow();
+
+			if(stage == STAGE_ACQUIRE)
+			{
+				slot->start = start;
+				slot->sequence = sequence;
+				batch->count = 0;
+				if(pipeline->acquire(pipeline->context, slot) == 0)
+				{
+					/*No more batches, the slot stays free*/
+					QueuePush(&pipeline->queue[STAGE_ACQUIRE], index);
+					index = end;
+					running = 0;
+				}
+				if(batch->count > slot->capacity)
+				{
+					batch->count = slot->capacity;
+				}
+				sequence++;
+			}
+			else if(stage == STAGE_FILTER)
+			{
+				if(pipeline->filter != 0)
+				{
+					pipeline->filter(pipeline->context, slot);
+				}
+			}
+			else if(stage == STAGE_EVALUATE)
+			{
+				EvaluateSlot(slot);
+			}
+			else
+			{
+				pipeline->publish(pipeline->context, slot);
+				ReleaseEvents(slot);
+			}
+
+			stop = TelemetryNow();
+			TelemetryRecordLatency(&pipeline->stage_latency[stage], stop - start);
+			if(stage == STAGE_PUBLISH)
+			{
+				TelemetryRecordLatency(&pipeline->end_to_end, stop - slot->start);
+				pipeline->batches++;
+			}
+
+			QueuePush(&pipeline->queue[next], index);
+		}
+	}
+
+	return 0;
+}
+
+
+// End of file pipeline.c
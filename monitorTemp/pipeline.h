@@ -0,0 +1,122 @@
+/* ---------------------------------------------------------------------------------------------
+ * Module Name: Safe Temperature Monitoring
+ * File Name: pipeline.h
+ * Corresponding Source-File: pipeline.c
+ * Created on: 19.10.2026
+ * Development Group: CKN GmbH
+ * Project: FSQM SW Development Exercise
+ * Dependencies: monitorTemp.h, scanArena.h, telemetry.h, POSIX threads (link with -pthread),
+ * 		stdlib.h (memory is only allocated in PipelineInit())
+ *
+ * Description: This file contains the function prototypes of the pipelined monitoring.
+ * The implementation of the functions can be found in the corresponding source file pipeline.c
+ *
+ *  the monitoring is split into four stages: acquisition -> filter -> evaluation -> publication;
+ *  every stage runs in an own thread and works on an own batch, i.e. batch N is evaluated while
+ *  batch N+1 is acquired and batch N-1 is published
+ *
+ *  the batches are kept in a fixed number of slots, which are passed between the stages through
+ *  bounded queues; if all slots are in use, the acquisition waits (backpressure)
+ *
+ *  acquisition, filter and publication are functions of the application (hardware dependent),
+ *  the evaluation is carried out with ValidateTempBatch()
+ *
+ *  the evaluation creates an event for every channel of the batch with alarm or failure; the violation
+ *  masks and the list of events are taken from the scan arena of the slot (reset for every batch), the
+ *  events from the event pool of the slot, they are released after the publication; so no heap function
+ *  is called after PipelineInit()
+ *
+ *  the processing time of each stage and the end-to-end latency of each batch are recorded in histograms
+ * ----------------------------------------------------------------------------------------------
+ * Versions:
+ *
+ * Version: 0.1 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * Initial version, definition of functions
+ *
+ * Version: 0.2 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * Scan arena and event pool in every slot, events of alarms and failures
+ *
+ * ----------------------------------------------------------------------------------------------  */
+
+#ifndef PIPELINE_H_
+#define PIPELINE_H_
+
+#include <pthread.h>
+#include <stdint.h>
+#include "monitorTemp.h"
+#include "scanArena.h"
+#include "telemetry.h"
+
+// Declaration of constants (enumeration constants, usable as array sizes)
+enum {
+	PIPELINE_STAGES = 4				// acquisition, filter, evaluation, publication
+};
+
+// Declaration of types
+// One batch in the pipeline; the arrays belong to the slot, batch points to them
+typedef struct {
+	TempBatch batch;				// channels of the batch, count is set by the acquisition
+	char *format;					// writable arrays of the batch (capacity elements each)
+	float *min_temp;
+	float *max_temp;
+	float *max_deltatemp;
+	float *temp_sensor1;
+	float *temp_sensor2;
+	unsigned int *temp_ok;			// results of the evaluation
+	unsigned int *violation_mask;	// violation masks of the evaluation, taken from the arena
+	ScanEvent **event;				// events of the channels with alarm or failure, taken from the arena
+	unsigned int event_count;		// number of events of the batch
+	ScanArena arena;				// scratch memory of the evaluation, reset for every batch
+	EventPool events;				// event records of the batch, released after the publication
+	unsigned int capacity;			// maximum number of channels of the slot
+	unsigned long sequence;			// number of the batch
+	uint64_t start;					// start of the acquisition in ns (TelemetryNow())
+} PipelineSlot;
+
+// Bounded queue of slot indices between two stages
+typedef struct {
+	unsigned int *index;			// ring buffer of slot indices
+	unsigned int size;				// size of the ring buffer
+	unsigned int head;				// next index to be taken
+	unsigned int length;			// number of queued indices
+	pthread_mutex_t lock;			// protects the queue
+	pthread_cond_t not_empty;		// signalled when an index was queued
+} PipelineQueue;
+
+// Functions of the application; acquisition returns 0 if there are no more batches
+typedef unsigned int (*PipelineAcquire)(void *context, PipelineSlot *slot);
+typedef void (*PipelineStage)(void *context, PipelineSlot *slot);
+
+// Pipelined monitoring
+typedef struct Pipeline Pipeline;
+typedef struct {
+	Pipeline *pipeline;				// pipeline the thread belongs to
+	unsigned int stage;				// stage of the thread
+} PipelineWorker;
+
+struct Pipeline {
+	PipelineSlot *slots;			// all slots
+	unsigned int slot_count;		// number of slots (batches in flight)
+	PipelineQueue queue[PIPELINE_STAGES];	// input queue of every stage, queue 0 holds the free slots
+	pthread_t thread[PIPELINE_STAGES];	// thread of every stage
+	PipelineWorker worker[PIPELINE_STAGES];	// arguments of the threads
+	PipelineAcquire acquire;		// acquisition of a batch
+	PipelineStage filter;			// filter of a batch, 0 if not used
+	PipelineStage publish;			// publication of the results of a batch
+	void *context;					// context of the application functions
+	unsigned long batches;			// number of published batches
+	TelemetryHistogram stage_latency[PIPELINE_STAGES];	// processing time of every stage
+	TelemetryHistogram end_to_end;	// start of acquisition until end of publication
+	void *memory;					// memory block of all slots and queues
+};
+
+extern unsigned int PipelineInit(Pipeline *pipeline, unsigned int slot_count, unsigned int channel_count,
+		PipelineAcquire acquire, PipelineStage filter, PipelineStage publish, void *context);
+extern unsigned long PipelineRun(Pipeline *pipeline);
+extern void PipelineFree(Pipeline *pipeline);
+
+#endif /* PIPELINE_H_ */
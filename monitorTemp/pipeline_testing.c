@@ -0,0 +1,171 @@
+/* ---------------------------------------------------------------------------------------------
+* Module Name: Pipeline Testing for PipelineRun()
+* File Name: pipeline_testing.c
+* Corresponding Header-File: pipeline_testing.h
+* Created on: 19.10.2026
+* Development Group: CKN GmbH
+* Project: FSQM SW Development Exercise (Pipeline Testing Functions)
+* Dependencies: PipelineRun(), TestVectorGet(), stdio.h (hardware dependent)
+*
+* Description: This file contains the pipeline testing function
+*
+* PerformPipelineTest() is a function, which passes batches with the test vectors of the black box and
+* negative tests through the pipeline and checks order, results and latency measurement of the batches
+*
+* ----------------------------------------------------------------------------------------------
+* Versions:
+* Version: 0.1 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* 2 pipeline tests were implemented
+*
+* Version: 0.2 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Vectors taken from the shared table of testVectors.c
+*
+* ----------------------------------------------------------------------------------------------*/
+// Include system header files
+#include <stdio.h> // stdio.h is necessary for printing/reading via standard IO
+#include <string.h> // string.h is necessary for string operations
+// Include own header files
+#include "pipeline.h"
+#include "testVectors.h"
+// Definition of global constants (only if really necessary, see coding rules)
+// No globals
+// Definition of global variables (should be avoided, see coding rules)
+// No globals
+
+// Declaration of types
+// Context of the test functions of the pipeline
+typedef struct {
+	unsigned long acquired; // number of acquired batches
+	unsigned long batches; // number of batches to be acquired
+	unsigned long published; // number of published batches
+	unsigned long in_order; // number of batches published in the order of acquisition
+	unsigned long correct; // number of batches with the expected results
+} PipelineTestContext;
+
+// Definition of global and local functions (sorted by topic, if possible)
+static unsigned int AcquireTestBatch(void *context, PipelineSlot *slot);
+static void PublishTestBatch(void *context, PipelineSlot *slot);
+
+/*---------------------------------------------------
+* Definition of function PerformPipelineTest()
+* Parameters:
+* None
+* Return value:
+* test_complete: unsigned integer, 1 if all tests were succesful, 0 if one or more tests failed
+------------------------------------------------------*/
+unsigned int PerformPipelineTest(void) {
+	// Definition of local variables
+	PipelineTestContext context = {0, 50, 0, 0, 0}; // context of the test functions
+	Pipeline pipeline; // pipeline under test
+	unsigned long batches = 0; // number of published batches
+	char message[40]; // String array for test result message
+	unsigned int total_tests = 0; // Total number of tests
+	unsigned int successful_tests = 0; // Total number of successful test
+
+	unsigned int test_complete = 0; // 1 if all tests OK, 0 if one or more tests failed
+	// For printf() function, buffer setting (no buffering)
+	setvbuf(stdout, NULL, _IONBF, 0);
+
+	// 3 slots: acquisition, evaluation and publication can work on different batches at the same time
+	if (PipelineInit(&pipeline, 3, 4, AcquireTestBatch, 0, PublishTestBatch, &context) == 0) {
+		printf("\n\nPLT: pipeline could not be initialized\n");
+		return 0;
+	}
+	// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+	// Pipeline tests (PLT)
+	// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+	// PLT1: 50 batches pass the pipeline in order with the expected results
+	total_tests++;
+	printf("\n\nPLT1: Test with 50 batches of 4 channels, results in order\n");
+	// Initialize test result message with negative test result, will only be changed if test is successful
+	strcpy(message, "PLT1 FAILED, Batches: \0");
+	batches = PipelineRun(&pipeline);
+	// Expected: 50 batches, all in order and correct
+	if ((batches == 50) && (context.published == 50) && (context.in_order == 50) && (context.correct == 50)) {
+		strcpy(message, "PLT1 SUCCESFUL, Batches: \0");
+		successful_tests++;
+	}
+	// Print test result
+	printf("\n%s%lu", message, batches);
+	// End of PLT1
+
+	// PLT2: The latency of every stage and of every batch is measured
+	total_tests++;
+	printf("\n\nPLT2: Test of the latency measurement, one value per batch and stage\n");
+	// Initialize test result message with negative test result, will only be changed if test is successful
+	strcpy(message, "PLT2 FAILED, End-to-end values: \0");
+	// Expected: 50 end-to-end latencies, 50 per stage (the acquisition also measures the final, empty call)
+	if ((atomic_load(&pipeline.end_to_end.count) == 50) && (atomic_load(&pipeline.stage_latency[2].count) == 50)
+			&& (atomic_load(&pipeline.stage_latency[3].count) == 50)) {
+		strcpy(message, "PLT2 SUCCESFUL, End-to-end values: \0");
+		successful_tests++;
+	}
+	// Print test result
+	printf("\n%s%lu", message, (unsigned long)atomic_load(&pipeline.end_to_end.count));
+	// End of PLT2
+
+	PipelineFree(&pipeline);
+
+	test_complete = (successful_tests == total_tests);
+
+	return test_complete;
+
+}
+
+
+/*---------------------------------------------------
+* Definition of function AcquireTestBatch()
+* Acquisition of the test: vectors of BBT1, BBT2, NT1 and NT2 (testVectors.c)
+* Parameters:
+* context: PipelineTestContext
+* slot: slot to be filled
+* Return value:
+* acquired: unsigned integer, 1 if a batch was acquired, 0 after the last batch
+------------------------------------------------------*/
+static unsigned int AcquireTestBatch(void *context, PipelineSlot *slot) {
+	// Definition of local variables
+	PipelineTestContext *test = context; // context of the test
+	const TestVector *vector = 0; // vector of the actual channel
+	unsigned int index = 0; // loop index
+	unsigned int acquired = 0; // Return value
+
+	if (test->acquired < test->batches) {
+		for (index = 0; index < 4; index++) {
+			vector = TestVectorGet(TEST_VECTOR_BBT1 + index);
+			slot->format[index] = vector->format;
+			slot->min_temp[index] = vector->min_temp;
+			slot->max_temp[index] = vector->max_temp;
+			slot->max_deltatemp[index] = vector->max_deltatemp;
+			slot->temp_sensor1[index] = vector->temp_sensor1;
+			slot->temp_sensor2[index] = vector->temp_sensor2;
+		}
+		slot->batch.count = 4;
+		test->acquired++;
+		acquired = 1;
+	}
+
+	return acquired;
+}
+
+
+/*---------------------------------------------------
+* Definition of function PublishTestBatch()
+* Publication of the test: checks order and results of the batch
+* Parameters:
+* context: PipelineTestContext
+* slot: slot with the results
+* Return value: none
+------------------------------------------------------*/
+static void PublishTestBatch(void *context, PipelineSlot *slot) {
+	// Definition of local variables
+	PipelineTestContext *test = context; // context of the test
+
+	test->in_order += (slot->sequence == test->published);
+	test->correct += ((slot->batch.count == 4) && (slot->temp_ok[0] == 7) && (slot->temp_ok[1] == 7)
+			&& (slot->temp_ok[2] == 5) && (slot->temp_ok[3] == 5));
+	test->published++;
+}
@@ -0,0 +1,28 @@
+/* ---------------------------------------------------------------------------------------------
+ * Module Name: Safe Temperature Monitoring
+ * File Name: pipeline_testing.h
+ * Corresponding Source-File: pipeline_testing.c
+ * Created on: 19.10.2026
+ * Development Group: CKN GmbH
+ * Project: FSQM SW Development Exercise
+ * Dependencies: PipelineRun(), stdio.h (hardware dependent)
+ *
+ * Description: This file contains the test cases for the pipelined monitoring of the Safe Temperature Monitoring module
+ *
+
+ * ----------------------------------------------------------------------------------------------
+ * Versions:
+ *
+ * Version: 0.1 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * Initial version, definition of functions
+ *
+ * ----------------------------------------------------------------------------------------------  */
+
+#ifndef PIPELINE_TESTING_H_
+#define PIPELINE_TESTING_H_
+
+extern unsigned int PerformPipelineTest(void);
+
+#endif /* PIPELINE_TESTING_H_ */
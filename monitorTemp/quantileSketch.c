@@ -0,0 +1,377 @@
+/* ---------------------------------------------------------------------------------------------
+* Module Name: Safe Temperature Monitoring
+* File Name: quantileSketch.c
+* Corresponding Header-File: quantileSketch.h
+* Created on: 19.10.2026
+* Development Group: CKN GmbH
+* Project: FSQM SW Development Exercise
+* Dependencies: channelStore.c, stdlib.h (memory is only allocated in QuantileSetInit())
+*
+* Description: This file contains the functions of the streaming quantile sketches.
+*
+*  quantileSketchAdd() increments one bucket: the bucket of a magnitude m below 32 is m, otherwise it is
+*  found from the highest bit e of m and the next 4 bits (16 buckets per power of two); buckets of negative
+*  values are stored in reverse order before the buckets of positive values, so the buckets are ordered by value
+*
+*  a bucket counter saturates at UINT32_MAX, a value in a saturated bucket only updates the smallest and largest
+*  value, so count is always the sum of the buckets and the ranks of the quantiles stay consistent
+*
+*  quantileSketchValue() returns the middle of the bucket, in which the quantile lies, limited to the
+*  smallest and largest added value; the quantiles 0 and 1 return these values exactly
+*
+*  quantileSetAddScan() is called after ChannelStoreScan() with the same range of channels (e.g. by the thread
+*  which scans a shard); the sketches are not protected against concurrent access, every thread uses an own
+*  set or an own range of channels, sets of different threads are combined with QuantileSetMerge()
+*
+* ----------------------------------------------------------------------------------------------
+* Versions:
+* Version: 0.1 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Initial version, log-linear sketches of delta and readings
+*
+* Version: 0.2 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Shared constants and helpers taken from monitorCommon.h
+*
+* Version: 0.3 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Delta sketched in whole degrees of the registered format, count not incremented for saturated buckets
+*
+* ----------------------------------------------------------------------------------------------*/
+
+// Include system header files
+#include <stdint.h> // stdint.h is necessary for the fixed size counters
+#include <stdlib.h> // stdlib.h is necessary for malloc/free
+#include <string.h> // string.h is necessary for memset
+// Include own header files
+#include "channelStore.h"
+#include "monitorCommon.h"
+#include "quantileSketch.h"
+
+// Definition of local (module level) constants
+// Magnitudes below EXACT_LIMIT have an own bucket (2^5)
+static const uint32_t EXACT_LIMIT = 32;
+// Highest bit of the magnitudes below EXACT_LIMIT
+static const unsigned int EXACT_BITS = 5;
+// Buckets per power of two above EXACT_LIMIT (2^4)
+static const uint32_t SUB_BUCKETS = 16;
+// Bits of the magnitude below the highest bit, which select the bucket
+static const unsigned int SUB_BITS = 4;
+// Largest value of the saturated bucket counters
+static const uint32_t COUNTER_LIMIT = UINT32_MAX;
+
+// Declaration of local (module level) functions
+static unsigned int BucketOfValue(int32_t value);
+static int32_t ValueOfBucket(unsigned int bucket);
+
+
+// Function Definitions
+
+/*---------------------------------------------------
+* Definition of function QuantileSketchReset()
+* Parameters:
+*	sketch: sketch to be emptied
+* Return value: none
+------------------------------------------------------*/
+void QuantileSketchReset(QuantileSketch *sketch) {
+
+	memset(sketch, 0, sizeof(*sketch));
+}
+
+
+/*---------------------------------------------------
+* Definition of function QuantileSketchAdd()
+* Parameters:
+*	sketch: sketch
+*	value: value in centi-degree, -32767 .. 32767
+* Return value: none
+------------------------------------------------------*/
+void QuantileSketchAdd(QuantileSketch *sketch, int16_t value) {
+
+	// Definition of local variables
+	unsigned int bucket = BucketOfValue(value);	// bucket of the value
+	uint32_t counted = (sketch->bucket[bucket] < COUNTER_LIMIT);	// 0 if the bucket is saturated
+
+	sketch->min_value = ((sketch->count == 0) || (value < sketch->min_value)) ? value : sketch->min_value;
+	sketch->max_value = ((sketch->count == 0) || (value > sketch->max_value)) ? value : sketch->max_value;
+	sketch->bucket[bucket] += counted;
+	sketch->count += counted;
+}
+
+
+/*---------------------------------------------------
+* Definition of function QuantileSketchMerge()
+* Parameters:
+*	sketch: sketch, the values of other are added
+*	other: sketch to be merged, not changed
+* Return value: none
+------------------------------------------------------*/
+void QuantileSketchMerge(QuantileSketch *sketch, const QuantileSketch *other) {
+
+	// Definition of local variables
+	unsigned int bucket = 0;			// Loop index
+	uint64_t sum = 0;					// sum of both counters
+	uint64_t count = 0;					// number of counted values of the merged sketch
+
+	if(other->count != 0)
+	{
+		sketch->min_value = ((sketch->count == 0) || (other->min_value < sketch->min_value)) ? other->min_value : sketch->min_value;
+		sketch->max_value = ((sketch->count == 0) || (other->max_value > sketch->max_value)) ? other->max_value : sketch->max_value;
+		for(bucket = 0; bucket < QUANTILE_BUCKETS; bucket++)
+		{
+			sum = (uint64_t)sketch->bucket[bucket] + other->bucket[bucket];
+			sketch->bucket[bucket] = (uint32_t)((sum > COUNTER_LIMIT) ? COUNTER_LIMIT : sum);
+			count += sketch->bucket[bucket];
+		}
+		/*values beyond a saturated counter are not counted, so count stays the sum of the buckets*/
+		sketch->count = count;
+	}
+}
+
+
+/*---------------------------------------------------
+* Definition of function QuantileSketchValue()
+* Parameters:
+*	sketch: sketch
+*	quantile: quantile 0 .. 1, e.g. 0.999 for the 99.9 % quantile
+*	value: returns the value of the quantile in centi-degree (relative error at most 1/32)
+* Return value:
+*	value_ok: unsigned integer, 1 if the sketch contains values, 0 otherwise
+------------------------------------------------------*/
+unsigned int QuantileSketchValue(const QuantileSketch *sketch, float quantile, int16_t *value) {
+
+	// Definition of local variables
+	unsigned int value_ok = 0;			// Return value, defensive programming: initialize with 0 (failure)
+	double position = 0;				// position of the quantile in the ordered values, 1 .. count
+	uint64_t rank = 0;					// rank of the quantile (position rounded up)
+	uint64_t cumulative = 0;			// number of values up to the current bucket
+	unsigned int bucket = 0;			// Loop index
+	int32_t result = 0;					// value of the bucket
+
+	if(sketch->count != 0)
+	{
+		quantile = (quantile > 0.0f) ? quantile : 0.0f;
+		quantile = (quantile < 1.0f) ? quantile : 1.0f;
+		position = (double)quantile * (double)sketch->count;
+		rank = (uint64_t)position;
+		rank += ((double)rank < position);
+		rank = (rank == 0) ? 1 : rank;
+
+		cumulative = sketch->bucket[0];
+		while((cumulative < rank) && (bucket < (QUANTILE_BUCKETS - 1)))
+		{
+			bucket++;
+			cumulative += sketch->bucket[bucket];
+		}
+
+		/*the smallest and the largest value are exact*/
+		result = ValueOfBucket(bucket);
+		result = (result < sketch->min_value) ? sketch->min_value : result;
+		result = (result > sketch->max_value) ? sketch->max_value : result;
+		result = (rank == 1) ? sketch->min_value : result;
+		result = (rank >= sketch->count) ? sketch->max_value : result;
+		*value = (int16_t)result;
+		value_ok = 1;
+	}
+
+	return value_ok;
+}
+
+
+/*---------------------------------------------------
+* Definition of function QuantileSetInit()
+* Parameters:
+*	set: sketches to be initialized
+*	capacity: maximum number of channels, at least the capacity of the channel store
+* Return value:
+*	init_ok: unsigned integer, 1 if the memory could be allocated, 0 otherwise
+------------------------------------------------------*/
+unsigned int QuantileSetInit(QuantileSet *set, unsigned int capacity) {
+
+	// Definition of local variables
+	unsigned int init_ok = 0;			// Return value, defensive programming: initialize with 0 (failure)
+	size_t size = (size_t)capacity * QUANTILE_SKETCHES * sizeof(QuantileSketch);	// size of the sketches
+
+	memset(set, 0, sizeof(*set));
+	set->memory = malloc(size + CACHE_LINE);
+
+	if(set->memory != 0)
+	{
+		set->sketch = (QuantileSketch *)AlignToCacheLine((uintptr_t)set->memory);
+		memset(set->sketch, 0, size);
+		set->capacity = capacity;
+		init_ok = 1;
+	}
+
+	return init_ok;
+}
+
+
+/*---------------------------------------------------
+* Definition of function QuantileSetFree()
+* Parameters:
+*	set: sketches initialized with QuantileSetInit()
+* Return value: none
+------------------------------------------------------*/
+void QuantileSetFree(QuantileSet *set) {
+
+	free(set->memory);
+	memset(set, 0, sizeof(*set));
+}
+
+
+/*---------------------------------------------------
+* Definition of function QuantileSetAddScan()
+* Adds delta and readings of the channels with valid readings; the delta is the difference of the magnitudes
+* in whole degrees of the registered format as compared by ChannelStoreScan(), in centi-degree of that format
+* Parameters:
+*	set: sketches initialized with QuantileSetInit()
+*	store: channel store, scanned with ChannelStoreScan()
+*	first: index of the first channel
+*	count: number of channels, limited to the registered channels and the capacity of the set
+* Return value: none
+------------------------------------------------------*/
+void QuantileSetAddScan(QuantileSet *set, const ChannelStore *store, unsigned int first, unsigned int count) {
+
+	// Definition of local variables
+	unsigned int end = first;			// channel after the last channel
+	unsigned int channel = 0;			// Loop index
+	int32_t delta = 0;					// delta between both readings
+	int32_t scale = 0;					// scan units per centi-degree of the registered format
+	QuantileSketch *sketch = 0;			// sketches of the channel
+
+	if(first < store->count)
+	{
+		end = ((store->count - first) < count) ? store->count : (first + count);
+	}
+	end = (end < set->capacity) ? end : set->capacity;
+
+	for(channel = first; channel < end; channel++)
+	{
+		if((store->temp_sensor1[channel] != INVALID_READING) && (store->temp_sensor2[channel] != INVALID_READING))
+		{
+			sketch = &set->sketch[(size_t)channel * QUANTILE_SKETCHES];
+			/*the quantity compared with max_deltatemp: magnitudes in whole degrees of the registered format*/
+			scale = (store->format[channel] == 'F') ? CHANNEL_UNITS_PER_CENTI_F : CHANNEL_UNITS_PER_CENTI_C;
+			delta = store->scan_delta[channel] / scale;
+			delta = (delta > INT16_MAX) ? INT16_MAX : delta;
+			delta = (delta < -INT16_MAX) ? -INT16_MAX : delta;
+			QuantileSketchAdd(&sketch[QUANTILE_DELTA], (int16_t)delta);
+			QuantileSketchAdd(&sketch[QUANTILE_SENSOR1], store->temp_sensor1[channel]);
+			QuantileSketchAdd(&sketch[QUANTILE_SENSOR2], store->temp_sensor2[channel]);
+		}
+	}
+}
+
+
+/*---------------------------------------------------
+* Definition of function QuantileSetMerge()
+* Merges the sketches of every channel (e.g. of another thread)
+* Parameters:
+*	set: sketches, the values of other are added
+*	other: sketches to be merged, not changed
+* Return value:
+*	merge_ok: unsigned integer, 1 if both sets have the same capacity, 0 otherwise (set not changed)
+------------------------------------------------------*/
+unsigned int QuantileSetMerge(QuantileSet *set, const QuantileSet *other) {
+
+	// Definition of local variables
+	unsigned int merge_ok = (set->capacity == other->capacity);	// Return value
+	size_t index = 0;					// Loop index
+
+	for(index = 0; (merge_ok == 1) && (index < ((size_t)set->capacity * QUANTILE_SKETCHES)); index++)
+	{
+		QuantileSketchMerge(&set->sketch[index], &other->sketch[index]);
+	}
+
+	return merge_ok;
+}
+
+
+/*---------------------------------------------------
+* Definition of function QuantileSetMergeChannels()
+* Merges one sketch of the channels first .. first + count - 1 (e.g. the delta of all channels of a machine)
+* Parameters:
+*	set: sketches initialized with QuantileSetInit()
+*	first: index of the first channel
+*	count: number of channels, limited to the capacity
+*	kind: QUANTILE_DELTA, QUANTILE_SENSOR1 or QUANTILE_SENSOR2
+*	sketch: returns the merged sketch
+* Return value: none
+------------------------------------------------------*/
+void QuantileSetMergeChannels(const QuantileSet *set, unsigned int first, unsigned int count, unsigned int kind,
+		QuantileSketch *sketch) {
+
+	// Definition of local variables
+	unsigned int end = first;			// channel after the last channel
+	unsigned int channel = 0;			// Loop index
+
+	QuantileSketchReset(sketch);
+	if((first < set->capacity) && (kind < QUANTILE_SKETCHES))
+	{
+		end = ((set->capacity - first) < count) ? set->capacity : (first + count);
+	}
+
+	for(channel = first; channel < end; channel++)
+	{
+		QuantileSketchMerge(sketch, &set->sketch[((size_t)channel * QUANTILE_SKETCHES) + kind]);
+	}
+}
+
+
+/*---------------------------------------------------
+* Definition of function BucketOfValue()
+* Parameters:
+*	value: value in centi-degree, -32767 .. 32767
+* Return value:
+*	bucket: index of the bucket, 0 .. QUANTILE_BUCKETS - 1, ordered by value
+------------------------------------------------------*/
+static unsigned int BucketOfValue(int32_t value) {
+
+	// Definition of local variables
+	uint32_t magnitude = (uint32_t)((value < 0) ? -value : value);	// magnitude of the value
+	unsigned int bit = EXACT_BITS;		// highest bit of the magnitude
+	unsigned int bucket = magnitude;	// bucket of the magnitude
+
+	if(magnitude >= EXACT_LIMIT)
+	{
+		while((magnitude >> (bit + 1)) != 0)
+		{
+			bit++;
+		}
+		bucket = EXACT_LIMIT + ((bit - EXACT_BITS) * SUB_BUCKETS) + ((magnitude >> (bit - SUB_BITS)) - SUB_BUCKETS);
+	}
+
+	return (value < 0) ? (QUANTILE_SIGN_BUCKETS - 1 - bucket) : (QUANTILE_SIGN_BUCKETS + bucket);
+}
+
+
+/*---------------------------------------------------
+* Definition of function ValueOfBucket()
+* Parameters:
+*	bucket: index of the bucket, 0 .. QUANTILE_BUCKETS - 1
+* Return value:
+*	value: middle of the bucket in centi-degree
+------------------------------------------------------*/
+static int32_t ValueOfBucket(unsigned int bucket) {
+
+	// Definition of local variables
+	unsigned int magnitude_bucket = (bucket >= QUANTILE_SIGN_BUCKETS) ?
+			(bucket - QUANTILE_SIGN_BUCKETS) : (QUANTILE_SIGN_BUCKETS - 1 - bucket);	// bucket of the magnitude
+	int32_t magnitude = (int32_t)magnitude_bucket;	// middle of the bucket
+	unsigned int shift = 0;				// width of the bucket is 2^shift
+
+	if(magnitude_bucket >= EXACT_LIMIT)
+	{
+		shift = (magnitude_bucket - EXACT_LIMIT) / SUB_BUCKETS + EXACT_BITS - SUB_BITS;
+		magnitude = (int32_t)((SUB_BUCKETS + ((magnitude_bucket - EXACT_LIMIT) % SUB_BUCKETS)) << shift);
+		magnitude += (int32_t)((1u << shift) >> 1);
+	}
+
+	return (bucket >= QUANTILE_SIGN_BUCKETS) ? magnitude : -magnitude;
+}
+
+
@@ -0,0 +1,86 @@
+/* ---------------------------------------------------------------------------------------------
+ * Module Name: Safe Temperature Monitoring
+ * File Name: quantileSketch.h
+ * Corresponding Source-File: quantileSketch.c
+ * Created on: 19.10.2026
+ * Development Group: CKN GmbH
+ * Project: FSQM SW Development Exercise
+ * Dependencies: channelStore.h, stdlib.h (memory is only allocated in QuantileSetInit())
+ *
+ * Description: This file contains the function prototypes of the streaming quantile sketches.
+ * The implementation of the functions can be found in the corresponding source file quantileSketch.c
+ *
+ *  a sketch is a log-linear histogram of centi-degree values (as in the channel store): values with a
+ *  magnitude below 0.32 degree are counted exactly, larger magnitudes in 16 buckets per power of two,
+ *  i.e. a quantile is returned with a relative error of at most 1/32 (about 3 %)
+ *
+ *  the memory of a sketch is fixed, sketches are merged by adding the counts (across threads, shards
+ *  or channels) and the result does not depend on the order of the values
+ *
+ *  every channel has three sketches: the delta as compared with max_deltatemp (magnitude of sensor 1 -
+ *  magnitude of sensor 2 in whole degrees of the registered format, in centi-degree of that format), e.g. to
+ *  set max_deltatemp from the measured 99.9 % quantile of the delta, and both readings in centi-degree
+ *  Celsius (as in the channel store); delta sketches are only merged over channels of the same format
+ * ----------------------------------------------------------------------------------------------
+ * Versions:
+ *
+ * Version: 0.1 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * Initial version, definition of functions
+ *
+ * Version: 0.2 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * Delta sketched in whole degrees of the registered format, count not incremented for saturated buckets
+ *
+ * ----------------------------------------------------------------------------------------------  */
+
+#ifndef QUANTILESKETCH_H_
+#define QUANTILESKETCH_H_
+
+#include <stdint.h>
+#include "channelStore.h"
+
+// Declaration of constants (enumeration constants, usable as array sizes)
+enum {
+	QUANTILE_SIGN_BUCKETS = 192,	// buckets of the magnitudes 0 .. 32767 centi-degree
+	QUANTILE_BUCKETS = 2 * QUANTILE_SIGN_BUCKETS	// buckets of negative and positive values
+};
+
+// Sketches of a channel
+enum {
+	QUANTILE_DELTA = 0,				// delta in whole degrees of the registered format, in centi-degree
+	QUANTILE_SENSOR1,				// reading of sensor 1
+	QUANTILE_SENSOR2,				// reading of sensor 2
+	QUANTILE_SKETCHES				// number of sketches per channel
+};
+
+// Declaration of types
+// Sketch of a distribution of centi-degree values; the buckets are ordered by value
+typedef struct {
+	uint64_t count;					// number of counted values, the sum of the buckets
+	int16_t min_value;				// smallest value, only valid if count is not 0
+	int16_t max_value;				// largest value, only valid if count is not 0
+	uint32_t bucket[QUANTILE_BUCKETS];	// number of values per bucket, saturated at UINT32_MAX
+} QuantileSketch;
+
+// Sketches of the channels; sketch[QUANTILE_SKETCHES * i + QUANTILE_...] belongs to channel i
+typedef struct {
+	QuantileSketch *sketch;			// sketches of all channels
+	unsigned int capacity;			// maximum number of channels
+	void *memory;					// memory block of the sketches
+} QuantileSet;
+
+extern void QuantileSketchReset(QuantileSketch *sketch);
+extern void QuantileSketchAdd(QuantileSketch *sketch, int16_t value);
+extern void QuantileSketchMerge(QuantileSketch *sketch, const QuantileSketch *other);
+extern unsigned int QuantileSketchValue(const QuantileSketch *sketch, float quantile, int16_t *value);
+extern unsigned int QuantileSetInit(QuantileSet *set, unsigned int capacity);
+extern void QuantileSetFree(QuantileSet *set);
+extern void QuantileSetAddScan(QuantileSet *set, const ChannelStore *store, unsigned int first, unsigned int count);
+extern unsigned int QuantileSetMerge(QuantileSet *set, const QuantileSet *other);
+extern void QuantileSetMergeChannels(const QuantileSet *set, unsigned int first, unsigned int count, unsigned int kind,
+		QuantileSketch *sketch);
+
+#endif /* QUANTILESKETCH_H_ */
@@ -0,0 +1,202 @@
+/* ---------------------------------------------------------------------------------------------
+* Module Name: Quantile Sketch Testing for QuantileSketchValue() and QuantileSetAddScan()
+* File Name: quantilesketch_testing.c
+* Corresponding Header-File: quantilesketch_testing.h
+* Created on: 19.10.2026
+* Development Group: CKN GmbH
+* Project: FSQM SW Development Exercise (Quantile Sketch Testing Functions)
+* Dependencies: QuantileSketchAdd(), QuantileSketchMerge(), QuantileSketchValue(), QuantileSetAddScan(),
+* 		stdio.h (hardware dependent)
+*
+* Description: This file contains the quantile sketch testing function
+*
+* PerformQuantileSketchTest() is a function, which checks the accuracy of the quantiles, the merge
+* of sketches and the sketches of the delta of a scanned channel store
+*
+* ----------------------------------------------------------------------------------------------
+* Versions:
+* Version: 0.1 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* 3 quantile sketch tests were implemented
+*
+* Version: 0.2 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Tests of the delta of a Fahrenheit channel and of saturated buckets were implemented
+*
+* ----------------------------------------------------------------------------------------------*/
+// Include system header files
+#include <stdio.h> // stdio.h is necessary for printing/reading via standard IO
+#include <stdlib.h> // stdlib.h is necessary for malloc/free
+#include <string.h> // string.h is necessary for string operations
+// Include own header files
+#include "channelStore.h"
+#include "quantileSketch.h"
+// Definition of global constants (only if really necessary, see coding rules)
+// No globals
+// Definition of global variables (should be avoided, see coding rules)
+// No globals
+// Definition of global and local functions (sorted by topic, if possible)
+
+/*---------------------------------------------------
+* Definition of function PerformQuantileSketchTest()
+* Parameters:
+* None
+* Return value:
+* test_complete: unsigned integer, 1 if all tests were succesful, 0 if one or more tests failed
+------------------------------------------------------*/
+unsigned int PerformQuantileSketchTest(void) {
+	// Definition of local variables
+	QuantileSketch *sketch = 0; // 3 sketches: all values, even values, odd values
+	QuantileSketch merged; // merged delta of the channels (on the stack, about 1.5 KB)
+	QuantileSet set; // sketches of the channels
+	QuantileSet other; // sketches of another store size
+	ChannelStore store; // channel store with 2 Celsius channels and 1 Fahrenheit channel
+	unsigned int channel = 0; // index of a registered channel
+	int value = 0; // Loop index
+	int16_t median = 0; // 50 % quantile
+	int16_t tail = 0; // 99.9 % quantile
+	int16_t minimum = 0; // 0 % quantile
+	int16_t maximum = 0; // 100 % quantile
+	unsigned int merge_ok = 1; // result of QuantileSetMerge()
+	char message[40]; // String array for test result message
+	unsigned int total_tests = 0; // Total number of tests
+	unsigned int successful_tests = 0; // Total number of successful test
+
+	unsigned int test_complete = 0; // 1 if all tests OK, 0 if one or more tests failed
+	// For printf() function, buffer setting (no buffering)
+	setvbuf(stdout, NULL, _IONBF, 0);
+
+	sketch = malloc(3 * sizeof(QuantileSketch));
+	if ((sketch == 0) || (ChannelStoreInit(&store, 3) == 0) || (QuantileSetInit(&set, 3) == 0)) {
+		printf("\n\nQST: memory could not be allocated\n");
+		free(sketch);
+		return 0;
+	}
+	QuantileSketchReset(&sketch[0]);
+	QuantileSketchReset(&sketch[1]);
+	QuantileSketchReset(&sketch[2]);
+	// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+	// Quantile sketch tests (QST)
+	// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+	// QST1: Quantiles of -100.00 .. 100.00 degree within the relative error of 1/32, minimum and maximum exact
+	total_tests++;
+	printf("\n\nQST1: Test with the values -10000 .. 10000 centi-degree, quantiles 0, 0.5, 0.999 and 1\n");
+	// Initialize test result message with negative test result, will only be changed if test is successful
+	strcpy(message, "QST1 FAILED, 99.9 % quantile: \0");
+	for (value = -10000; value <= 10000; value++) {
+		QuantileSketchAdd(&sketch[0], (int16_t)value);
+		QuantileSketchAdd(&sketch[1 + (value & 1)], (int16_t)value);
+	}
+	QuantileSketchValue(&sketch[0], 0.0f, &minimum);
+	QuantileSketchValue(&sketch[0], 0.5f, &median);
+	QuantileSketchValue(&sketch[0], 0.999f, &tail);
+	QuantileSketchValue(&sketch[0], 1.0f, &maximum);
+	// Expected: -10000, 0 (exact bucket), 9980 +/- 312, 10000
+	if ((minimum == -10000) && (median == 0) && (tail >= 9668) && (tail <= 10000) && (maximum == 10000)) {
+		strcpy(message, "QST1 SUCCESFUL, 99.9 % quantile: \0");
+		successful_tests++;
+	}
+	// Print test result
+	printf("\n%s%d", message, tail);
+	// End of QST1
+
+	// QST2: The merge of the sketches of the even and odd values is identical to the sketch of all values
+	total_tests++;
+	printf("\n\nQST2: Test with sketches of the even and odd values, merged\n");
+	// Initialize test result message with negative test result, will only be changed if test is successful
+	strcpy(message, "QST2 FAILED, Values: \0");
+	QuantileSketchMerge(&sketch[1], &sketch[2]);
+	// Expected: identical sketches
+	if (memcmp(&sketch[0], &sketch[1], sizeof(QuantileSketch)) == 0) {
+		strcpy(message, "QST2 SUCCESFUL, Values: \0");
+		successful_tests++;
+	}
+	// Print test result
+	printf("\n%s%d", message, (unsigned int)sketch[1].count);
+	// End of QST2
+
+	// QST3: Delta of 2 scanned channels (0 .. 9 whole degrees), merged over the channels
+	total_tests++;
+	printf("\n\nQST3: Test with 1000 scans of 2 channels, delta 0 .. 900 centi-degree, 99.9 %% quantile of both\n");
+	// Initialize test result message with negative test result, will only be changed if test is successful
+	strcpy(message, "QST3 FAILED, 99.9 % quantile: \0");
+	ChannelStoreRegister(&store, "channel 1", 'C', -10.0, 80.0, 3.0, &channel);
+	ChannelStoreRegister(&store, "channel 2", 'C', -10.0, 80.0, 3.0, &channel);
+	for (value = 0; value < 1000; value++) {
+		ChannelStoreSetReading(&store, 0, 50.0f, (float)(5000 - ((value % 10) * 100)) / 100.0f);
+		ChannelStoreSetReading(&store, 1, 20.0f, (float)(2000 - (((value * 7) % 10) * 100)) / 100.0f);
+		ChannelStoreScan(&store, 0, store.count);
+		QuantileSetAddScan(&set, &store, 0, store.count);
+	}
+	QuantileSetMergeChannels(&set, 0, 2, QUANTILE_DELTA, &merged);
+	QuantileSketchValue(&merged, 0.999f, &tail);
+	QuantileSketchValue(&set.sketch[QUANTILE_SENSOR1], 0.5f, &median);
+	if (QuantileSetInit(&other, 4) == 1) {
+		merge_ok = QuantileSetMerge(&set, &other);
+		QuantileSetFree(&other);
+	}
+	// Expected: 2000 deltas, 900 - 1/32, median of sensor 1 of channel 1 5000, sets of different size not merged
+	if ((merged.count == 2000) && (tail >= 872) && (tail <= 900) && (median == 5000) && (merge_ok == 0)) {
+		strcpy(message, "QST3 SUCCESFUL, 99.9 % quantile: \0");
+		successful_tests++;
+	}
+	// Print test result
+	printf("\n%s%d", message, tail);
+	// End of QST3
+
+	// QST4: The delta of a Fahrenheit channel is sketched in whole degrees Fahrenheit, as compared with max_deltatemp
+	total_tests++;
+	printf("\n\nQST4: Test with readings 100.0 / 96.0 degree Fahrenheit (2.22 degree Celsius), delta 400\n");
+	// Initialize test result message with negative test result, will only be changed if test is successful
+	strcpy(message, "QST4 FAILED, Delta: \0");
+	ChannelStoreRegister(&store, "channel 3", 'F', 32.0, 212.0, 3.9, &channel);
+	ChannelStoreSetReading(&store, channel, 100.0f, 96.0f);
+	ChannelStoreScan(&store, channel, 1);
+	QuantileSetAddScan(&set, &store, channel, 1);
+	QuantileSketchValue(&set.sketch[(channel * QUANTILE_SKETCHES) + QUANTILE_DELTA], 1.0f, &maximum);
+	QuantileSketchValue(&set.sketch[(channel * QUANTILE_SKETCHES) + QUANTILE_SENSOR1], 1.0f, &median);
+	// Expected: delta 4 degree Fahrenheit (alarm, 400 > 390), sensor 1 37.78 degree Celsius
+	if ((maximum == 400) && (median == 3778) && (store.temp_ok[channel] == 3)) {
+		strcpy(message, "QST4 SUCCESFUL, Delta: \0");
+		successful_tests++;
+	}
+	// Print test result
+	printf("\n%s%d", message, maximum);
+	// End of QST4
+
+	// QST5: A saturated bucket does not count further values, count stays the sum of the buckets
+	total_tests++;
+	printf("\n\nQST5: Test with a bucket at UINT32_MAX - 1, 3 values added and the sketch merged with itself\n");
+	// Initialize test result message with negative test result, will only be changed if test is successful
+	strcpy(message, "QST5 FAILED, Count: \0");
+	QuantileSketchReset(&sketch[0]);
+	QuantileSketchAdd(&sketch[0], 0);
+	sketch[0].bucket[QUANTILE_SIGN_BUCKETS] = UINT32_MAX - 1;
+	sketch[0].count = UINT32_MAX - 1;
+	QuantileSketchAdd(&sketch[0], 0);
+	QuantileSketchAdd(&sketch[0], 0);
+	QuantileSketchAdd(&sketch[0], 1);
+	sketch[1] = sketch[0];
+	QuantileSketchMerge(&sketch[0], &sketch[1]);
+	QuantileSketchValue(&sketch[0], 1.0f, &maximum);
+	// Expected: UINT32_MAX values of 0 and 2 values of 1, the largest value 1
+	if ((sketch[0].count == ((uint64_t)UINT32_MAX + 2)) && (sketch[0].bucket[QUANTILE_SIGN_BUCKETS] == UINT32_MAX)
+			&& (sketch[0].bucket[QUANTILE_SIGN_BUCKETS + 1] == 2) && (maximum == 1)) {
+		strcpy(message, "QST5 SUCCESFUL, Count: \0");
+		successful_tests++;
+	}
+	// Print test result
+	printf("\n%s%llu", message, (unsigned long long)sketch[0].count);
+	// End of QST5
+
+	free(sketch);
+	QuantileSetFree(&set);
+	ChannelStoreFree(&store);
+
+	test_complete = (successful_tests == total_tests);
+
+	return test_complete;
+
+}
@@ -0,0 +1,28 @@
+/* ---------------------------------------------------------------------------------------------
+ * Module Name: Safe Temperature Monitoring
+ * File Name: quantilesketch_testing.h
+ * Corresponding Source-File: quantilesketch_testing.c
+ * Created on: 19.10.2026
+ * Development Group: CKN GmbH
+ * Project: FSQM SW Development Exercise
+ * Dependencies: QuantileSketchAdd(), QuantileSketchValue(), stdio.h (hardware dependent)
+ *
+ * Description: This file contains the test cases for the quantile sketches of the Safe Temperature Monitoring module
+ *
+
+ * ----------------------------------------------------------------------------------------------
+ * Versions:
+ *
+ * Version: 0.1 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * Initial version, definition of functions
+ *
+ * ----------------------------------------------------------------------------------------------  */
+
+#ifndef QUANTILESKETCH_TESTING_H_
+#define QUANTILESKETCH_TESTING_H_
+
+extern unsigned int PerformQuantileSketchTest(void);
+
+#endif /* QUANTILESKETCH_TESTING_H_ */
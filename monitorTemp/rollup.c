@@ -0,0 +1,381 @@
+/* ---------------------------------------------------------------------------------------------
+* Module Name: Safe Temperature Monitoring
+* File Name: rollup.c
+* Corresponding Header-File: rollup.h
+* Created on: 19.10.2026
+* Development Group: CKN GmbH
+* Project: FSQM SW Development Exercise
+* Dependencies: channelStore.c, stdlib.h (memory is only allocated in RollupInit())
+*
+* Description: This file contains the functions of the history of the channels (tiered rollups).
+*
+*  rollupInit() allocates the buckets of all channels in one memory block, the buckets of a channel
+*  are contiguous (all tiers), so that a query of a channel reads a few cache lines only
+*
+*  rollupAdd() updates the bucket of the period of the sample in every tier; a bucket of an older period
+*  in the same slot of the ring buffer is reset first, samples older than the bucket in their slot are
+*  ignored (they belong to a period which is no longer kept)
+*
+*  rollupAddScan() adds the readings (scan arrays, in centi-degree of the registered format) and results
+*  of a range of channels after ChannelStoreScan(); the delta is taken from scan_delta, i.e. the quantity
+*  compared with max_deltatemp; channels without valid readings are not added
+*
+*  rollupQuery() uses the finest tier which covers the window; the window is rounded up to whole buckets
+*  of that tier, buckets of older periods in the ring buffer are skipped
+*
+*  the rollups are not protected against concurrent access: one thread adds, queries are made by the
+*  same thread or while no samples are added
+*
+* ----------------------------------------------------------------------------------------------
+* Versions:
+* Version: 0.1 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Initial version, 1 s, 1 min and 1 h rollups
+*
+* Version: 0.2 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Shared constants and helpers taken from monitorCommon.h
+*
+* Version: 0.3 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Rollups built from the scan readings in centi-degree of the registered format, delta taken from scan_delta, 32 bit temperatures
+*
+* ----------------------------------------------------------------------------------------------*/
+
+// Include system header files
+#include <stdint.h> // stdint.h is necessary for the fixed size buckets
+#include <stdlib.h> // stdlib.h is necessary for malloc/free
+#include <string.h> // string.h is necessary for memset
+// Include own header files
+#include "channelStore.h"
+#include "monitorCommon.h"
+#include "rollup.h"
+
+// Definition of local (module level) constants
+// Duration of a bucket of every tier in ns
+static const uint64_t TIER_DURATION_NS[ROLLUP_TIERS] = {1000000000ull, 60000000000ull, 3600000000000ull};
+// Number of buckets of every tier
+static const unsigned int TIER_SLOTS[ROLLUP_TIERS] = {ROLLUP_SECOND_SLOTS, ROLLUP_MINUTE_SLOTS, ROLLUP_HOUR_SLOTS};
+// First bucket of every tier within the buckets of a channel
+static const unsigned int TIER_OFFSET[ROLLUP_TIERS] = {0, ROLLUP_SECOND_SLOTS, ROLLUP_SECOND_SLOTS + ROLLUP_MINUTE_SLOTS};
+// Largest value of the saturated alarm counter
+static const uint16_t COUNTER_LIMIT = UINT16_MAX;
+
+// Declaration of local (module level) functions
+static unsigned int SelectTier(uint64_t window_ns, unsigned int *buckets);
+static void MergeChannel(const Rollup *rollup, unsigned int channel, unsigned int tier, uint32_t now_period,
+		unsigned int buckets, RollupSummary *summary, int64_t *sum);
+static void StartSummary(RollupSummary *summary);
+static void FinishSummary(RollupSummary *summary, int64_t sum);
+
+
+// Function Definitions
+
+/*---------------------------------------------------
+* Definition of function RollupInit()
+* Parameters:
+*	rollup: history to be initialized
+*	capacity: maximum number of channels, at least the capacity of the channel store
+* Return value:
+*	init_ok: unsigned integer, 1 if the memory could be allocated, 0 otherwise
+------------------------------------------------------*/
+unsigned int RollupInit(Rollup *rollup, unsigned int capacity) {
+
+	// Definition of local variables
+	unsigned int init_ok = 0;			// Return value, defensive programming: initialize with 0 (failure)
+	size_t size = (size_t)capacity * ROLLUP_SLOTS * sizeof(RollupBucket);	// size of the buckets
+
+	memset(rollup, 0, sizeof(*rollup));
+	rollup->memory = malloc(size + CACHE_LINE);
+
+	if(rollup->memory != 0)
+	{
+		/*count 0: all buckets are empty*/
+		rollup->bucket = (RollupBucket *)AlignToCacheLine((uintptr_t)rollup->memory);
+		memset(rollup->bucket, 0, size);
+		rollup->capacity = capacity;
+		init_ok = 1;
+	}
+
+	return init_ok;
+}
+
+
+/*---------------------------------------------------
+* Definition of function RollupFree()
+* Parameters:
+*	rollup: history initialized with RollupInit()
+* Return value: none
+------------------------------------------------------*/
+void RollupFree(Rollup *rollup) {
+
+	free(rollup->memory);
+	memset(rollup, 0, sizeof(*rollup));
+}
+
+
+/*---------------------------------------------------
+* Definition of function RollupAdd()
+* Parameters:
+*	rollup: history initialized with RollupInit()
+*	channel: index of the channel, ignored if not below the capacity
+*	timestamp_ns: time of the sample in ns (monotonic or real time, the same clock for all samples)
+*	temp: average of both readings in centi-degree of the registered format of the channel
+*	deltatemp: delta between both readings in centi-degree of the registered format
+*	temp_ok: result of the sample, 3 is counted as alarm
+* Return value: none
+------------------------------------------------------*/
+void RollupAdd(Rollup *rollup, unsigned int channel, uint64_t timestamp_ns,
+		int32_t temp, int32_t deltatemp, unsigned int temp_ok) {
+
+	// Definition of local variables
+	unsigned int tier = 0;				// Loop index
+	uint32_t period = 0;				// period of the sample in the tier
+	RollupBucket *bucket = 0;			// bucket of the period
+
+	for(tier = 0; (tier < ROLLUP_TIERS) && (channel < rollup->capacity); tier++)
+	{
+		period = (uint32_t)(timestamp_ns / TIER_DURATION_NS[tier]);
+		bucket = &rollup->bucket[((size_t)channel * ROLLUP_SLOTS) + TIER_OFFSET[tier] + (period % TIER_SLOTS[tier])];
+
+		/*a bucket of an older period is reset, a sample older than the period of the bucket is ignored*/
+		if((bucket->count == 0) || (bucket->period < period))
+		{
+			bucket->sum = 0;
+			bucket->period = period;
+			bucket->count = 0;
+			bucket->min_temp = INT32_MAX;
+			bucket->max_temp = INT32_MIN;
+			bucket->max_deltatemp = 0;
+			bucket->alarms = 0;
+		}
+		if(bucket->period == period)
+		{
+			bucket->sum += temp;
+			bucket->count++;
+			bucket->min_temp = (temp < bucket->min_temp) ? temp : bucket->min_temp;
+			bucket->max_temp = (temp > bucket->max_temp) ? temp : bucket->max_temp;
+			bucket->max_deltatemp = (deltatemp > bucket->max_deltatemp) ? deltatemp : bucket->max_deltatemp;
+			bucket->alarms += ((temp_ok == 3) && (bucket->alarms < COUNTER_LIMIT));
+		}
+	}
+}
+
+
+/*---------------------------------------------------
+* Definition of function RollupAddScan()
+* Parameters:
+*	rollup: history initialized with RollupInit()
+*	store: channel store, scanned with ChannelStoreScan()
+*	first: index of the first channel
+*	count: number of channels, limited to the registered channels
+*	timestamp_ns: time of the scan in ns
+* Return value: none
+------------------------------------------------------*/
+void RollupAddScan(Rollup *rollup, const ChannelStore *store, unsigned int first, unsigned int count, uint64_t timestamp_ns) {
+
+	// Definition of local variables
+	unsigned int end = first;			// channel after the last channel
+	unsigned int channel = 0;			// Loop index
+	int32_t sum = 0;					// sum of both readings in centi-degree of the registered format
+	int32_t delta = 0;					// delta between both readings
+	int32_t scale = 0;					// scan units per centi-degree of the registered format
+
+	if(first < store->count)
+	{
+		end = ((store->count - first) < count) ? store->count : (first + count);
+	}
+
+	for(channel = first; channel < end; channel++)
+	{
+		if((store->scan_sensor1[channel] != CHANNEL_INVALID_UNITS) && (store->scan_sensor2[channel] != CHANNEL_INVALID_UNITS))
+		{
+			/*Average as in DisplayTemp(), rounded half away from zero (see ColumnExportWriteBatch())*/
+			sum = ChannelStoreNativeCenti(store, channel, store->scan_sensor1[channel])
+					+ ChannelStoreNativeCenti(store, channel, store->scan_sensor2[channel]);
+			sum = (sum + (sum > 0) - (sum < 0)) / 2;
+			/*the quantity compared with max_deltatemp (see QuantileSetAddScan())*/
+			scale = (store->format[channel] == 'F') ? CHANNEL_UNITS_PER_CENTI_F : CHANNEL_UNITS_PER_CENTI_C;
+			delta = store->scan_delta[channel] / scale;
+			delta = (delta < 0) ? -delta : delta;
+			RollupAdd(rollup, channel, timestamp_ns, sum, delta, store->temp_ok[channel]);
+		}
+	}
+}
+
+
+/*---------------------------------------------------
+* Definition of function RollupQuery()
+* Parameters:
+*	rollup: history initialized with RollupInit()
+*	channel: index of the channel
+*	now_ns: end of the window in ns (same clock as the samples)
+*	window_ns: length of the window in ns, at most 24 h
+*	summary: returns the summary of the window (count 0 if there were no samples)
+* Return value:
+*	query_ok: unsigned integer, 1 if the window is covered by the history, 0 otherwise
+------------------------------------------------------*/
+unsigned int RollupQuery(const Rollup *rollup, unsigned int channel, uint64_t now_ns, uint64_t window_ns,
+		RollupSummary *summary) {
+
+	return RollupQueryRange(rollup, channel, 1, now_ns, window_ns, summary);
+}
+
+
+/*---------------------------------------------------
+* Definition of function RollupQueryRange()
+* Summary of the channels first .. first + count - 1 together (e.g. all channels of a machine),
+* the temperatures are only comparable for channels of the same format
+* Parameters:
+*	rollup: history initialized with RollupInit()
+*	first: index of the first channel
+*	count: number of channels, limited to the capacity
+*	now_ns: end of the window in ns (same clock as the samples)
+*	window_ns: length of the window in ns, at most 24 h
+*	summary: returns the summary of the window (count 0 if there were no samples)
+* Return value:
+*	query_ok: unsigned integer, 1 if the window is covered by the history, 0 otherwise
+------------------------------------------------------*/
+unsigned int RollupQueryRange(const Rollup *rollup, unsigned int first, unsigned int count, uint64_t now_ns,
+		uint64_t window_ns, RollupSummary *summary) {
+
+	// Definition of local variables
+	unsigned int query_ok = 0;			// Return value, defensive programming: initialize with 0 (failure)
+	unsigned int tier = 0;				// finest tier which covers the window
+	unsigned int buckets = 0;			// number of buckets of the window
+	unsigned int end = first;			// channel after the last channel
+	unsigned int channel = 0;			// Loop index
+	int64_t sum = 0;					// sum of the averages
+
+	StartSummary(summary);
+	tier = SelectTier(window_ns, &buckets);
+	if(first < rollup->capacity)
+	{
+		end = ((rollup->capacity - first) < count) ? rollup->capacity : (first + count);
+	}
+
+	if(tier < ROLLUP_TIERS)
+	{
+		for(channel = first; channel < end; channel++)
+		{
+			MergeChannel(rollup, channel, tier, (uint32_t)(now_ns / TIER_DURATION_NS[tier]), buckets, summary, &sum);
+		}
+		FinishSummary(summary, sum);
+		query_ok = 1;
+	}
+
+	return query_ok;
+}
+
+
+/*---------------------------------------------------
+* Definition of function SelectTier()
+* Parameters:
+*	window_ns: length of the window in ns
+*	buckets: returns the number of buckets of the window in the selected tier
+* Return value:
+*	tier: finest tier which covers the window, ROLLUP_TIERS if the window is longer than the history
+------------------------------------------------------*/
+static unsigned int SelectTier(uint64_t window_ns, unsigned int *buckets) {
+
+	// Definition of local variables
+	unsigned int tier = 0;				// Return value
+
+	while((tier < ROLLUP_TIERS) && (window_ns > (TIER_DURATION_NS[tier] * TIER_SLOTS[tier])))
+	{
+		tier++;
+	}
+	if(tier < ROLLUP_TIERS)
+	{
+		/*rounded up to whole buckets, at least one bucket*/
+		*buckets = (unsigned int)((window_ns + TIER_DURATION_NS[tier] - 1) / TIER_DURATION_NS[tier]);
+		*buckets = (*buckets == 0) ? 1 : *buckets;
+	}
+
+	return tier;
+}
+
+
+/*---------------------------------------------------
+* Definition of function MergeChannel()
+* Parameters:
+*	rollup: history initialized with RollupInit()
+*	channel: index of the channel
+*	tier: tier of the buckets
+*	now_period: period of the last bucket of the window
+*	buckets: number of buckets of the window
+*	summary: summary, the buckets of the window are added
+*	sum: sum of the averages, the sums of the buckets are added
+* Return value: none
+------------------------------------------------------*/
+static void MergeChannel(const Rollup *rollup, unsigned int channel, unsigned int tier, uint32_t now_period,
+		unsigned int buckets, RollupSummary *summary, int64_t *sum) {
+
+	// Definition of local variables
+	const RollupBucket *tier_buckets = &rollup->bucket[((size_t)channel * ROLLUP_SLOTS) + TIER_OFFSET[tier]];	// buckets of the tier
+	const RollupBucket *bucket = 0;		// bucket of a period
+	unsigned int age = 0;				// Loop index, age of the period in buckets
+	uint32_t period = 0;				// period of the window
+
+	for(age = 0; (age < buckets) && (age <= now_period); age++)
+	{
+		period = now_period - age;
+		bucket = &tier_buckets[period % TIER_SLOTS[tier]];
+		if((bucket->count != 0) && (bucket->period == period))
+		{
+			*sum += bucket->sum;
+			summary->count += bucket->count;
+			summary->alarms += bucket->alarms;
+			summary->min_temp = (bucket->min_temp < summary->min_temp) ? bucket->min_temp : summary->min_temp;
+			summary->max_temp = (bucket->max_temp > summary->max_temp) ? bucket->max_temp : summary->max_temp;
+			summary->max_deltatemp = (bucket->max_deltatemp > summary->max_deltatemp) ? bucket->max_deltatemp : summary->max_deltatemp;
+		}
+	}
+}
+
+
+/*---------------------------------------------------
+* Definition of function StartSummary()
+* Parameters:
+*	summary: summary to be initialized (no samples)
+* Return value: none
+------------------------------------------------------*/
+static void StartSummary(RollupSummary *summary) {
+
+	summary->count = 0;
+	summary->alarms = 0;
+	summary->min_temp = INT32_MAX;
+	summary->max_temp = INT32_MIN;
+	summary->mean_temp = 0;
+	summary->max_deltatemp = 0;
+}
+
+
+/*---------------------------------------------------
+* Definition of function FinishSummary()
+* Parameters:
+*	summary: summary of the merged buckets
+*	sum: sum of the averages of the merged buckets
+* Return value: none
+------------------------------------------------------*/
+static void FinishSummary(RollupSummary *summary, int64_t sum) {
+
+	// Definition of local variables
+	int64_t count = (int64_t)summary->count;	// number of samples
+
+	if(count != 0)
+	{
+		/*rounded half away from zero*/
+		summary->mean_temp = (int32_t)(((2 * sum) + ((sum > 0) - (sum < 0)) * count) / (2 * count));
+	}
+	else
+	{
+		summary->min_temp = 0;
+		summary->max_temp = 0;
+	}
+}
+
+
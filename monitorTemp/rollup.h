@@ -0,0 +1,94 @@
+/* ---------------------------------------------------------------------------------------------
+ * Module Name: Safe Temperature Monitoring
+ * File Name: rollup.h
+ * Corresponding Source-File: rollup.c
+ * Created on: 19.10.2026
+ * Development Group: CKN GmbH
+ * Project: FSQM SW Development Exercise
+ * Dependencies: channelStore.h, stdlib.h (memory is only allocated in RollupInit())
+ *
+ * Description: This file contains the function prototypes of the history of the channels (tiered rollups).
+ * The implementation of the functions can be found in the corresponding source file rollup.c
+ *
+ *  every channel has three ring buffers of buckets with fixed memory:
+ *  60 buckets of 1 s (last minute), 60 buckets of 1 min (last hour) and 24 buckets of 1 h (last day);
+ *  a bucket holds minimum, maximum, sum and number of the averages of both readings, the largest delta
+ *  between the readings and the number of alarms (result 3), all temperatures in centi-degree of the
+ *  registered format of the channel (as shown by DisplayTemp()); the delta is the difference of the
+ *  magnitudes in whole degrees, which is compared with max_deltatemp (see channelStore.h)
+ *
+ *  every sample updates one bucket per tier, a query combines at most 60 buckets of one tier,
+ *  the raw readings are not kept
+ * ----------------------------------------------------------------------------------------------
+ * Versions:
+ *
+ * Version: 0.1 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * Initial version, definition of functions
+ *
+ * Version: 0.2 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * Rollups built from the scan readings in centi-degree of the registered format, delta taken from scan_delta, 32 bit temperatures
+ *
+ * ----------------------------------------------------------------------------------------------  */
+
+#ifndef ROLLUP_H_
+#define ROLLUP_H_
+
+#include <stdint.h>
+#include "channelStore.h"
+
+// Declaration of constants (enumeration constants, usable as array sizes)
+enum {
+	ROLLUP_TIER_SECOND = 0,			// buckets of 1 s
+	ROLLUP_TIER_MINUTE,				// buckets of 1 min
+	ROLLUP_TIER_HOUR,				// buckets of 1 h
+	ROLLUP_TIERS,					// number of tiers
+	ROLLUP_SECOND_SLOTS = 60,		// buckets of the 1 s tier
+	ROLLUP_MINUTE_SLOTS = 60,		// buckets of the 1 min tier
+	ROLLUP_HOUR_SLOTS = 24,			// buckets of the 1 h tier
+	ROLLUP_SLOTS = ROLLUP_SECOND_SLOTS + ROLLUP_MINUTE_SLOTS + ROLLUP_HOUR_SLOTS	// buckets per channel
+};
+
+// Declaration of types
+// Bucket of a tier; a bucket belongs to the period timestamp / duration of the tier
+typedef struct {
+	int64_t sum;					// sum of the averages
+	uint32_t period;				// period of the bucket, the bucket is empty if count is 0
+	uint32_t count;					// number of samples
+	int32_t min_temp;				// smallest average
+	int32_t max_temp;				// largest average
+	int32_t max_deltatemp;			// largest delta between sensor 1 and sensor 2
+	uint16_t alarms;				// number of samples with result 3 (saturated)
+} RollupBucket;
+
+// Summary of a time window
+typedef struct {
+	uint64_t count;					// number of samples, the other values are only valid if count is not 0
+	uint64_t alarms;				// number of samples with result 3
+	int32_t min_temp;				// smallest average
+	int32_t max_temp;				// largest average
+	int32_t mean_temp;				// mean of the averages, rounded
+	int32_t max_deltatemp;			// largest delta between sensor 1 and sensor 2
+} RollupSummary;
+
+// History of the channels; the buckets of channel i are bucket[i * ROLLUP_SLOTS] .. (all tiers)
+typedef struct {
+	RollupBucket *bucket;			// buckets of all channels
+	unsigned int capacity;			// maximum number of channels
+	void *memory;					// memory block of the buckets
+} Rollup;
+
+extern unsigned int RollupInit(Rollup *rollup, unsigned int capacity);
+extern void RollupFree(Rollup *rollup);
+extern void RollupAdd(Rollup *rollup, unsigned int channel, uint64_t timestamp_ns,
+		int32_t temp, int32_t deltatemp, unsigned int temp_ok);
+extern void RollupAddScan(Rollup *rollup, const ChannelStore *store, unsigned int first, unsigned int count, uint64_t timestamp_ns);
+extern unsigned int RollupQuery(const Rollup *rollup, unsigned int channel, uint64_t now_ns, uint64_t window_ns,
+		RollupSummary *summary);
+extern unsigned int RollupQueryRange(const Rollup *rollup, unsigned int first, unsigned int count, uint64_t now_ns,
+		uint64_t window_ns, RollupSummary *summary);
+
+#endif /* ROLLUP_H_ */
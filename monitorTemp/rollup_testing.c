@@ -0,0 +1,178 @@
+/* ---------------------------------------------------------------------------------------------
+* Module Name: Rollup Testing for RollupAddScan() and RollupQuery()
+* File Name: rollup_testing.c
+* Corresponding Header-File: rollup_testing.h
+* Created on: 19.10.2026
+* Development Group: CKN GmbH
+* Project: FSQM SW Development Exercise (Rollup Testing Functions)
+* Dependencies: RollupAddScan(), RollupAdd(), RollupQuery(), stdio.h (hardware dependent)
+*
+* Description: This file contains the rollup testing function
+*
+* PerformRollupTest() is a function, which adds 2 minutes of scans of a channel store to the history
+* and checks the summaries of the last minute and the last hour, the ring buffers, the window limit
+* and the summary of a Fahrenheit channel
+*
+* ----------------------------------------------------------------------------------------------
+* Versions:
+* Version: 0.1 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* 3 rollup tests were implemented
+*
+* Version: 0.2 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* RUT1 expects the delta in whole degrees as compared with max_deltatemp, RUT4 (Fahrenheit channel) added
+*
+* ----------------------------------------------------------------------------------------------*/
+// Include system header files
+#include <stdio.h> // stdio.h is necessary for printing/reading via standard IO
+#include <string.h> // string.h is necessary for string operations
+// Include own header files
+#include "channelStore.h"
+#include "rollup.h"
+// Definition of global constants (only if really necessary, see coding rules)
+// No globals
+// Definition of global variables (should be avoided, see coding rules)
+// No globals
+// Definition of global and local functions (sorted by topic, if possible)
+
+/*---------------------------------------------------
+* Definition of function PerformRollupTest()
+* Parameters:
+* None
+* Return value:
+* test_complete: unsigned integer, 1 if all tests were succesful, 0 if one or more tests failed
+------------------------------------------------------*/
+unsigned int PerformRollupTest(void) {
+	// Definition of local variables
+	const uint64_t second = 1000000000ull; // 1 s in ns
+	const uint64_t start = 1000 * second; // time of the first scan
+	Rollup rollup; // history under test
+	ChannelStore store; // channel store with 3 channels, the second one without readings, the third one in °F
+	RollupSummary summary; // summary of a window
+	RollupSummary range; // summary of both channels
+	unsigned int channel = 0; // index of a registered channel
+	unsigned int scan = 0; // Loop index
+	unsigned int query_ok = 0; // result of RollupQuery()
+	char message[40]; // String array for test result message
+	unsigned int total_tests = 0; // Total number of tests
+	unsigned int successful_tests = 0; // Total number of successful test
+
+	unsigned int test_complete = 0; // 1 if all tests OK, 0 if one or more tests failed
+	// For printf() function, buffer setting (no buffering)
+	setvbuf(stdout, NULL, _IONBF, 0);
+
+	if (ChannelStoreInit(&store, 3) == 0) {
+		printf("\n\nRUT: channel store could not be allocated\n");
+		return 0;
+	}
+	if (RollupInit(&rollup, 3) == 0) {
+		printf("\n\nRUT: history could not be allocated\n");
+		ChannelStoreFree(&store);
+		return 0;
+	}
+	ChannelStoreRegister(&store, "ramp", 'C', -10.0, 80.0, 3.0, &channel);
+	ChannelStoreRegister(&store, "no reading", 'C', -10.0, 80.0, 3.0, &channel);
+	ChannelStoreRegister(&store, "oven", 'F', 32.0, 500.0, 5.0, &channel);
+	// 120 scans in 1 s steps: ramp 20.00 .. 30.90 °C with delta 0.5 °C, the last 10 scans at 85 °C (alarm)
+	for (scan = 0; scan < 120; scan++) {
+		if (scan < 110) {
+			ChannelStoreSetReading(&store, 0, (float)(2000 + (10 * scan)) / 100.0f, (float)(2050 + (10 * scan)) / 100.0f);
+		} else {
+			ChannelStoreSetReading(&store, 0, 85.0f, 85.0f);
+		}
+		ChannelStoreScan(&store, 0, store.count);
+		RollupAddScan(&rollup, &store, 0, store.count, start + (scan * second));
+	}
+	// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+	// Rollup tests (RUT)
+	// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+	// RUT1: Summary of the last minute (1 s tier) and of the last hour (1 min tier)
+	total_tests++;
+	printf("\n\nRUT1: Test with 120 scans, summary of the last 60 s and of the last hour\n");
+	// Initialize test result message with negative test result, will only be changed if test is successful
+	strcpy(message, "RUT1 FAILED, Samples: \0");
+	query_ok = RollupQuery(&rollup, 0, start + (119 * second), 60 * second, &summary);
+	// Expected: scans 60 .. 119, averages 26.25 .. 31.15 and 10 x 85.00 (mean 38.08), 10 alarms,
+	// delta 1 whole degree (e.g. 26.50 and 27.00 °C are compared as 26 and 27 °C)
+	if ((query_ok == 1) && (summary.count == 60) && (summary.alarms == 10) && (summary.min_temp == 2625)
+			&& (summary.max_temp == 8500) && (summary.mean_temp == 3808) && (summary.max_deltatemp == 100)) {
+		query_ok = RollupQuery(&rollup, 0, start + (119 * second), 3600 * second, &summary);
+		// Expected: all 120 scans, first average 20.25
+		if ((query_ok == 1) && (summary.count == 120) && (summary.alarms == 10) && (summary.min_temp == 2025)) {
+			strcpy(message, "RUT1 SUCCESFUL, Samples: \0");
+			successful_tests++;
+		}
+	}
+	// Print test result
+	printf("\n%s%d", message, (unsigned int)summary.count);
+	// End of RUT1
+
+	// RUT2: Both channels together, the channel without readings has no samples; a window of 2 days is rejected
+	total_tests++;
+	printf("\n\nRUT2: Test with both channels and with a window of 2 days\n");
+	// Initialize test result message with negative test result, will only be changed if test is successful
+	strcpy(message, "RUT2 FAILED, Return value: \0");
+	RollupQuery(&rollup, 1, start + (119 * second), 60 * second, &summary);
+	RollupQueryRange(&rollup, 0, 2, start + (119 * second), 60 * second, &range);
+	query_ok = RollupQuery(&rollup, 0, start + (119 * second), 48 * 3600 * second, &summary);
+	// Expected: no samples of channel 1, 60 samples of both channels, return value 0 for 2 days
+	if ((query_ok == 0) && (summary.count == 0) && (range.count == 60) && (range.max_temp == 8500)) {
+		strcpy(message, "RUT2 SUCCESFUL, Return value: \0");
+		successful_tests++;
+	}
+	// Print test result
+	printf("\n%s%d", message, query_ok);
+	// End of RUT2
+
+	// RUT3: Ring buffer: a bucket of the same slot one minute later replaces the old one, older samples are ignored
+	total_tests++;
+	printf("\n\nRUT3: Test with samples at 5 s, 65 s and again at 5 s, summary of the last 60 s at 65 s\n");
+	// Initialize test result message with negative test result, will only be changed if test is successful
+	strcpy(message, "RUT3 FAILED, Samples: \0");
+	RollupAdd(&rollup, 1, 5 * second, 2000, 0, 7);
+	RollupAdd(&rollup, 1, 65 * second, 2100, 0, 3);
+	RollupAdd(&rollup, 1, 5 * second, 2000, 0, 7);
+	RollupQuery(&rollup, 1, 65 * second, 60 * second, &summary);
+	// Expected: only the sample at 65 s
+	if ((summary.count == 1) && (summary.alarms == 1) && (summary.mean_temp == 2100)) {
+		strcpy(message, "RUT3 SUCCESFUL, Samples: \0");
+		successful_tests++;
+	}
+	// Print test result
+	printf("\n%s%d", message, (unsigned int)summary.count);
+	// End of RUT3
+
+	// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+	// RUT4: Fahrenheit channel, averages in centi-degree Fahrenheit (beyond 16 bit) and delta in whole degrees Fahrenheit
+	total_tests++;
+	printf("\n\nRUT4: Test with the Fahrenheit channel, 100.50/98.00 F and 450.00/450.00 F\n");
+	// Initialize test result message with negative test result, will only be changed if test is successful
+	strcpy(message, "RUT4 FAILED, Samples: \0");
+	ChannelStoreSetReading(&store, 2, 100.5f, 98.0f);
+	ChannelStoreScan(&store, 2, 1);
+	RollupAddScan(&rollup, &store, 2, 1, start + (200 * second));
+	ChannelStoreSetReading(&store, 2, 450.0f, 450.0f);
+	ChannelStoreScan(&store, 2, 1);
+	RollupAddScan(&rollup, &store, 2, 1, start + (201 * second));
+	query_ok = RollupQuery(&rollup, 2, start + (201 * second), 60 * second, &summary);
+	// Expected: averages 99.25 and 450.00 F (mean 274.63 F), delta 2 F (100 F and 98 F), no alarm
+	if ((query_ok == 1) && (summary.count == 2) && (summary.alarms == 0) && (summary.min_temp == 9925)
+			&& (summary.max_temp == 45000) && (summary.mean_temp == 27463) && (summary.max_deltatemp == 200)) {
+		strcpy(message, "RUT4 SUCCESFUL, Samples: \0");
+		successful_tests++;
+	}
+	// Print test result
+	printf("\n%s%d", message, (unsigned int)summary.count);
+	// End of RUT4
+
+	RollupFree(&rollup);
+	ChannelStoreFree(&store);
+
+	test_complete = (successful_tests == total_tests);
+
+	return test_complete;
+
+}
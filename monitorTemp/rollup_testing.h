@@ -0,0 +1,28 @@
+/* ---------------------------------------------------------------------------------------------
+ * Module Name: Safe Temperature Monitoring
+ * File Name: rollup_testing.h
+ * Corresponding Source-File: rollup_testing.c
+ * Created on: 19.10.2026
+ * Development Group: CKN GmbH
+ * Project: FSQM SW Development Exercise
+ * Dependencies: RollupAdd(), RollupQuery(), stdio.h (hardware dependent)
+ *
+ * Description: This file contains the test cases for the history rollups of the Safe Temperature Monitoring module
+ *
+
+ * ----------------------------------------------------------------------------------------------
+ * Versions:
+ *
+ * Version: 0.1 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * Initial version, definition of functions
+ *
+ * ----------------------------------------------------------------------------------------------  */
+
+#ifndef ROLLUP_TESTING_H_
+#define ROLLUP_TESTING_H_
+
+extern unsigned int PerformRollupTest(void);
+
+#endif /* ROLLUP_TESTING_H_ */
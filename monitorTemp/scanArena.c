@@ -0,0 +1,297 @@
+/* ---------------------------------------------------------------------------------------------
+* Module Name: Safe Temperature Monitoring
+* File Name: scanArena.c
+* Corresponding Header-File: scanArena.h
+* Created on: 19.10.2026
+* Development Group: CKN GmbH
+* Project: FSQM SW Development Exercise
+* Dependencies: stdlib.h (memory is only allocated in ScanArenaInit() and EventPoolInit())
+*
+* Description: This file contains the functions of the preallocated memory for the scan loop.
+*
+*  scanArenaSizeFor() returns the size of the scratch memory for one cycle of a batch of channels
+*
+*  scanArenaAlloc() takes memory from the arena (cache line aligned), scanArenaReset() releases
+*  all memory of the cycle in O(1)
+*
+*  eventPoolAcquire() and eventPoolRelease() take and return a record in O(1); a flag per record marks the
+*  acquired records, so a record which is released twice or a pointer from outside the pool is rejected
+*  and cannot corrupt the free list
+*
+* ----------------------------------------------------------------------------------------------
+* Versions:
+* Version: 0.1 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Initial version, scan arena and event pool
+*
+* Version: 0.2 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Shared constants and helpers taken from monitorCommon.h
+*
+* Version: 0.3 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Heap call counters removed, EventPoolRelease() rejects double release and foreign records
+*
+* Version: 0.4 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Size of the event pool checked for overflow, heap calls counted by heapcheck/scanArena_heapcheck.c
+*
+* ----------------------------------------------------------------------------------------------*/
+
+// Include system header files
+#include <stdint.h> // stdint.h is necessary for the alignment of addresses and SIZE_MAX
+#include <stdlib.h> // stdlib.h is necessary for malloc/free
+#include <string.h> // string.h is necessary for memset
+// Include own header files
+#include "scanArena.h"
+#include "monitorCommon.h"
+
+// Definition of local (module level) constants
+// Size of a cache line, every allocation starts at a cache line: see monitorCommon.h
+
+// Declaration of local (module level) functions
+// None
+
+// Function Definitions
+
+/*---------------------------------------------------
+* Definition of function ScanArenaSizeFor()
+* Parameters:
+*	channel_count: number of channels of a batch
+* Return value:
+*	size: size in bytes of the scratch memory of one cycle: the batch (TempBatch arrays),
+*		the results and the scratch arrays of both channels of the dual channel evaluation
+------------------------------------------------------*/
+size_t ScanArenaSizeFor(unsigned int channel_count) {
+
+	// Definition of local variables
+	size_t size = 0;					// Return value
+
+	size += AlignToCacheLine(channel_count * sizeof(char));				// format
+	size += 5 * AlignToCacheLine(channel_count * sizeof(float));		// limits and readings
+	size += 3 * AlignToCacheLine(channel_count * sizeof(unsigned int));	// results, channel A and B
+
+	return size;
+}
+
+
+/*---------------------------------------------------
+* Definition of function ScanArenaInit()
+* Parameters:
+*	arena: arena to be initialized
+*	size: usable size in bytes, see ScanArenaSizeFor()
+* Return value:
+*	init_ok: unsigned integer, 1 if the memory could be allocated, 0 otherwise
+------------------------------------------------------*/
+unsigned int ScanArenaInit(ScanArena *arena, size_t size) {
+
+	// Definition of local variables
+	unsigned int init_ok = 0;			// Return value, defensive programming: initialize with 0 (failure)
+
+	memset(arena, 0, sizeof(*arena));
+	if(size <= (SIZE_MAX - CACHE_LINE))
+	{
+		arena->block = malloc(size + CACHE_LINE);
+	}
+
+	if(arena->block != 0)
+	{
+		arena->memory = (unsigned char *)AlignToCacheLine((uintptr_t)arena->block);
+		arena->capacity = size;
+		init_ok = 1;
+	}
+
+	return init_ok;
+}
+
+
+/*---------------------------------------------------
+* Definition of function ScanArenaFree()
+* Parameters:
+*	arena: arena initialized with ScanArenaInit()
+* Return value: none
+------------------------------------------------------*/
+void ScanArenaFree(ScanArena *arena) {
+
+	free(arena->block);
+	arena->block = 0;
+	arena->memory = 0;
+	arena->capacity = 0;
+	arena->used = 0;
+}
+
+
+/*---------------------------------------------------
+* Definition of function ScanArenaAlloc()
+* Parameters:
+*	arena: arena initialized with ScanArenaInit()
+*	size: size in bytes
+* Return value:
+*	memory: cache line aligned memory, valid until the next ScanArenaReset(), 0 if the arena is exhausted
+------------------------------------------------------*/
+void *ScanArenaAlloc(ScanArena *arena, size_t size) {
+
+	// Definition of local variables
+	void *memory = 0;					// Return value, defensive programming: initialize with 0 (failure)
+	size_t aligned = AlignToCacheLine(size);	// size rounded up to a cache line
+
+	if(aligned <= (arena->capacity - arena->used))
+	{
+		memory = arena->memory + arena->used;
+		arena->used += aligned;
+		arena->allocations++;
+		if(arena->used > arena->high_water)
+		{
+			arena->high_water = arena->used;
+		}
+	}
+	else
+	{
+		arena->failures++;
+	}
+
+	return memory;
+}
+
+
+/*---------------------------------------------------
+* Definition of function ScanArenaReset()
+* Releases all memory of the actual cycle, the memory is not cleared
+* Parameters:
+*	arena: arena initialized with ScanArenaInit()
+* Return value: none
+------------------------------------------------------*/
+void ScanArenaReset(ScanArena *arena) {
+
+	arena->used = 0;
+	arena->resets++;
+}
+
+
+/*---------------------------------------------------
+* Definition of function EventPoolInit()
+* Parameters:
+*	pool: event pool to be initialized
+*	capacity: number of event records, e.g. number of channels (one event per channel and cycle)
+* Return value:
+*	init_ok: unsigned integer, 1 if the memory could be allocated, 0 otherwise (also if the size overflows)
+------------------------------------------------------*/
+unsigned int EventPoolInit(EventPool *pool, unsigned int capacity) {
+
+	// Definition of local variables
+	unsigned int init_ok = 0;			// Return value, defensive programming: initialize with 0 (failure)
+	unsigned int index = 0;				// Loop index
+	size_t record_size = sizeof(ScanEvent) + sizeof(unsigned int) + sizeof(unsigned char);	// bytes per record
+
+	memset(pool, 0, sizeof(*pool));
+	/*The size of the block must not overflow (size_t may have 32 bit)*/
+	if(capacity <= (SIZE_MAX / record_size))
+	{
+		pool->records = malloc(capacity * record_size);
+	}
+
+	if(pool->records != 0)
+	{
+		/*The free list and the flags are placed behind the records, in the same memory block*/
+		pool->free_list = (unsigned int *)(pool->records + capacity);
+		pool->in_use = (unsigned char *)(pool->free_list + capacity);
+		for(index = 0; index < capacity; index++)
+		{
+			pool->free_list[index] = capacity - 1 - index;
+			pool->in_use[index] = 0;
+		}
+		pool->free_count = capacity;
+		pool->capacity = capacity;
+		init_ok = 1;
+	}
+
+	return init_ok;
+}
+
+
+/*---------------------------------------------------
+* Definition of function EventPoolFree()
+* Parameters:
+*	pool: event pool initialized with EventPoolInit()
+* Return value: none
+------------------------------------------------------*/
+void EventPoolFree(EventPool *pool) {
+
+	free(pool->records);
+	pool->records = 0;
+	pool->free_list = 0;
+	pool->in_use = 0;
+	pool->free_count = 0;
+	pool->capacity = 0;
+}
+
+
+/*---------------------------------------------------
+* Definition of function EventPoolAcquire()
+* Parameters:
+*	pool: event pool initialized with EventPoolInit()
+* Return value:
+*	event: free event record, 0 if all records are in use
+------------------------------------------------------*/
+ScanEvent *EventPoolAcquire(EventPool *pool) {
+
+	// Definition of local variables
+	ScanEvent *event = 0;				// Return value, defensive programming: initialize with 0 (failure)
+
+	if(pool->free_count > 0)
+	{
+		pool->free_count--;
+		event = &pool->records[pool->free_list[pool->free_count]];
+		pool->in_use[pool->free_list[pool->free_count]] = 1;
+		pool->acquired++;
+	}
+	else
+	{
+		pool->failures++;
+	}
+
+	return event;
+}
+
+
+/*---------------------------------------------------
+* Definition of function EventPoolRelease()
+* Parameters:
+*	pool: event pool initialized with EventPoolInit()
+*	event: record acquired with EventPoolAcquire() from the same pool
+* Return value:
+*	release_ok: unsigned integer, 1 if the record was returned to the pool,
+*		0 if it is not a record of the pool or is already free (pool not changed)
+------------------------------------------------------*/
+unsigned int EventPoolRelease(EventPool *pool, ScanEvent *event) {
+
+	// Definition of local variables
+	unsigned int release_ok = 0;		// Return value, defensive programming: initialize with 0 (failure)
+	uintptr_t offset = (uintptr_t)event - (uintptr_t)pool->records;	// offset of the record in the pool
+	unsigned int index = 0;				// index of the record
+
+	/*The address is compared as an integer, a record of another pool is not within the records*/
+	if((event != 0) && (pool->records != 0) && ((uintptr_t)event >= (uintptr_t)pool->records)
+			&& (offset < ((uintptr_t)pool->capacity * sizeof(ScanEvent))) && ((offset % sizeof(ScanEvent)) == 0))
+	{
+		index = (unsigned int)(offset / sizeof(ScanEvent));
+		if(pool->in_use[index] == 1)
+		{
+			pool->in_use[index] = 0;
+			pool->free_list[pool->free_count] = index;
+			pool->free_count++;
+			pool->released++;
+			release_ok = 1;
+		}
+	}
+	pool->rejected += 1u - release_ok;
+
+	return release_ok;
+}
+
+
+// End of file scanArena.c
@@ -0,0 +1,95 @@
+/* ---------------------------------------------------------------------------------------------
+ * Module Name: Safe Temperature Monitoring
+ * File Name: scanArena.h
+ * Corresponding Source-File: scanArena.c
+ * Created on: 19.10.2026
+ * Development Group: CKN GmbH
+ * Project: FSQM SW Development Exercise
+ * Dependencies: stdlib.h (memory is only allocated in ScanArenaInit() and EventPoolInit())
+ *
+ * Description: This file contains the function prototypes of the preallocated memory for the
+ * scan loop. The implementation of the functions can be found in the corresponding source file scanArena.c
+ *
+ *  the scan arena provides scratch memory for one cycle (readings, results, scratch arrays of the
+ *  dual channel evaluation); all memory of a cycle is released at once by ScanArenaReset()
+ *
+ *  the event pool provides fixed size event records, which can be acquired and released individually;
+ *  a record is only taken back once and only from its own pool
+ *
+ *  both are allocated once at startup; afterwards no heap function is called (the pipeline takes the
+ *  scratch memory and the events of every batch from them, see pipeline.h), which is verified by the
+ *  separate program heapcheck/scanArena_heapcheck.c with linker wrapped heap functions
+ * ----------------------------------------------------------------------------------------------
+ * Versions:
+ *
+ * Version: 0.1 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * Initial version, definition of functions
+ *
+ * Version: 0.2 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * Heap call counters removed, EventPoolRelease() rejects double release and foreign records
+ *
+ * Version: 0.3 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * Size of the event pool checked for overflow, heap calls counted by heapcheck/scanArena_heapcheck.c
+ *
+ * ----------------------------------------------------------------------------------------------  */
+
+#ifndef SCANARENA_H_
+#define SCANARENA_H_
+
+#include <stddef.h>
+
+// Declaration of types
+// Scratch memory of one cycle, released at once
+typedef struct {
+	unsigned char *memory;			// start of the (cache line aligned) memory
+	void *block;					// memory block as returned by malloc
+	size_t capacity;				// usable size in bytes
+	size_t used;					// bytes allocated in the actual cycle
+	// counters
+	unsigned long allocations;		// number of successful allocations
+	unsigned long failures;			// number of allocations which did not fit
+	unsigned long resets;			// number of cycles
+	size_t high_water;				// maximum of used over all cycles
+} ScanArena;
+
+// Event of a channel, e.g. change of the result
+typedef struct {
+	unsigned long cycle;			// cycle in which the event occurred
+	unsigned int channel;			// index of the channel
+	unsigned int temp_ok;			// result of the channel, 7, 3 or 5
+	float temp_sensor1;				// reading of sensor 1
+	float temp_sensor2;				// reading of sensor 2
+} ScanEvent;
+
+// Pool of event records
+typedef struct {
+	ScanEvent *records;				// all event records
+	unsigned int *free_list;		// indices of the free records (stack)
+	unsigned char *in_use;			// 1 for every acquired record
+	unsigned int free_count;		// number of free records
+	unsigned int capacity;			// number of records
+	// counters
+	unsigned long acquired;			// number of acquired records
+	unsigned long released;			// number of released records
+	unsigned long failures;			// number of acquisitions with empty pool
+	unsigned long rejected;			// number of releases of free records or records of another pool
+} EventPool;
+
+extern size_t ScanArenaSizeFor(unsigned int channel_count);
+extern unsigned int ScanArenaInit(ScanArena *arena, size_t size);
+extern void ScanArenaFree(ScanArena *arena);
+extern void *ScanArenaAlloc(ScanArena *arena, size_t size);
+extern void ScanArenaReset(ScanArena *arena);
+
+extern unsigned int EventPoolInit(EventPool *pool, unsigned int capacity);
+extern void EventPoolFree(EventPool *pool);
+extern ScanEvent *EventPoolAcquire(EventPool *pool);
+extern unsigned int EventPoolRelease(EventPool *pool, ScanEvent *event);
+
+#endif /* SCANARENA_H_ */
@@ -0,0 +1,290 @@
+/* ---------------------------------------------------------------------------------------------
+* Module Name: Scan Arena Testing for ScanArenaAlloc() and EventPoolAcquire()
+* File Name: scanarena_testing.c
+* Corresponding Header-File: scanarena_testing.h
+* Created on: 19.10.2026
+* Development Group: CKN GmbH
+* Project: FSQM SW Development Exercise (Scan Arena Testing Functions)
+* Dependencies: ScanArenaAlloc(), EventPoolAcquire(), EventPoolRelease(), PipelineRun(), EvaluateTemp(),
+* 		TestVectorGet(), stdio.h (hardware dependent)
+*
+* Description: This file contains the testing function for the preallocated scan memory
+*
+* PerformScanArenaTest() is a function, which runs several scan cycles with memory from the arena
+* and checks that every cycle gets the same memory, that the event pool is bounded and only takes back
+* its own acquired records, and that the pipeline takes the events of its batches from the pools
+*
+* the heap calls are not counted here (the allocator of this test program is shared by all tests),
+* see heapcheck/scanArena_heapcheck.c
+*
+* ----------------------------------------------------------------------------------------------
+* Versions:
+* Version: 0.1 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* 2 scan arena tests were implemented
+*
+* Version: 0.2 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Heap calls counted by an interposed allocator, release and pipeline tests added
+*
+* Version: 0.3 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Vectors taken from the shared table of testVectors.c
+*
+* Version: 0.4 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Counting of the heap calls moved to the separate program heapcheck/scanArena_heapcheck.c, overflow test added
+*
+* ----------------------------------------------------------------------------------------------*/
+// Include system header files
+#include <stdint.h> // stdint.h is necessary for SIZE_MAX
+#include <stdio.h> // stdio.h is necessary for printing/reading via standard IO
+#include <string.h> // string.h is necessary for string operations
+// Include own header files
+#include "monitorTemp.h"
+#include "scanArena.h"
+#include "pipeline.h"
+#include "testVectors.h"
+// Definition of global constants (only if really necessary, see coding rules)
+// No globals
+// Definition of global variables (should be avoided, see coding rules)
+// No globals
+
+// Declaration of types
+// Context of the test functions of the pipeline
+typedef struct {
+	unsigned long acquired; // number of acquired batches
+	unsigned long batches; // number of batches to be acquired
+	unsigned long events; // number of published events
+	unsigned long wrong_events; // number of events with wrong channel, cycle or result
+} ScanArenaTestContext;
+
+// Definition of global and local functions (sorted by topic, if possible)
+static unsigned int AcquireTestBatch(void *context, PipelineSlot *slot);
+static void PublishTestBatch(void *context, PipelineSlot *slot);
+
+/*---------------------------------------------------
+* Definition of function PerformScanArenaTest()
+* Parameters:
+* None
+* Return value:
+* test_complete: unsigned integer, 1 if all tests were succesful, 0 if one or more tests failed
+------------------------------------------------------*/
+unsigned int PerformScanArenaTest(void) {
+	// Definition of local variables
+	ScanArena arena; // scratch memory of the cycles
+	ScanArena huge; // arena with a size which cannot be allocated
+	EventPool pool; // event records
+	ScanEvent *event[3]; // acquired event records
+	ScanEvent foreign; // event record, which does not belong to the pool
+	ScanArenaTestContext context = {0, 50, 0, 0}; // context of the test functions of the pipeline
+	Pipeline pipeline; // pipeline with scan arena and event pool in every slot
+	unsigned int released = 0; // number of accepted releases
+	unsigned int huge_ok = 1; // result of the initialization of huge
+	unsigned int free_records = 0; // number of free records of the pool before the releases
+	unsigned long batches = 0; // number of published batches
+	float *readings = 0; // readings of one cycle, taken from the arena
+	unsigned int *temp_ok = 0; // results of one cycle, taken from the arena
+	void *first_cycle = 0; // memory of the first cycle
+	unsigned int same_memory = 1; // 1 if every cycle got the same memory
+	unsigned int cycle = 0; // loop index over the cycles
+	unsigned int index = 0; // loop index over the channels
+	char message[40]; // String array for test result message
+	unsigned int total_tests = 0; // Total number of tests
+	unsigned int successful_tests = 0; // Total number of successful test
+
+	unsigned int test_complete = 0; // 1 if all tests OK, 0 if one or more tests failed
+	// For printf() function, buffer setting (no buffering)
+	setvbuf(stdout, NULL, _IONBF, 0);
+
+	if ((ScanArenaInit(&arena, ScanArenaSizeFor(100)) == 0) || (EventPoolInit(&pool, 2) == 0)) {
+		printf("\n\nSAT: scan memory could not be allocated\n");
+		ScanArenaFree(&arena);
+		return 0;
+	}
+	// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+	// Scan arena tests (SAT)
+	// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+	// SAT1: 10 cycles with 100 channels, every cycle gets the same memory from the arena
+	total_tests++;
+	printf("\n\nSAT1: Test with 10 cycles of 100 channels, the same memory in every cycle\n");
+	// Initialize test result message with negative test result, will only be changed if test is successful
+	strcpy(message, "SAT1 FAILED, Allocations: \0");
+	for (cycle = 0; cycle < 10; cycle++) {
+		ScanArenaReset(&arena);
+		readings = ScanArenaAlloc(&arena, 100 * sizeof(float));
+		temp_ok = ScanArenaAlloc(&arena, 100 * sizeof(unsigned int));
+		if ((readings == 0) || (temp_ok == 0)) {
+			same_memory = 0;
+			break;
+		}
+		if (cycle == 0) {
+			first_cycle = readings;
+		}
+		same_memory &= ((void *)readings == first_cycle);
+		for (index = 0; index < 100; index++) {
+			readings[index] = 20.0f + (float)cycle;
+			temp_ok[index] = EvaluateTemp('C', -10.0, 80.0, 3.0, readings[index], readings[index]);
+		}
+	}
+	// Expected: 20 allocations, no failure, the same memory in every cycle
+	if ((arena.allocations == 20) && (arena.failures == 0) && (same_memory == 1) && (arena.resets == 10)) {
+		strcpy(message, "SAT1 SUCCESFUL, Allocations: \0");
+		successful_tests++;
+	}
+	// Print test result
+	printf("\n%s%lu", message, arena.allocations);
+	// End of SAT1
+
+	// SAT2: Event pool with 2 records, the third acquisition fails until a record is released
+	total_tests++;
+	printf("\n\nSAT2: Test with event pool of 2 records, bounded and reusable\n");
+	// Initialize test result message with negative test result, will only be changed if test is successful
+	strcpy(message, "SAT2 FAILED, Failures: \0");
+	event[0] = EventPoolAcquire(&pool);
+	event[1] = EventPoolAcquire(&pool);
+	event[2] = EventPoolAcquire(&pool);
+	same_memory = (event[2] == 0);
+	released = EventPoolRelease(&pool, event[1]);
+	event[2] = EventPoolAcquire(&pool);
+	// Expected: 1 failure, the released record is acquired again
+	if ((same_memory == 1) && (event[0] != 0) && (released == 1) && (event[2] == event[1]) && (pool.failures == 1)) {
+		strcpy(message, "SAT2 SUCCESFUL, Failures: \0");
+		successful_tests++;
+	}
+	// Print test result
+	printf("\n%s%lu", message, pool.failures);
+	// End of SAT2
+
+	// SAT3: Double release and records which do not belong to the pool are rejected
+	total_tests++;
+	printf("\n\nSAT3: Test with double release, foreign and misaligned record\n");
+	// Initialize test result message with negative test result, will only be changed if test is successful
+	strcpy(message, "SAT3 FAILED, Rejected: \0");
+	released = EventPoolRelease(&pool, event[0]);
+	released += EventPoolRelease(&pool, event[0]);
+	released += EventPoolRelease(&pool, &foreign);
+	released += EventPoolRelease(&pool, (ScanEvent *)((unsigned char *)event[2] + 1));
+	released += EventPoolRelease(&pool, 0);
+	free_records = pool.free_count;
+	// Expected: only the first release accepted, 4 rejected, the free records unchanged, only one record acquired again
+	event[0] = EventPoolAcquire(&pool);
+	event[1] = EventPoolAcquire(&pool);
+	if ((released == 1) && (pool.rejected == 4) && (free_records == 1) && (pool.free_count == 0) && (event[0] != 0)
+			&& (event[1] == 0)) {
+		strcpy(message, "SAT3 SUCCESFUL, Rejected: \0");
+		successful_tests++;
+	}
+	// Print test result
+	printf("\n%s%lu", message, pool.rejected);
+	// End of SAT3
+
+	// SAT4: The pipeline evaluates with scan arena and event pool of the slots
+	total_tests++;
+	printf("\n\nSAT4: Test with 50 pipeline batches of 4 channels, 2 events per batch from the event pools\n");
+	// Initialize test result message with negative test result, will only be changed if test is successful
+	strcpy(message, "SAT4 FAILED, Events: \0");
+	same_memory = 0;
+	if (PipelineInit(&pipeline, 3, 4, AcquireTestBatch, 0, PublishTestBatch, &context) == 1) {
+		batches = PipelineRun(&pipeline);
+		same_memory = 1;
+		for (index = 0; index < pipeline.slot_count; index++) {
+			same_memory &= (pipeline.slots[index].events.free_count == pipeline.slots[index].events.capacity)
+					&& (pipeline.slots[index].events.rejected == 0) && (pipeline.slots[index].arena.failures == 0);
+		}
+		PipelineFree(&pipeline);
+	}
+	// Expected: 50 batches with 2 correct events each, all events released, no arena failure
+	if ((batches == 50) && (context.events == 100) && (context.wrong_events == 0) && (same_memory == 1)) {
+		strcpy(message, "SAT4 SUCCESFUL, Events: \0");
+		successful_tests++;
+	}
+	// Print test result
+	printf("\n%s%lu", message, context.events);
+	// End of SAT4
+
+	// SAT5: A size which would overflow with the alignment reserve is rejected
+	total_tests++;
+	printf("\n\nSAT5: Test with an arena of SIZE_MAX bytes, no overflow of the allocated size\n");
+	// Initialize test result message with negative test result, will only be changed if test is successful
+	strcpy(message, "SAT5 FAILED, Init: \0");
+	huge_ok = ScanArenaInit(&huge, SIZE_MAX);
+	// Expected: initialization fails, no memory
+	if ((huge_ok == 0) && (huge.block == 0) && (huge.capacity == 0)) {
+		strcpy(message, "SAT5 SUCCESFUL, Init: \0");
+		successful_tests++;
+	}
+	ScanArenaFree(&huge);
+	// Print test result
+	printf("\n%s%u", message, huge_ok);
+	// End of SAT5
+
+	EventPoolFree(&pool);
+	ScanArenaFree(&arena);
+
+	test_complete = (successful_tests == total_tests);
+
+	return test_complete;
+
+}
+
+
+/*---------------------------------------------------
+* Definition of function AcquireTestBatch()
+* Acquisition of the test: vectors of BBT1, BBT2, NT1 and NT2 (testVectors.c), channels 2 and 3 with failure
+* Parameters:
+* context: ScanArenaTestContext
+* slot: slot to be filled
+* Return value:
+* acquired: unsigned integer, 1 if a batch was acquired, 0 after the last batch
+------------------------------------------------------*/
+static unsigned int AcquireTestBatch(void *context, PipelineSlot *slot) {
+	// Definition of local variables
+	ScanArenaTestContext *test = context; // context of the test
+	const TestVector *vector = 0; // vector of the actual channel
+	unsigned int index = 0; // loop index
+	unsigned int acquired = 0; // Return value
+
+	if (test->acquired < test->batches) {
+		for (index = 0; index < 4; index++) {
+			vector = TestVectorGet(TEST_VECTOR_BBT1 + index);
+			slot->format[index] = vector->format;
+			slot->min_temp[index] = vector->min_temp;
+			slot->max_temp[index] = vector->max_temp;
+			slot->max_deltatemp[index] = vector->max_deltatemp;
+			slot->temp_sensor1[index] = vector->temp_sensor1;
+			slot->temp_sensor2[index] = vector->temp_sensor2;
+		}
+		slot->batch.count = 4;
+		test->acquired++;
+		acquired = 1;
+	}
+
+	return acquired;
+}
+
+
+/*---------------------------------------------------
+* Definition of function PublishTestBatch()
+* Publication of the test: checks the events of the batch
+* Parameters:
+* context: ScanArenaTestContext
+* slot: slot with the results and events
+* Return value: none
+------------------------------------------------------*/
+static void PublishTestBatch(void *context, PipelineSlot *slot) {
+	// Definition of local variables
+	ScanArenaTestContext *test = context; // context of the test
+	unsigned int index = 0; // loop index over the events
+
+	for (index = 0; index < slot->event_count; index++) {
+		test->wrong_events += (slot->event[index]->cycle != slot->sequence) || (slot->event[index]->channel != index + 2)
+				|| (slot->event[index]->temp_ok != 5);
+	}
+	test->wrong_events += (slot->event_count != 2);
+	test->events += slot->event_count;
+}
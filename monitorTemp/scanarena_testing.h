@@ -0,0 +1,28 @@
+/* ---------------------------------------------------------------------------------------------
+ * Module Name: Safe Temperature Monitoring
+ * File Name: scanarena_testing.h
+ * Corresponding Source-File: scanarena_testing.c
+ * Created on: 19.10.2026
+ * Development Group: CKN GmbH
+ * Project: FSQM SW Development Exercise
+ * Dependencies: ScanArenaAlloc(), EventPoolAcquire(), stdio.h (hardware dependent)
+ *
+ * Description: This file contains the test cases for the preallocated scan memory of the Safe Temperature Monitoring module
+ *
+
+ * ----------------------------------------------------------------------------------------------
+ * Versions:
+ *
+ * Version: 0.1 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * Initial version, definition of functions
+ *
+ * ----------------------------------------------------------------------------------------------  */
+
+#ifndef SCANARENA_TESTING_H_
+#define SCANARENA_TESTING_H_
+
+extern unsigned int PerformScanArenaTest(void);
+
+#endif /* SCANARENA_TESTING_H_ */
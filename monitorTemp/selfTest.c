@@ -0,0 +1,490 @@
+/* ---------------------------------------------------------------------------------------------
+* Module Name: Safe Temperature Monitoring
+* File Name: selfTest.c
+* Corresponding Header-File: selfTest.h
+* Created on: 19.10.2026
+* Development Group: CKN GmbH
+* Project: FSQM SW Development Exercise
+* Dependencies: monitorTemp.c, dualChannel.c, telemetry.c, testVectors.c, POSIX threads (link with -pthread),
+* 		SCHED_IDLE and pthread_setaffinity_np() only on Linux (hardware dependent)
+*
+* Description: This file contains the functions of the periodic self-test (diagnostics).
+*
+*  selfTestRunSlice() evaluates groups of SELF_TEST_GROUP vectors with ValidateTempBatch() and EvaluateTemp()
+*  until the time budget of the slice is used up or the pass is complete; nothing is printed
+*
+*  the fixed vectors are the vectors of the test functions (BBT1, BBT2, NT1, NT2, BT1, BT2, ST1, ST2,
+*  CCT1, CCT2, WBT3, WBT4), taken from the table of testVectors.c; the randomized vectors use a grid of
+*  0.25 degree (exact in float), so that the expected result of EvaluateTempFixed() does not depend on
+*  rounding; the limits and readings also exceed the absolute limits and every 8th vector has exchanged
+*  limits, so that all checks are used
+*
+*  selfTestStart() starts the background thread with the lowest priority (SCHED_IDLE on Linux), which
+*  executes the configured number of slices evenly spread over every interval; after the pass of an interval
+*  is complete, the remaining slices of the interval are skipped; an interval, which starts before the
+*  previous pass is complete, is counted as overrun (the budget is too small for the number of vectors)
+*
+* ----------------------------------------------------------------------------------------------
+* Versions:
+* Version: 0.1 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Initial version, fixed and randomized known-answer vectors in time limited slices
+*
+* Version: 0.2 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Timed wait on CLOCK_MONOTONIC, fixed vectors taken from testVectors.c
+*
+* Version: 0.3 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* _GNU_SOURCE only defined if not given by the build
+*
+* ----------------------------------------------------------------------------------------------*/
+
+// Include system header files
+// SCHED_IDLE and pthread_setaffinity_np() are GNU extensions, they are only used on Linux
+#if defined(__linux__)
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include <sched.h>
+#endif
+#include <pthread.h> // pthread.h is necessary for the background thread
+#include <stdint.h> // stdint.h is necessary for the fixed size values
+#include <string.h> // string.h is necessary for memset
+#include <time.h> // time.h is necessary for the timed wait
+// Include own header files
+#include "monitorTemp.h"
+#include "dualChannel.h"
+#include "telemetry.h"
+#include "testVectors.h"
+#include "selfTest.h"
+
+// Definition of local (module level) constants
+// Range of the randomized temperatures in 0.25 degree, beyond the absolute limits
+static const int32_t RANDOM_MIN_C = -280 * 4;
+static const int32_t RANDOM_MAX_C = 1010 * 4;
+static const int32_t RANDOM_MIN_F = -470 * 4;
+static const int32_t RANDOM_MAX_F = 1850 * 4;
+// Largest randomized delta and largest distance of a reading from the limits in 0.25 degree
+static const int32_t RANDOM_DELTA = 60 * 4;
+static const int32_t RANDOM_MARGIN = 20 * 4;
+// Largest randomized difference between both readings in 0.25 degree
+static const int32_t RANDOM_SPREAD = 8 * 4;
+
+// Declaration of local (module level) functions
+static void *SelfTestThread(void *argument);
+static void GetVector(SelfTest *test, unsigned int index, TestVector *vector);
+static int32_t RandomQuarter(uint32_t *state, int32_t low, int32_t high);
+static void WaitUntil(SelfTest *test, uint64_t deadline);
+static void LowerPriority(void);
+static void PinToCore(int core);
+
+
+// Function Definitions
+
+/*---------------------------------------------------
+* Definition of function SelfTestInit()
+* Parameters:
+*	test: self-test to be initialized
+*	config: configuration, interval_ns and slices must not be 0, seed must not be 0
+* Return value:
+*	init_ok: unsigned integer, 1 if the configuration is valid and the lock was created, 0 otherwise
+------------------------------------------------------*/
+unsigned int SelfTestInit(SelfTest *test, const SelfTestConfig *config) {
+
+	// Definition of local variables
+	unsigned int init_ok = 0;			// Return value, defensive programming: initialize with 0 (failure)
+	pthread_condattr_t attributes;		// attributes of wake, timed waits on CLOCK_MONOTONIC
+	unsigned int wake_ok = 0;			// 1 if wake was created
+
+	memset(test, 0, sizeof(*test));
+	if((config->interval_ns != 0) && (config->slices != 0) && (config->seed != 0)
+			&& (pthread_mutex_init(&test->lock, 0) == 0))
+	{
+		/*The deadlines are monotonic (TelemetryNow()), a change of the system time must not shift them*/
+		if(pthread_condattr_init(&attributes) == 0)
+		{
+			wake_ok = (pthread_condattr_setclock(&attributes, CLOCK_MONOTONIC) == 0)
+					&& (pthread_cond_init(&test->wake, &attributes) == 0);
+			pthread_condattr_destroy(&attributes);
+		}
+		if(wake_ok == 1)
+		{
+			test->config = *config;
+			test->random_state = config->seed;
+			init_ok = 1;
+		}
+		else
+		{
+			pthread_mutex_destroy(&test->lock);
+		}
+	}
+
+	return init_ok;
+}
+
+
+/*---------------------------------------------------
+* Definition of function SelfTestRunSlice()
+* Tests groups of vectors until the time budget is used up or the pass is complete;
+* must not be called while the background thread is running
+* Parameters:
+*	test: self-test initialized with SelfTestInit()
+* Return value:
+*	tested: number of tested vectors
+------------------------------------------------------*/
+unsigned int SelfTestRunSlice(SelfTest *test) {
+
+	// Definition of local variables
+	unsigned int tested = 0;			// Return value, number of tested vectors
+	unsigned int total = SELF_TEST_FIXED_VECTORS + test->config.random_vectors;	// vectors of a pass
+	uint64_t start = TelemetryNow();	// start of the slice
+	uint64_t elapsed = 0;				// duration of the slice
+	unsigned int pass_complete = 0;		// 1 if the last vector of the pass was tested
+	unsigned long failures = 0;			// wrong results of the slice
+	unsigned int last_failure = 0;		// index of the last wrong result
+	unsigned int group = 0;				// number of vectors of the group
+	unsigned int index = 0;				// Loop index
+	TestVector vector[SELF_TEST_GROUP];	// vectors of the group
+	char format[SELF_TEST_GROUP];		// parameters of the group for ValidateTempBatch()
+	float min_temp[SELF_TEST_GROUP];
+	float max_temp[SELF_TEST_GROUP];
+	float max_deltatemp[SELF_TEST_GROUP];
+	float temp_sensor1[SELF_TEST_GROUP];
+	float temp_sensor2[SELF_TEST_GROUP];
+	unsigned int violation_mask[SELF_TEST_GROUP];	// masks of ValidateTempBatch()
+	unsigned int temp_ok[SELF_TEST_GROUP];	// results of ValidateTempBatch()
+	TempBatch batch = {format, min_temp, max_temp, max_deltatemp, temp_sensor1, temp_sensor2, 0};	// group as batch
+
+	do
+	{
+		group = ((total - test->next) < SELF_TEST_GROUP) ? (total - test->next) : SELF_TEST_GROUP;
+		for(index = 0; index < group; index++)
+		{
+			GetVector(test, test->next + index, &vector[index]);
+			format[index] = vector[index].format;
+			min_temp[index] = vector[index].min_temp;
+			max_temp[index] = vector[index].max_temp;
+			max_deltatemp[index] = vector[index].max_deltatemp;
+			temp_sensor1[index] = vector[index].temp_sensor1;
+			temp_sensor2[index] = vector[index].temp_sensor2;
+		}
+		batch.count = group;
+		ValidateTempBatch(&batch, violation_mask, temp_ok);
+
+		/*Batch path and single evaluation must both return the expected result*/
+		for(index = 0; index < group; index++)
+		{
+			if((temp_ok[index] != vector[index].expected)
+					|| (EvaluateTemp(format[index], min_temp[index], max_temp[index], max_deltatemp[index],
+							temp_sensor1[index], temp_sensor2[index]) != vector[index].expected))
+			{
+				failures++;
+				last_failure = test->next + index;
+			}
+		}
+
+		test->next += group;
+		tested += group;
+		if(test->next >= total)
+		{
+			test->next = 0;
+			pass_complete = 1;
+		}
+		elapsed = TelemetryNow() - start;
+	} while((pass_complete == 0) && (elapsed < test->config.slice_budget_ns));
+
+	pthread_mutex_lock(&test->lock);
+	test->status.slices++;
+	test->status.tested += tested;
+	test->status.failures += failures;
+	test->status.last_failure = (failures != 0) ? last_failure : test->status.last_failure;
+	test->status.passes += pass_complete;
+	test->status.last_pass_ns = (pass_complete == 1) ? (start + elapsed) : test->status.last_pass_ns;
+	test->status.coverage = (pass_complete == 1) ? 1000 : (unsigned int)(((uint64_t)test->next * 1000) / total);
+	test->status.max_slice_ns = (elapsed > test->status.max_slice_ns) ? elapsed : test->status.max_slice_ns;
+	pthread_mutex_unlock(&test->lock);
+
+	return tested;
+}
+
+
+/*---------------------------------------------------
+* Definition of function SelfTestStart()
+* Parameters:
+*	test: self-test initialized with SelfTestInit()
+* Return value:
+*	start_ok: unsigned integer, 1 if the background thread was started, 0 otherwise
+------------------------------------------------------*/
+unsigned int SelfTestStart(SelfTest *test) {
+
+	// Definition of local variables
+	unsigned int start_ok = 0;			// Return value, defensive programming: initialize with 0 (failure)
+
+	pthread_mutex_lock(&test->lock);
+	test->shutdown = 0;
+	if((test->running == 0) && (pthread_create(&test->thread, 0, SelfTestThread, test) == 0))
+	{
+		test->running = 1;
+		start_ok = 1;
+	}
+	pthread_mutex_unlock(&test->lock);
+
+	return start_ok;
+}
+
+
+/*---------------------------------------------------
+* Definition of function SelfTestStop()
+* Stops the background thread (after the actual slice) and waits for its end
+* Parameters:
+*	test: self-test initialized with SelfTestInit()
+* Return value: none
+------------------------------------------------------*/
+void SelfTestStop(SelfTest *test) {
+
+	// Definition of local variables
+	unsigned int running = 0;			// 1 if the background thread was started
+
+	pthread_mutex_lock(&test->lock);
+	running = test->running;
+	test->shutdown = 1;
+	pthread_cond_broadcast(&test->wake);
+	pthread_mutex_unlock(&test->lock);
+
+	if(running == 1)
+	{
+		pthread_join(test->thread, 0);
+		pthread_mutex_lock(&test->lock);
+		test->running = 0;
+		pthread_mutex_unlock(&test->lock);
+	}
+}
+
+
+/*---------------------------------------------------
+* Definition of function SelfTestFree()
+* Stops the background thread (if it was started) and releases the lock
+* Parameters:
+*	test: self-test initialized with SelfTestInit()
+* Return value: none
+------------------------------------------------------*/
+void SelfTestFree(SelfTest *test) {
+
+	SelfTestStop(test);
+	pthread_cond_destroy(&test->wake);
+	pthread_mutex_destroy(&test->lock);
+}
+
+
+/*---------------------------------------------------
+* Definition of function SelfTestGetStatus()
+* Parameters:
+*	test: self-test initialized with SelfTestInit()
+*	status: returns a consistent copy of the status
+* Return value: none
+------------------------------------------------------*/
+void SelfTestGetStatus(SelfTest *test, SelfTestStatus *status) {
+
+	pthread_mutex_lock(&test->lock);
+	*status = test->status;
+	pthread_mutex_unlock(&test->lock);
+}
+
+
+/*---------------------------------------------------
+* Definition of function SelfTestThread()
+* Parameters:
+*	argument: self-test
+* Return value:
+*	0
+------------------------------------------------------*/
+static void *SelfTestThread(void *argument) {
+
+	// Definition of local variables
+	SelfTest *test = argument;			// self-test of the thread
+	uint64_t period = test->config.interval_ns / test->config.slices;	// time between two slices
+	uint64_t interval_start = 0;		// start of the actual interval
+	unsigned long passes = 0;			// completed passes at the start of the interval
+	unsigned int slice = 0;				// Loop index
+
+	LowerPriority();
+	PinToCore(test->config.core);
+
+	pthread_mutex_lock(&test->lock);
+	while(test->shutdown == 0)
+	{
+		/*next is only changed by this thread*/
+		test->status.overruns += (test->next != 0);
+		passes = test->status.passes;
+		interval_start = TelemetryNow();
+
+		for(slice = 0; (slice < test->config.slices) && (test->shutdown == 0); slice++)
+		{
+			if(test->status.passes == passes)
+			{
+				pthread_mutex_unlock(&test->lock);
+				SelfTestRunSlice(test);
+				pthread_mutex_lock(&test->lock);
+			}
+			WaitUntil(test, interval_start + ((slice + 1) * period));
+		}
+	}
+	pthread_mutex_unlock(&test->lock);
+
+	return 0;
+}
+
+
+/*---------------------------------------------------
+* Definition of function GetVector()
+* Parameters:
+*	test: self-test
+*	index: index of the vector in the pass, the fixed vectors first
+*	vector: returns the vector; a randomized vector is generated with the next random numbers
+* Return value: none
+------------------------------------------------------*/
+static void GetVector(SelfTest *test, unsigned int index, TestVector *vector) {
+
+	// Definition of local variables
+	uint32_t *state = &test->random_state;	// state of the generator
+	unsigned int fahrenheit = 0;		// 1 for a vector in Fahrenheit
+	int32_t low = 0;					// lowest randomized temperature
+	int32_t high = 0;					// highest randomized temperature
+	int32_t limit_a = 0;				// randomized limits
+	int32_t limit_b = 0;
+	int32_t reading = 0;				// randomized reading of sensor 1
+
+	if(index < SELF_TEST_FIXED_VECTORS)
+	{
+		*vector = *TestVectorGet(index);
+	}
+	else
+	{
+		fahrenheit = (unsigned int)RandomQuarter(state, 0, 1);
+		low = (fahrenheit == 1) ? RANDOM_MIN_F : RANDOM_MIN_C;
+		high = (fahrenheit == 1) ? RANDOM_MAX_F : RANDOM_MAX_C;
+		limit_a = RandomQuarter(state, low, high);
+		limit_b = RandomQuarter(state, low, high);
+		/*limits in order, exchanged for every 8th vector*/
+		if((limit_a > limit_b) != (RandomQuarter(state, 0, 7) == 0))
+		{
+			reading = limit_a;
+			limit_a = limit_b;
+			limit_b = reading;
+		}
+		reading = RandomQuarter(state, ((limit_a < limit_b) ? limit_a : limit_b) - RANDOM_MARGIN,
+				((limit_a < limit_b) ? limit_b : limit_a) + RANDOM_MARGIN);
+
+		vector->format = (fahrenheit == 1) ? 'F' : 'C';
+		vector->min_temp = (float)limit_a / 4.0f;
+		vector->max_temp = (float)limit_b / 4.0f;
+		vector->max_deltatemp = (float)RandomQuarter(state, 0, RANDOM_DELTA) / 4.0f;
+		vector->temp_sensor1 = (float)reading / 4.0f;
+		vector->temp_sensor2 = (float)(reading + RandomQuarter(state, -RANDOM_SPREAD, RANDOM_SPREAD)) / 4.0f;
+		vector->expected = EvaluateTempFixed(vector->format, vector->min_temp, vector->max_temp, vector->max_deltatemp,
+				vector->temp_sensor1, vector->temp_sensor2);
+	}
+}
+
+
+/*---------------------------------------------------
+* Definition of function RandomQuarter()
+* Parameters:
+*	state: state of the generator (xorshift32), not 0
+*	low: lowest value
+*	high: highest value
+* Return value:
+*	value: random value low .. high
+------------------------------------------------------*/
+static int32_t RandomQuarter(uint32_t *state, int32_t low, int32_t high) {
+
+	*state ^= *state << 13;
+	*state ^= *state >> 17;
+	*state ^= *state << 5;
+
+	return low + (int32_t)(*state % (uint32_t)(high - low + 1));
+}
+
+
+/*---------------------------------------------------
+* Definition of function WaitUntil()
+* Waits with the lock held until the deadline or until the self-test is stopped
+* Parameters:
+*	test: self-test, lock is held by the caller
+*	deadline: end of the wait (TelemetryNow())
+* Return value: none
+------------------------------------------------------*/
+static void WaitUntil(SelfTest *test, uint64_t deadline) {
+
+	// Definition of local variables
+	uint64_t now = TelemetryNow();		// actual time
+	uint64_t remaining = 0;				// time until the deadline in ns
+	struct timespec until;				// deadline of pthread_cond_timedwait() (CLOCK_MONOTONIC, clock of wake)
+
+	while((test->shutdown == 0) && (now < deadline))
+	{
+		remaining = deadline - now;
+		clock_gettime(CLOCK_MONOTONIC, &until);
+		until.tv_sec += (time_t)(remaining / 1000000000u);
+		until.tv_nsec += (long)(remaining % 1000000000u);
+		if(until.tv_nsec >= 1000000000L)
+		{
+			until.tv_sec++;
+			until.tv_nsec -= 1000000000L;
+		}
+		(void)pthread_cond_timedwait(&test->wake, &test->lock, &until);
+		now = TelemetryNow();
+	}
+}
+
+
+/*---------------------------------------------------
+* Definition of function LowerPriority()
+* WARNING: LowerPriority() is hardware dependent, the priority is only lowered on Linux
+* Parameters: none
+* Return value: none
+------------------------------------------------------*/
+static void LowerPriority(void) {
+
+#if defined(__linux__)
+	// Definition of local variables
+	struct sched_param param;			// priority, must be 0 for SCHED_IDLE
+
+	memset(&param, 0, sizeof(param));
+	/*If the policy cannot be changed, the thread runs with normal priority*/
+	(void)pthread_setschedparam(pthread_self(), SCHED_IDLE, &param);
+#endif
+}
+
+
+/*---------------------------------------------------
+* Definition of function PinToCore()
+* WARNING: PinToCore() is hardware dependent, the thread is only pinned on Linux
+* Parameters:
+*	core: core for the calling thread, negative for no pinning
+* Return value: none
+------------------------------------------------------*/
+static void PinToCore(int core) {
+
+#if defined(__linux__)
+	// Definition of local variables
+	cpu_set_t cpus;						// set containing only the requested core
+
+	if(core >= 0)
+	{
+		CPU_ZERO(&cpus);
+		CPU_SET(core, &cpus);
+		/*If pinning fails (e.g. core not available), the thread runs unpinned*/
+		(void)pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus);
+	}
+#else
+	(void)core;
+#endif
+}
+
+
+// End of file selfTest.c
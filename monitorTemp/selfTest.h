@@ -0,0 +1,99 @@
+/* ---------------------------------------------------------------------------------------------
+ * Module Name: Safe Temperature Monitoring
+ * File Name: selfTest.h
+ * Corresponding Source-File: selfTest.c
+ * Created on: 19.10.2026
+ * Development Group: CKN GmbH
+ * Project: FSQM SW Development Exercise
+ * Dependencies: monitorTemp.h, dualChannel.h (EvaluateTempFixed() as reference), telemetry.h (TelemetryNow()),
+ * 		testVectors.h (vectors of the test functions),
+ * 		POSIX threads (link with -pthread), low priority and pinning of the thread only on Linux (hardware dependent)
+ *
+ * Description: This file contains the function prototypes of the periodic self-test (diagnostics).
+ * The implementation of the functions can be found in the corresponding source file selfTest.c
+ *
+ *  every diagnostic interval, one pass of test vectors is evaluated with the production functions
+ *  ValidateTempBatch() and EvaluateTemp() and compared with the expected results:
+ *  the vectors of the black box, negative, boundary, statistical, code coverage and white box tests
+ *  and randomized known-answer vectors, whose expected result is calculated with the diverse
+ *  fixed point implementation EvaluateTempFixed()
+ *
+ *  the pass is spread over the interval in slices; a slice ends as soon as its time budget is used up,
+ *  so the self-test never takes more than slices * slice_budget_ns per interval
+ *
+ *  the slices are executed by a background thread with the lowest priority (SelfTestStart()) or by the
+ *  application itself, e.g. in idle time of the scan loop (SelfTestRunSlice());
+ *  the application must check the status (failures) and bring the system into the safe state
+ * ----------------------------------------------------------------------------------------------
+ * Versions:
+ *
+ * Version: 0.1 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * Initial version, definition of functions
+ *
+ * Version: 0.2 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * Timed wait on CLOCK_MONOTONIC, fixed vectors taken from testVectors.c
+ *
+ * ----------------------------------------------------------------------------------------------  */
+
+#ifndef SELFTEST_H_
+#define SELFTEST_H_
+
+#include <pthread.h>
+#include <stdint.h>
+#include "testVectors.h"
+
+// Declaration of constants (enumeration constants, usable as array sizes)
+enum {
+	SELF_TEST_FIXED_VECTORS = TEST_VECTOR_COUNT,	// vectors of the test functions, tested first in every pass
+	SELF_TEST_GROUP = 8				// vectors evaluated between two checks of the time budget
+};
+
+// Declaration of types
+// Configuration of the self-test
+typedef struct {
+	uint64_t interval_ns;			// diagnostic interval, every vector is tested once per interval
+	uint64_t slice_budget_ns;		// maximum time of a slice (at least one group of vectors is tested)
+	unsigned int slices;			// number of slices per interval, spread evenly over the interval
+	unsigned int random_vectors;	// randomized known-answer vectors per pass
+	uint32_t seed;					// seed of the randomized vectors, must not be 0
+	int core;						// core of the background thread, negative: no pinning
+} SelfTestConfig;
+
+// Status of the self-test
+typedef struct {
+	unsigned long passes;			// completed passes (all vectors tested)
+	unsigned long failures;			// vectors with a wrong result (all passes)
+	unsigned long overruns;			// intervals which started before the previous pass was complete
+	unsigned long slices;			// executed slices
+	unsigned long long tested;		// tested vectors (all passes)
+	unsigned int coverage;			// tested vectors of the actual pass in per mille
+	unsigned int last_failure;		// index of the last failed vector in its pass (fixed vectors first)
+	uint64_t last_pass_ns;			// end of the last completed pass (TelemetryNow()), 0 if there is none
+	uint64_t max_slice_ns;			// longest slice
+} SelfTestStatus;
+
+// Self-test; the status is protected by lock, the other members belong to the thread executing the slices
+typedef struct {
+	SelfTestConfig config;			// configuration
+	SelfTestStatus status;			// status, read with SelfTestGetStatus()
+	unsigned int next;				// next vector of the actual pass
+	uint32_t random_state;			// state of the generator of the randomized vectors
+	pthread_t thread;				// background thread
+	pthread_mutex_t lock;			// protects status, running and shutdown
+	pthread_cond_t wake;			// signalled to stop the background thread, timed waits on CLOCK_MONOTONIC
+	unsigned int running;			// 1 if the background thread was started
+	unsigned int shutdown;			// 1 if the background thread shall terminate
+} SelfTest;
+
+extern unsigned int SelfTestInit(SelfTest *test, const SelfTestConfig *config);
+extern unsigned int SelfTestRunSlice(SelfTest *test);
+extern unsigned int SelfTestStart(SelfTest *test);
+extern void SelfTestStop(SelfTest *test);
+extern void SelfTestFree(SelfTest *test);
+extern void SelfTestGetStatus(SelfTest *test, SelfTestStatus *status);
+
+#endif /* SELFTEST_H_ */
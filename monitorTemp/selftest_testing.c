@@ -0,0 +1,173 @@
+/* ---------------------------------------------------------------------------------------------
+* Module Name: Self-Test Testing for SelfTestRunSlice() and SelfTestStart()
+* File Name: selftest_testing.c
+* Corresponding Header-File: selftest_testing.h
+* Created on: 19.10.2026
+* Development Group: CKN GmbH
+* Project: FSQM SW Development Exercise (Self-Test Testing Functions)
+* Dependencies: SelfTestRunSlice(), SelfTestStart(), SelfTestGetStatus(), TestVectorGet(), EvaluateTemp(),
+* 		stdio.h (hardware dependent), nanosleep() (POSIX)
+*
+* Description: This file contains the self-test testing function
+*
+* PerformSelfTestTest() is a function, which runs complete passes of the self-test in slices
+* with and without time budget and in the background thread, and checks the fixed vectors of the
+* self-test (testVectors.c) against EvaluateTemp()
+*
+* ----------------------------------------------------------------------------------------------
+* Versions:
+* Version: 0.1 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* 3 self-test tests were implemented
+*
+* Version: 0.2 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* STT4 checks the expected results of the fixed vectors against EvaluateTemp()
+*
+* ----------------------------------------------------------------------------------------------*/
+// Include system header files
+#include <stdio.h> // stdio.h is necessary for printing/reading via standard IO
+#include <string.h> // string.h is necessary for string operations
+#include <time.h> // time.h is necessary for nanosleep
+// Include own header files
+#include "monitorTemp.h"
+#include "selfTest.h"
+#include "testVectors.h"
+// Definition of global constants (only if really necessary, see coding rules)
+// No globals
+// Definition of global variables (should be avoided, see coding rules)
+// No globals
+// Definition of global and local functions (sorted by topic, if possible)
+
+/*---------------------------------------------------
+* Definition of function PerformSelfTestTest()
+* Parameters:
+* None
+* Return value:
+* test_complete: unsigned integer, 1 if all tests were succesful, 0 if one or more tests failed
+------------------------------------------------------*/
+unsigned int PerformSelfTestTest(void) {
+	// Definition of local variables
+	// 50 ms interval in 10 slices, 4000 randomized vectors (the budget is set by the tests)
+	SelfTestConfig config = {50000000u, 0, 10, 4000, 0x2545F491u, -1};
+	SelfTest test; // self-test under test
+	SelfTestStatus status; // status of the self-test
+	struct timespec wait = {0, 150000000L}; // 150 ms, 3 intervals of the background thread
+	unsigned int tested = 0; // result of SelfTestRunSlice()
+	unsigned int slices = 0; // number of slices of a pass
+	const TestVector *vector = 0; // fixed vector of the self-test
+	unsigned int index = 0; // Loop index over the fixed vectors
+	unsigned int matches = 0; // fixed vectors with the result of EvaluateTemp()
+	char message[40]; // String array for test result message
+	unsigned int total_tests = 0; // Total number of tests
+	unsigned int successful_tests = 0; // Total number of successful test
+
+	unsigned int test_complete = 0; // 1 if all tests OK, 0 if one or more tests failed
+	// For printf() function, buffer setting (no buffering)
+	setvbuf(stdout, NULL, _IONBF, 0);
+
+	// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+	// Self-test tests (STT)
+	// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+	// STT1: One slice with a large budget tests the complete pass without failure
+	total_tests++;
+	printf("\n\nSTT1: Test with 12 fixed and 4000 randomized vectors in one slice\n");
+	// Initialize test result message with negative test result, will only be changed if test is successful
+	strcpy(message, "STT1 FAILED, Tested vectors: \0");
+	config.slice_budget_ns = 10000000000u;
+	if (SelfTestInit(&test, &config) == 1) {
+		tested = SelfTestRunSlice(&test);
+		SelfTestGetStatus(&test, &status);
+		// Expected: 4012 vectors, 1 pass, no failure, coverage 100 %
+		if ((tested == 4012) && (status.passes == 1) && (status.failures == 0) && (status.coverage == 1000)
+				&& (status.last_pass_ns != 0)) {
+			strcpy(message, "STT1 SUCCESFUL, Tested vectors: \0");
+			successful_tests++;
+		}
+		SelfTestFree(&test);
+	}
+	// Print test result
+	printf("\n%s%d", message, tested);
+	// End of STT1
+
+	// STT2: Without budget, every slice tests one group of vectors only
+	total_tests++;
+	printf("\n\nSTT2: Test with budget 0, slices of %d vectors until the pass is complete\n", SELF_TEST_GROUP);
+	// Initialize test result message with negative test result, will only be changed if test is successful
+	strcpy(message, "STT2 FAILED, Slices: \0");
+	config.slice_budget_ns = 0;
+	if (SelfTestInit(&test, &config) == 1) {
+		tested = SelfTestRunSlice(&test);
+		SelfTestGetStatus(&test, &status);
+		slices = 1;
+		if ((tested == SELF_TEST_GROUP) && (status.coverage == ((SELF_TEST_GROUP * 1000) / 4012))) {
+			while ((status.passes == 0) && (slices < 1000)) {
+				SelfTestRunSlice(&test);
+				SelfTestGetStatus(&test, &status);
+				slices++;
+			}
+		}
+		SelfTestFree(&test);
+	}
+	// Expected: 502 slices (4012 / 8 rounded up), no failure
+	if ((slices == 502) && (status.passes == 1) && (status.failures == 0)) {
+		strcpy(message, "STT2 SUCCESFUL, Slices: \0");
+		successful_tests++;
+	}
+	// Print test result
+	printf("\n%s%d", message, slices);
+	// End of STT2
+
+	// STT3: The background thread completes a pass in every interval
+	total_tests++;
+	printf("\n\nSTT3: Test with the background thread, 500 randomized vectors, 50 ms interval, 10 slices of 1 ms\n");
+	// Initialize test result message with negative test result, will only be changed if test is successful
+	strcpy(message, "STT3 FAILED, Passes: \0");
+	config.slice_budget_ns = 1000000u;
+	config.random_vectors = 500;
+	memset(&status, 0, sizeof(status));
+	if (SelfTestInit(&test, &config) == 1) {
+		if (SelfTestStart(&test) == 1) {
+			nanosleep(&wait, 0);
+			SelfTestStop(&test);
+			SelfTestGetStatus(&test, &status);
+		}
+		SelfTestFree(&test);
+	}
+	// Expected: at least 1 pass, no failure
+	if ((status.passes >= 1) && (status.failures == 0)) {
+		strcpy(message, "STT3 SUCCESFUL, Passes: \0");
+		successful_tests++;
+	}
+	// Print test result
+	printf("\n%s%lu", message, status.passes);
+	// End of STT3
+
+	// STT4: Every fixed vector of the self-test holds the result of EvaluateTemp()
+	total_tests++;
+	printf("\n\nSTT4: Test with the %d fixed vectors against EvaluateTemp()\n", TEST_VECTOR_COUNT);
+	// Initialize test result message with negative test result, will only be changed if test is successful
+	strcpy(message, "STT4 FAILED, Matching vectors: \0");
+	for (index = 0; index < TEST_VECTOR_COUNT; index++) {
+		vector = TestVectorGet(index);
+		if (EvaluateTemp(vector->format, vector->min_temp, vector->max_temp, vector->max_deltatemp,
+				vector->temp_sensor1, vector->temp_sensor2) == vector->expected) {
+			matches++;
+		}
+	}
+	// Expected: all vectors match, no vector behind the last one
+	if ((matches == TEST_VECTOR_COUNT) && (TestVectorGet(TEST_VECTOR_COUNT) == 0)) {
+		strcpy(message, "STT4 SUCCESFUL, Matching vectors: \0");
+		successful_tests++;
+	}
+	// Print test result
+	printf("\n%s%u", message, matches);
+	// End of STT4
+
+	test_complete = (successful_tests == total_tests);
+
+	return test_complete;
+
+}
@@ -0,0 +1,28 @@
+/* ---------------------------------------------------------------------------------------------
+ * Module Name: Safe Temperature Monitoring
+ * File Name: selftest_testing.h
+ * Corresponding Source-File: selftest_testing.c
+ * Created on: 19.10.2026
+ * Development Group: CKN GmbH
+ * Project: FSQM SW Development Exercise
+ * Dependencies: SelfTestRunSlice(), SelfTestStart(), stdio.h (hardware dependent)
+ *
+ * Description: This file contains the test cases for the periodic self-test of the Safe Temperature Monitoring module
+ *
+
+ * ----------------------------------------------------------------------------------------------
+ * Versions:
+ *
+ * Version: 0.1 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * Initial version, definition of functions
+ *
+ * ----------------------------------------------------------------------------------------------  */
+
+#ifndef SELFTEST_TESTING_H_
+#define SELFTEST_TESTING_H_
+
+extern unsigned int PerformSelfTestTest(void);
+
+#endif /* SELFTEST_TESTING_H_ */
@@ -0,0 +1,304 @@
+/* ---------------------------------------------------------------------------------------------
+* Module Name: Safe Temperature Monitoring
+* File Name: sensorHealth.c
+* Corresponding Header-File: sensorHealth.h
+* Created on: 19.10.2026
+* Development Group: CKN GmbH
+* Project: FSQM SW Development Exercise
+* Dependencies: channelStore.c, stdlib.h (memory is only allocated in SensorHealthInit())
+*
+* Description: This file contains the functions of the sensor health monitoring.
+*
+*  sensorHealthInit() allocates all arrays in one memory block, every array starts at a cache line
+*
+*  sensorHealthScan() is called after ChannelStoreScan() with the same range of channels; it updates the
+*  state of both sensors of every channel with the readings of the scan arrays (in centi-degree of the
+*  registered format) and changes the result 7 into 6, if a sensor of the channel shows a finding
+*
+*  the flat band is the range [band_low, band_high] of the readings since the start of the run; it is
+*  extended as long as its width stays within flat_band, the first reading outside of it starts a new
+*  band, so a ramp of any slope is not a flatline, while noise around a frozen value is
+*
+*  the moving average and variance are exponentially weighted (weight 1/16) and calculated with
+*  integer arithmetic; the deviation is limited to +/- 40.96 degree, larger changes are implausible
+*  steps anyway
+*
+*  invalid readings (CHANNEL_INVALID_UNITS, result 5) do not change the state of the sensor
+*
+* ----------------------------------------------------------------------------------------------
+* Versions:
+* Version: 0.1 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Initial version, stuck-at, flatline, zero variance and step detection
+*
+* Version: 0.2 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Shared constants and helpers taken from monitorCommon.h
+*
+* Version: 0.3 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Flatline detected with an anchored band, readings taken from the scan arrays in the registered format
+*
+* ----------------------------------------------------------------------------------------------*/
+
+// Include system header files
+#include <stdint.h> // stdint.h is necessary for the fixed size state
+#include <stdlib.h> // stdlib.h is necessary for malloc/free
+#include <string.h> // string.h is necessary for memset
+// Include own header files
+#include "channelStore.h"
+#include "monitorCommon.h"
+#include "sensorHealth.h"
+
+// Definition of local (module level) constants
+// Weight of a new value in the moving average and variance is 1 / EWMA_WEIGHT
+static const int32_t EWMA_WEIGHT = 16;
+// Fixed point scale of the moving average (readings up to ABS_MAXTEMP_F_CENTI, so reading * MEAN_SCALE fits into 32 bit)
+static const int32_t MEAN_SCALE = 256;
+// Largest deviation in centi-degree used for the variance, so that the square fits into 32 bit
+static const int32_t DEVIATION_LIMIT = 4096;
+// Largest value of the saturated counters
+static const uint16_t COUNTER_LIMIT = UINT16_MAX;
+
+// Declaration of local (module level) functions
+static unsigned int UpdateSensor(SensorHealth *health, unsigned int element, int32_t reading);
+
+
+// Function Definitions
+
+/*---------------------------------------------------
+* Definition of function SensorHealthInit()
+* Parameters:
+*	health: sensor health monitoring to be initialized
+*	capacity: maximum number of channels, at least the capacity of the monitored channel store
+*	config: thresholds of the detection
+* Return value:
+*	init_ok: unsigned integer, 1 if the memory could be allocated, 0 otherwise
+------------------------------------------------------*/
+unsigned int SensorHealthInit(SensorHealth *health, unsigned int capacity, const SensorHealthConfig *config) {
+
+	// Definition of local variables
+	unsigned int init_ok = 0;			// Return value, defensive programming: initialize with 0 (failure)
+	size_t sensors = 2 * (size_t)capacity;	// number of sensors
+	size_t size16 = AlignToCacheLine(sensors * sizeof(int16_t));	// size of a 16 bit array
+	size_t size32 = AlignToCacheLine(sensors * sizeof(int32_t));	// size of a 32 bit array
+	size_t size8 = AlignToCacheLine(capacity * sizeof(uint8_t));	// size of the findings
+	size_t size = (3 * size16) + (5 * size32) + size8 + CACHE_LINE;	// size of the memory block
+	uintptr_t next = 0;					// start of the next array
+
+	memset(health, 0, sizeof(*health));
+	health->memory = malloc(size);
+
+	if(health->memory != 0)
+	{
+		memset(health->memory, 0, size);
+		next = AlignToCacheLine((uintptr_t)health->memory);
+		health->last = (int32_t *)next;
+		next += size32;
+		health->band_low = (int32_t *)next;
+		next += size32;
+		health->band_high = (int32_t *)next;
+		next += size32;
+		health->same = (uint16_t *)next;
+		next += size16;
+		health->flat = (uint16_t *)next;
+		next += size16;
+		health->samples = (uint16_t *)next;
+		next += size16;
+		health->mean = (int32_t *)next;
+		next += size32;
+		health->variance = (int32_t *)next;
+		next += size32;
+		health->findings = (uint8_t *)next;
+		health->config = *config;
+		health->capacity = capacity;
+		init_ok = 1;
+	}
+
+	return init_ok;
+}
+
+
+/*---------------------------------------------------
+* Definition of function SensorHealthFree()
+* Parameters:
+*	health: sensor health monitoring initialized with SensorHealthInit()
+* Return value: none
+------------------------------------------------------*/
+void SensorHealthFree(SensorHealth *health) {
+
+	free(health->memory);
+	memset(health, 0, sizeof(*health));
+}
+
+
+/*---------------------------------------------------
+* Definition of function SensorHealthReset()
+* Forgets the history of both sensors of a channel, e.g. after a sensor was replaced
+* Parameters:
+*	health: sensor health monitoring initialized with SensorHealthInit()
+*	channel: index of the channel
+* Return value: none
+------------------------------------------------------*/
+void SensorHealthReset(SensorHealth *health, unsigned int channel) {
+
+	// Definition of local variables
+	unsigned int sensor = 0;			// Loop index over both sensors
+
+	if(channel < health->capacity)
+	{
+		for(sensor = 2 * channel; sensor < (2 * channel) + 2; sensor++)
+		{
+			health->last[sensor] = 0;
+			health->band_low[sensor] = 0;
+			health->band_high[sensor] = 0;
+			health->same[sensor] = 0;
+			health->flat[sensor] = 0;
+			health->samples[sensor] = 0;
+			health->mean[sensor] = 0;
+			health->variance[sensor] = 0;
+		}
+		health->findings[channel] = 0;
+	}
+}
+
+
+/*---------------------------------------------------
+* Definition of function SensorHealthScan()
+* Updates the state of the sensors of the channels first .. first + count - 1 with the readings
+* of the scan arrays of the store and changes the result 7 of a channel with a finding into 6 (SENSOR_HEALTH_FAILURE);
+* must be called once per scan, after ChannelStoreScan()
+* Parameters:
+*	health: sensor health monitoring initialized with SensorHealthInit()
+*	store: channel store, scanned with ChannelStoreScan()
+*	first: index of the first channel
+*	count: number of channels
+* Return value:
+*	unhealthy: unsigned integer, number of channels with a finding
+------------------------------------------------------*/
+unsigned int SensorHealthScan(SensorHealth *health, ChannelStore *store, unsigned int first, unsigned int count) {
+
+	// Definition of local variables
+	unsigned int unhealthy = 0;			// Return value: number of channels with a finding
+	unsigned int index = 0;				// Loop index
+	unsigned int last = first + count;	// index after the last channel
+	unsigned int findings = 0;			// findings of both sensors of a channel
+	unsigned int temp_ok = 0;			// result of the channel
+	int32_t reading1 = 0;				// reading of sensor 1 in centi-degree of the registered format
+	int32_t reading2 = 0;				// reading of sensor 2 in centi-degree of the registered format
+	// Local copies of the array pointers, see ChannelStoreScan()
+	const int32_t *scan_sensor1 = store->scan_sensor1;
+	const int32_t *scan_sensor2 = store->scan_sensor2;
+	uint8_t *result = store->temp_ok;
+	uint8_t *channel_findings = health->findings;
+
+	if(last > store->count)
+	{
+		last = store->count;
+	}
+	if(last > health->capacity)
+	{
+		last = health->capacity;
+	}
+
+	for(index = first; index < last; index++)
+	{
+		reading1 = (scan_sensor1[index] != CHANNEL_INVALID_UNITS)
+				? ChannelStoreNativeCenti(store, index, scan_sensor1[index]) : CHANNEL_INVALID_UNITS;
+		reading2 = (scan_sensor2[index] != CHANNEL_INVALID_UNITS)
+				? ChannelStoreNativeCenti(store, index, scan_sensor2[index]) : CHANNEL_INVALID_UNITS;
+		findings = UpdateSensor(health, 2 * index, reading1);
+		findings |= UpdateSensor(health, (2 * index) + 1, reading2) << SENSOR_HEALTH_SENSOR2;
+		channel_findings[index] = (uint8_t)findings;
+
+		/*7 becomes 6 (7 - 1) if there is a finding, 3 and 5 are kept*/
+		temp_ok = result[index];
+		result[index] = (uint8_t)(temp_ok - ((temp_ok == 7) & (findings != 0)));
+		unhealthy += (findings != 0);
+	}
+
+	return unhealthy;
+}
+
+
+
+// Definition of local (module level) functions
+
+/*---------------------------------------------------
+* Definition of function UpdateSensor()
+* Parameters:
+*	health: sensor health monitoring
+*	element: index of the sensor in the state arrays (2 * channel + sensor)
+*	reading: reading in centi-degree of the registered format, CHANNEL_INVALID_UNITS if invalid
+* Return value:
+*	findings: unsigned integer, SENSOR_HEALTH_* findings of the sensor
+------------------------------------------------------*/
+static unsigned int UpdateSensor(SensorHealth *health, unsigned int element, int32_t reading) {
+
+	// Definition of local variables
+	unsigned int findings = 0;			// Return value: findings of the sensor
+	const SensorHealthConfig *config = &health->config;	// thresholds
+	unsigned int history = (health->samples[element] != 0);	// 1 if there is a previous reading
+	int32_t change = 0;					// change since the previous reading
+	int32_t deviation = 0;				// deviation from the moving average in centi-degree
+	unsigned int same = 0;				// number of scans without change
+	unsigned int flat = 0;				// number of scans within the flat band
+	unsigned int inside = 0;			// 1 if the band with the reading is not wider than flat_band
+	int32_t low = 0;					// lowest reading of the band with the reading
+	int32_t high = 0;					// highest reading of the band with the reading
+
+	if(reading != CHANNEL_INVALID_UNITS)
+	{
+		change = reading - health->last[element];
+		change = (change < 0) ? -change : change;
+
+		/*Flat band: extended by the reading, or started again at the reading if it would become too wide*/
+		low = (reading < health->band_low[element]) ? reading : health->band_low[element];
+		high = (reading > health->band_high[element]) ? reading : health->band_high[element];
+		inside = history & ((high - low) <= (int32_t)config->flat_band);
+		health->band_low[element] = inside ? low : reading;
+		health->band_high[element] = inside ? high : reading;
+
+		/*Run lengths, counted from the second reading on and saturated*/
+		same = (history & (change == 0)) * (health->same[element] + 1u);
+		flat = inside * (health->flat[element] + 1u);
+		health->same[element] = (uint16_t)((same > COUNTER_LIMIT) ? COUNTER_LIMIT : same);
+		health->flat[element] = (uint16_t)((flat > COUNTER_LIMIT) ? COUNTER_LIMIT : flat);
+
+		/*Moving average and variance, the first reading initializes the average*/
+		if(history == 0)
+		{
+			health->mean[element] = reading * MEAN_SCALE;
+			health->variance[element] = 0;
+		}
+		else
+		{
+			deviation = (reading * MEAN_SCALE) - health->mean[element];
+			health->mean[element] += deviation / EWMA_WEIGHT;
+			deviation /= MEAN_SCALE;
+			deviation = (deviation > DEVIATION_LIMIT) ? DEVIATION_LIMIT : deviation;
+			deviation = (deviation < -DEVIATION_LIMIT) ? -DEVIATION_LIMIT : deviation;
+			health->variance[element] += ((deviation * deviation * EWMA_WEIGHT) - health->variance[element]) / EWMA_WEIGHT;
+		}
+
+		if(health->samples[element] < COUNTER_LIMIT)
+		{
+			health->samples[element]++;
+		}
+		health->last[element] = reading;
+
+		findings |= ((config->stuck_cycles != 0) & (health->same[element] >= config->stuck_cycles)) * SENSOR_HEALTH_STUCK;
+		findings |= ((config->flat_cycles != 0) & (health->flat[element] >= config->flat_cycles)) * SENSOR_HEALTH_FLATLINE;
+		findings |= ((health->samples[element] > config->warmup_cycles)
+				& (health->variance[element] < ((int32_t)config->min_variance * EWMA_WEIGHT))) * SENSOR_HEALTH_ZERO_VARIANCE;
+		findings |= ((config->max_step != 0) & history & (change > config->max_step)) * SENSOR_HEALTH_STEP;
+	}
+
+	return findings;
+}
+
+
+// End of file sensorHealth.c
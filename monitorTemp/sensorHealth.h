@@ -0,0 +1,100 @@
+/* ---------------------------------------------------------------------------------------------
+ * Module Name: Safe Temperature Monitoring
+ * File Name: sensorHealth.h
+ * Corresponding Source-File: sensorHealth.c
+ * Created on: 19.10.2026
+ * Development Group: CKN GmbH
+ * Project: FSQM SW Development Exercise
+ * Dependencies: channelStore.h, stdlib.h (memory is only allocated in SensorHealthInit())
+ *
+ * Description: This file contains the function prototypes of the sensor health monitoring.
+ * The implementation of the functions can be found in the corresponding source file sensorHealth.c
+ *
+ *  CheckTemp() only checks the range and the delta of both sensors; a sensor which is frozen at a
+ *  plausible value passes forever. The sensor health monitoring follows the readings of every sensor
+ *  of a channel store from scan to scan and detects
+ *  - stuck-at: the reading has not changed for stuck_cycles scans
+ *  - flatline: the readings have stayed within a band of flat_band for flat_cycles scans (quantization
+ *    noise only); the band is anchored at the first reading of the run and starts again at the first
+ *    reading outside of it, so a slow drift is never a flatline
+ *  - zero variance: the moving variance of the reading is below min_variance (after warmup_cycles readings)
+ *  - implausible step: the reading has changed by more than max_step from one scan to the next
+ *
+ *  the readings are taken from the scan arrays of the channel store in centi-degree of the registered
+ *  format of the channel (ChannelStoreNativeCenti(), exact for both formats), so a change of 0.01 °F is
+ *  seen as a change and not rounded away
+ *
+ *  every sensor has a constant amount of state (26 bytes), independent of the number of scans
+ *
+ *  a finding changes the result 7 (OK) of the channel into 6 (SENSOR_HEALTH_FAILURE); the results 3
+ *  (alarm) and 5 (function failure) are never changed, so an alarm is not hidden by a sensor fault
+ * ----------------------------------------------------------------------------------------------
+ * Versions:
+ *
+ * Version: 0.1 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * Initial version, definition of functions
+ *
+ * Version: 0.2 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * Flatline detected with an anchored band, readings taken from the scan arrays in the registered format
+ *
+ * ----------------------------------------------------------------------------------------------  */
+
+#ifndef SENSORHEALTH_H_
+#define SENSORHEALTH_H_
+
+#include <stdint.h>
+#include "channelStore.h"
+
+// Declaration of constants (enumeration constants)
+// Result of a channel with a sensor health finding, in addition to 7, 3 and 5 of MonitorTemp()
+enum {
+	SENSOR_HEALTH_FAILURE = 6
+};
+
+// Findings of a sensor; the findings of sensor 2 are shifted by SENSOR_HEALTH_SENSOR2
+enum {
+	SENSOR_HEALTH_STUCK = 0x01,			// reading unchanged for stuck_cycles scans
+	SENSOR_HEALTH_FLATLINE = 0x02,		// reading within flat_band for flat_cycles scans
+	SENSOR_HEALTH_ZERO_VARIANCE = 0x04,	// moving variance below min_variance
+	SENSOR_HEALTH_STEP = 0x08,			// change by more than max_step within one scan
+	SENSOR_HEALTH_SENSOR2 = 4			// shift of the findings of sensor 2
+};
+
+// Declaration of types
+// Thresholds of the detection, all temperatures in centi-degree of the registered format of the channel;
+// a threshold of 0 disables the detection
+typedef struct {
+	uint16_t stuck_cycles;			// scans without change until stuck-at is reported
+	uint16_t flat_cycles;			// scans within flat_band until flatline is reported
+	uint16_t flat_band;				// largest width of the band of readings which counts as flat
+	uint16_t max_step;				// largest plausible change per scan
+	uint16_t min_variance;			// smallest plausible moving variance in centi-degree^2
+	uint16_t warmup_cycles;			// readings before the variance is checked
+} SensorHealthConfig;
+
+// State of the sensor health monitoring; element 2 * i + s belongs to sensor s of channel i
+typedef struct {
+	int32_t *last;					// last valid reading
+	int32_t *band_low;				// lowest reading since the start of the flat band
+	int32_t *band_high;				// highest reading since the start of the flat band
+	uint16_t *same;					// number of scans without change
+	uint16_t *flat;					// number of scans within the flat band
+	uint16_t *samples;				// number of valid readings (saturated)
+	int32_t *mean;					// moving average of the reading, centi-degree * 256
+	int32_t *variance;				// moving variance of the reading, centi-degree^2 * 16
+	uint8_t *findings;				// findings of both sensors of the last scan, one element per channel
+	SensorHealthConfig config;		// thresholds of the detection
+	unsigned int capacity;			// maximum number of channels
+	void *memory;					// memory block of all arrays
+} SensorHealth;
+
+extern unsigned int SensorHealthInit(SensorHealth *health, unsigned int capacity, const SensorHealthConfig *config);
+extern void SensorHealthFree(SensorHealth *health);
+extern void SensorHealthReset(SensorHealth *health, unsigned int channel);
+extern unsigned int SensorHealthScan(SensorHealth *health, ChannelStore *store, unsigned int first, unsigned int count);
+
+#endif /* SENSORHEALTH_H_ */
@@ -0,0 +1,201 @@
+/* ---------------------------------------------------------------------------------------------
+* Module Name: Sensor Health Testing for SensorHealthScan()
+* File Name: sensorhealth_testing.c
+* Corresponding Header-File: sensorhealth_testing.h
+* Created on: 19.10.2026
+* Development Group: CKN GmbH
+* Project: FSQM SW Development Exercise (Sensor Health Testing Functions)
+* Dependencies: SensorHealthScan(), ChannelStoreScan(), stdio.h (hardware dependent)
+*
+* Description: This file contains the sensor health testing function
+*
+* PerformSensorHealthTest() is a function, which feeds sequences of readings into a channel store
+* and checks the findings of the sensor health monitoring after every scan, also for slow ramps and
+* Fahrenheit sensors changing by 0.01 °F
+*
+* ----------------------------------------------------------------------------------------------
+* Versions:
+* Version: 0.1 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* 3 sensor health tests were implemented
+*
+* Version: 0.2 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Ramp and Fahrenheit dither tests added
+*
+* ----------------------------------------------------------------------------------------------*/
+// Include system header files
+#include <stdio.h> // stdio.h is necessary for printing/reading via standard IO
+#include <string.h> // string.h is necessary for string operations
+// Include own header files
+#include "channelStore.h"
+#include "sensorHealth.h"
+// Definition of global constants (only if really necessary, see coding rules)
+// No globals
+// Definition of global variables (should be avoided, see coding rules)
+// No globals
+// Definition of global and local functions (sorted by topic, if possible)
+
+/*---------------------------------------------------
+* Definition of function PerformSensorHealthTest()
+* Parameters:
+* None
+* Return value:
+* test_complete: unsigned integer, 1 if all tests were succesful, 0 if one or more tests failed
+------------------------------------------------------*/
+unsigned int PerformSensorHealthTest(void) {
+	// Definition of local variables
+	// stuck-at after 10 scans, flatline (+/- 0.01 degree) after 20 scans, steps above 5 degree,
+	// variance below 0.01 degree^2 after 30 readings
+	const SensorHealthConfig config = {10, 20, 1, 500, 1, 30};
+	// as above without the variance check
+	const SensorHealthConfig drift_config = {10, 20, 1, 500, 0, 30};
+	ChannelStore store; // channel store: stuck sensor, healthy, stuck sensor with alarm, dithering sensor
+	SensorHealth health; // sensor health monitoring under test
+	ChannelStore drift; // channel store: ramp 0.01 °C/scan, ramp 0.01 °F/scan, dither 0.01 °F
+	SensorHealth drift_health; // sensor health monitoring of the drift channels
+	unsigned int channel = 0; // index of a registered channel
+	unsigned int cycle = 0; // loop index over the scans
+	float ramp = 0; // slowly changing reading
+	unsigned int findings[4] = {0, 0, 0, 0}; // findings after the sequence
+	char message[40]; // String array for test result message
+	unsigned int total_tests = 0; // Total number of tests
+	unsigned int successful_tests = 0; // Total number of successful test
+
+	unsigned int test_complete = 0; // 1 if all tests OK, 0 if one or more tests failed
+	// For printf() function, buffer setting (no buffering)
+	setvbuf(stdout, NULL, _IONBF, 0);
+
+	if ((ChannelStoreInit(&store, 4) == 0) || (SensorHealthInit(&health, 4, &config) == 0)
+			|| (ChannelStoreInit(&drift, 3) == 0) || (SensorHealthInit(&drift_health, 3, &drift_config) == 0)) {
+		printf("\n\nSHT: memory could not be allocated\n");
+		SensorHealthFree(&health);
+		ChannelStoreFree(&store);
+		ChannelStoreFree(&drift);
+		return 0;
+	}
+	for (cycle = 0; cycle < 4; cycle++) {
+		ChannelStoreRegister(&store, "SHT", 'C', -10.0, 80.0, 3.0, &channel);
+	}
+	ChannelStoreRegister(&drift, "ramp C", 'C', -10.0, 80.0, 3.0, &channel);
+	ChannelStoreRegister(&drift, "ramp F", 'F', 14.0, 176.0, 5.0, &channel);
+	ChannelStoreRegister(&drift, "dither F", 'F', 14.0, 176.0, 5.0, &channel);
+	// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+	// Sensor health tests (SHT)
+	// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+	// SHT1: A sensor frozen at a plausible value is reported as stuck, the healthy channel stays OK
+	total_tests++;
+	printf("\n\nSHT1: Test with sensor 1 frozen at 50.0° C for 12 scans, result 6\n");
+	// Initialize test result message with negative test result, will only be changed if test is successful
+	strcpy(message, "SHT1 FAILED, Result: \0");
+	for (cycle = 0; cycle < 12; cycle++) {
+		ramp = 50.0 + (0.1 * cycle);
+		ChannelStoreSetReading(&store, 0, 50.0, ramp);
+		ChannelStoreSetReading(&store, 1, ramp, ramp + 0.5);
+		ChannelStoreSetReading(&store, 2, 90.0, 90.0);
+		ChannelStoreSetReading(&store, 3, 40.0 + (0.01 * (cycle % 2)), ramp);
+		ChannelStoreScan(&store, 0, store.count);
+		SensorHealthScan(&health, &store, 0, store.count);
+	}
+	// Expected: channel 0 stuck (sensor 1 only) and 6, channel 1 no finding and 7
+	if ((health.findings[0] == SENSOR_HEALTH_STUCK) && (store.temp_ok[0] == SENSOR_HEALTH_FAILURE)
+			&& (health.findings[1] == 0) && (store.temp_ok[1] == 7)) {
+		strcpy(message, "SHT1 SUCCESFUL, Result: \0");
+		successful_tests++;
+	}
+	// Print test result
+	printf("\n%s%d", message, store.temp_ok[0]);
+	// End of SHT1
+
+	// SHT2: An alarm is not hidden by a stuck sensor
+	total_tests++;
+	printf("\n\nSHT2: Test with both sensors frozen at 90.0° C (above maximum), result 3\n");
+	// Initialize test result message with negative test result, will only be changed if test is successful
+	strcpy(message, "SHT2 FAILED, Result: \0");
+	// Expected: both sensors of channel 2 stuck, result 3 (alarm)
+	if ((health.findings[2] == (SENSOR_HEALTH_STUCK | (SENSOR_HEALTH_STUCK << SENSOR_HEALTH_SENSOR2)))
+			&& (store.temp_ok[2] == 3)) {
+		strcpy(message, "SHT2 SUCCESFUL, Result: \0");
+		successful_tests++;
+	}
+	// Print test result
+	printf("\n%s%d", message, store.temp_ok[2]);
+	// End of SHT2
+
+	// SHT3: Flatline, zero variance and steps are detected
+	total_tests++;
+	printf("\n\nSHT3: Test with dithering sensor for 40 scans and a step of 6° C, findings of all kinds\n");
+	// Initialize test result message with negative test result, will only be changed if test is successful
+	strcpy(message, "SHT3 FAILED, Findings: \0");
+	for (cycle = 12; cycle < 40; cycle++) {
+		ramp = 50.0 + (0.1 * cycle);
+		ChannelStoreSetReading(&store, 1, ramp, ramp + 0.5);
+		ChannelStoreSetReading(&store, 3, 40.0 + (0.01 * (cycle % 2)), ramp);
+		ChannelStoreScan(&store, 0, store.count);
+		SensorHealthScan(&health, &store, 0, store.count);
+	}
+	findings[3] = health.findings[3];
+	// step of both sensors of channel 1 (without delta alarm)
+	ChannelStoreSetReading(&store, 1, ramp + 6.0, ramp + 6.5);
+	ChannelStoreScan(&store, 0, store.count);
+	SensorHealthScan(&health, &store, 0, store.count);
+	findings[1] = health.findings[1];
+	// Expected: channel 3 sensor 1 flatline and zero variance, not stuck; channel 1 both sensors step
+	if ((findings[3] == (SENSOR_HEALTH_FLATLINE | SENSOR_HEALTH_ZERO_VARIANCE))
+			&& (findings[1] == (SENSOR_HEALTH_STEP | (SENSOR_HEALTH_STEP << SENSOR_HEALTH_SENSOR2)))
+			&& (store.temp_ok[1] == SENSOR_HEALTH_FAILURE)) {
+		strcpy(message, "SHT3 SUCCESFUL, Findings: \0");
+		successful_tests++;
+	}
+	// Print test result
+	printf("\n%s0x%02X 0x%02X", message, findings[3], findings[1]);
+	// End of SHT3
+
+	// SHT4: A slow ramp is not a flatline, the band starts again when the reading leaves it
+	total_tests++;
+	printf("\n\nSHT4: Test with sensors rising by 0.01° C and by 0.01° F per scan for 40 scans, result 7\n");
+	// Initialize test result message with negative test result, will only be changed if test is successful
+	strcpy(message, "SHT4 FAILED, Findings: \0");
+	for (cycle = 0; cycle < 40; cycle++) {
+		ChannelStoreSetReading(&drift, 0, 20.0 + (0.01 * cycle), 20.5 + (0.01 * cycle));
+		ChannelStoreSetReading(&drift, 1, 70.0 + (0.01 * cycle), 70.5 + (0.01 * cycle));
+		ChannelStoreSetReading(&drift, 2, 70.01 + (0.01 * (cycle % 2)), 70.0 + (0.1 * cycle));
+		ChannelStoreScan(&drift, 0, drift.count);
+		SensorHealthScan(&drift_health, &drift, 0, drift.count);
+	}
+	// Expected: no finding and 7 for both ramps (a band of 0.01 degree is left after two scans)
+	if ((drift_health.findings[0] == 0) && (drift.temp_ok[0] == 7)
+			&& (drift_health.findings[1] == 0) && (drift.temp_ok[1] == 7)) {
+		strcpy(message, "SHT4 SUCCESFUL, Findings: \0");
+		successful_tests++;
+	}
+	// Print test result
+	printf("\n%s0x%02X 0x%02X", message, drift_health.findings[0], drift_health.findings[1]);
+	// End of SHT4
+
+	// SHT5: A Fahrenheit sensor dithering by 0.01 °F is flat, but not stuck
+	total_tests++;
+	printf("\n\nSHT5: Test with sensor 1 alternating between 70.01° F and 70.02° F for 40 scans, result 6\n");
+	// Initialize test result message with negative test result, will only be changed if test is successful
+	strcpy(message, "SHT5 FAILED, Findings: \0");
+	// Expected: flatline of sensor 1 only (both readings are 21.12° C, but differ in °F), result 6
+	if ((drift_health.findings[2] == SENSOR_HEALTH_FLATLINE) && (drift.temp_ok[2] == SENSOR_HEALTH_FAILURE)) {
+		strcpy(message, "SHT5 SUCCESFUL, Findings: \0");
+		successful_tests++;
+	}
+	// Print test result
+	printf("\n%s0x%02X", message, drift_health.findings[2]);
+	// End of SHT5
+
+	SensorHealthFree(&drift_health);
+	ChannelStoreFree(&drift);
+	SensorHealthFree(&health);
+	ChannelStoreFree(&store);
+
+	test_complete = (successful_tests == total_tests);
+
+	return test_complete;
+
+}
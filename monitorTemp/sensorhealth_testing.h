@@ -0,0 +1,33 @@
+/* ---------------------------------------------------------------------------------------------
+ * Module Name: Safe Temperature Monitoring
+ * File Name: sensorhealth_testing.h
+ * Corresponding Source-File: sensorhealth_testing.c
+ * Created on: 19.10.2026
+ * Development Group: CKN GmbH
+ * Project: FSQM SW Development Exercise
+ * Dependencies: SensorHealthScan(), stdio.h (hardware dependent)
+ *
+ * Description: This file contains the test cases for the sensor health monitoring of the Safe Temperature Monitoring module
+ *
+
+ * ----------------------------------------------------------------------------------------------
+ * Versions:
+ *
+ * Version: 0.1 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * Initial version, definition of functions
+ *
+ * Version: 0.2 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * Ramp and Fahrenheit dither tests added
+ *
+ * ----------------------------------------------------------------------------------------------  */
+
+#ifndef SENSORHEALTH_TESTING_H_
+#define SENSORHEALTH_TESTING_H_
+
+extern unsigned int PerformSensorHealthTest(void);
+
+#endif /* SENSORHEALTH_TESTING_H_ */
@@ -0,0 +1,591 @@
+/* ---------------------------------------------------------------------------------------------
+* Module Name: Safe Temperature Monitoring
+* File Name: telemetry.c
+* Corresponding Header-File: telemetry.h
+* Created on: 19.10.2026
+* Development Group: CKN GmbH
+* Project: FSQM SW Development Exercise
+* Dependencies: stdatomic.h (C11), clock_gettime() (POSIX), POSIX threads and Unix domain sockets
+* 		for the endpoint (hardware dependent, the endpoint is not available on other systems)
+*
+* Description: This file contains the functions of the telemetry of the monitoring.
+*
+*  the recording functions only carry out relaxed atomic additions, they never block and never
+*  allocate memory; results of a batch are counted locally first, so that only three atomic
+*  additions are necessary per batch
+*
+*  the endpoint thread formats the counters into a preallocated buffer for every request; a client
+*  which closes the connection early cannot raise SIGPIPE (send() with MSG_NOSIGNAL or SO_NOSIGPIPE),
+*  a client which sends nothing is dropped after the receive timeout, and failing accept() calls are
+*  repeated with an increasing pause instead of a busy loop
+*
+* ----------------------------------------------------------------------------------------------
+* Versions:
+* Version: 0.1 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Initial version, latency histograms, result counters and Prometheus endpoint
+*
+* Version: 0.2 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Histogram functions made public, so that other modules (pipeline) can record latencies
+*
+* Version: 0.3 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Result 6 (sensor health failure, see sensorHealth.c) counted
+*
+* Version: 0.4 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Answer sent with send() without SIGPIPE, connection timeouts, pause after failed accept() calls
+*
+* ----------------------------------------------------------------------------------------------*/
+
+// Include system header files
+#include <errno.h> // errno.h is necessary for the errors of accept
+#include <stdatomic.h> // stdatomic.h is necessary for the lock free counters
+#include <stdio.h> // stdio.h is necessary for snprintf
+#include <string.h> // string.h is necessary for string operations
+#include <time.h> // time.h is necessary for clock_gettime
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/socket.h> // sys/socket.h is necessary for the endpoint
+#include <sys/un.h> // sys/un.h is necessary for Unix domain sockets
+#include <sys/time.h> // sys/time.h is necessary for the timeouts of a connection
+#include <unistd.h> // unistd.h is necessary for read/close/unlink
+#endif
+// Include own header files
+#include "telemetry.h"
+
+// Definition of local (module level) constants
+// Result codes in the order of the result counters
+static const unsigned int RESULT_CODES[TELEMETRY_RESULT_CODES] = {7, 3, 5, 6};
+#if defined(__unix__) || defined(__APPLE__)
+// Timeout for receiving the request and sending the answer of a connection in ms
+static const long CONNECTION_TIMEOUT_MS = 500;
+// Shortest and longest pause after a failed accept() in ms, the pause is doubled after every failure
+static const long ACCEPT_PAUSE_MIN_MS = 10;
+static const long ACCEPT_PAUSE_MAX_MS = 1000;
+// Flags of send(): a closed connection must not raise SIGPIPE (without MSG_NOSIGNAL: SO_NOSIGPIPE is set)
+#if defined(MSG_NOSIGNAL)
+static const int SEND_FLAGS = MSG_NOSIGNAL;
+#else
+static const int SEND_FLAGS = 0;
+#endif
+#endif
+
+// Declaration of local (module level) functions
+static size_t FormatHistogram(TelemetryHistogram *histogram, const char *name, const char *help, char *text, size_t size);
+static size_t Append(size_t size, size_t used, int written);
+#if defined(__unix__) || defined(__APPLE__)
+static void *TelemetryServerThread(void *argument);
+static void PrepareConnection(int connection);
+static unsigned int SendAll(int connection, const char *data, size_t length);
+static void Pause(long milliseconds);
+#endif
+
+
+// Function Definitions
+
+/*---------------------------------------------------
+* Definition of function TelemetryInit()
+* Parameters:
+*	telemetry: telemetry to be initialized, all counters are set to 0
+* Return value: none
+------------------------------------------------------*/
+void TelemetryInit(Telemetry *telemetry) {
+
+	// Definition of local variables
+	unsigned int index = 0;				// Loop index
+	unsigned int group = 0;				// Loop index over the groups
+
+	TelemetryHistogramInit(&telemetry->call_latency);
+	TelemetryHistogramInit(&telemetry->scan_latency);
+
+	for(group = 0; group < TELEMETRY_GROUPS; group++)
+	{
+		for(index = 0; index < TELEMETRY_RESULT_CODES; index++)
+		{
+			atomic_init(&telemetry->results[group][index], 0);
+		}
+	}
+}
+
+
+/*---------------------------------------------------
+* Definition of function TelemetryNow()
+* Parameters: none
+* Return value:
+*	now: monotonic time in ns, only differences are meaningful
+------------------------------------------------------*/
+uint64_t TelemetryNow(void) {
+
+	// Definition of local variables
+	struct timespec now;				// actual time
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return ((uint64_t)now.tv_sec * 1000000000u) + (uint64_t)now.tv_nsec;
+}
+
+
+/*---------------------------------------------------
+* Definition of function TelemetryHistogramInit()
+* Parameters:
+*	histogram: histogram to be initialized, all counters are set to 0
+* Return value: none
+------------------------------------------------------*/
+void TelemetryHistogramInit(TelemetryHistogram *histogram) {
+
+	// Definition of local variables
+	unsigned int index = 0;				// Loop index
+
+	for(index = 0; index < TELEMETRY_BUCKETS; index++)
+	{
+		atomic_init(&histogram->bucket[index], 0);
+	}
+	atomic_init(&histogram->count, 0);
+	atomic_init(&histogram->sum_ns, 0);
+}
+
+
+/*---------------------------------------------------
+* Definition of function TelemetryRecordLatency()
+* Parameters:
+*	histogram: histogram initialized with TelemetryHistogramInit() (or TelemetryInit())
+*	latency_ns: latency in ns
+* Return value: none
+------------------------------------------------------*/
+void TelemetryRecordLatency(TelemetryHistogram *histogram, uint64_t latency_ns) {
+
+	// Definition of local variables
+	unsigned int bucket = 0;			// bucket of the latency, smallest i with latency <= 2^i ns
+
+	while((bucket < (TELEMETRY_BUCKETS - 1)) && (latency_ns > ((uint64_t)1 << bucket)))
+	{
+		bucket++;
+	}
+
+	atomic_fetch_add_explicit(&histogram->bucket[bucket], 1, memory_order_relaxed);
+	atomic_fetch_add_explicit(&histogram->count, 1, memory_order_relaxed);
+	atomic_fetch_add_explicit(&histogram->sum_ns, latency_ns, memory_order_relaxed);
+}
+
+
+/*---------------------------------------------------
+* Definition of function TelemetryRecordCall()
+* Parameters:
+*	telemetry: telemetry initialized with TelemetryInit()
+*	latency_ns: latency of a single evaluation in ns
+* Return value: none
+------------------------------------------------------*/
+void TelemetryRecordCall(Telemetry *telemetry, uint64_t latency_ns) {
+
+	TelemetryRecordLatency(&telemetry->call_latency, latency_ns);
+}
+
+
+/*---------------------------------------------------
+* Definition of function TelemetryRecordScan()
+* Parameters:
+*	telemetry: telemetry initialized with TelemetryInit()
+*	latency_ns: latency of a scan in ns
+* Return value: none
+------------------------------------------------------*/
+void TelemetryRecordScan(Telemetry *telemetry, uint64_t latency_ns) {
+
+	TelemetryRecordLatency(&telemetry->scan_latency, latency_ns);
+}
+
+
+/*---------------------------------------------------
+* Definition of function TelemetryCountResult()
+* Parameters:
+*	telemetry: telemetry initialized with TelemetryInit()
+*	group: channel group, groups >= TELEMETRY_GROUPS are counted in the last group
+*	temp_ok: result 7, 3, 5 or 6, other values are not counted
+* Return value: none
+------------------------------------------------------*/
+void TelemetryCountResult(Telemetry *telemetry, unsigned int group, unsigned int temp_ok) {
+
+	// Definition of local variables
+	unsigned int index = 0;				// Loop index over the result codes
+
+	if(group >= TELEMETRY_GROUPS)
+	{
+		group = TELEMETRY_GROUPS - 1;
+	}
+
+	for(index = 0; index < TELEMETRY_RESULT_CODES; index++)
+	{
+		if(temp_ok == RESULT_CODES[index])
+		{
+			atomic_fetch_add_explicit(&telemetry->results[group][index], 1, memory_order_relaxed);
+		}
+	}
+}
+
+
+/*---------------------------------------------------
+* Definition of function TelemetryCountResults()
+* Counts the results of a batch (e.g. ChannelStore temp_ok), the results are counted locally first
+* Parameters:
+*	telemetry: telemetry initialized with TelemetryInit()
+*	group: channel group, groups >= TELEMETRY_GROUPS are counted in the last group
+*	temp_ok: results 7, 3, 5 or 6, other values are not counted
+*	count: number of results
+* Return value: none
+------------------------------------------------------*/
+void TelemetryCountResults(Telemetry *telemetry, unsigned int group, const uint8_t *temp_ok, unsigned int count) {
+
+	// Definition of local variables
+	unsigned long counted[TELEMETRY_RESULT_CODES] = {0, 0, 0, 0};	// number of results 7, 3, 5, 6 of the batch
+	unsigned int index = 0;				// Loop index
+
+	if(group >= TELEMETRY_GROUPS)
+	{
+		group = TELEMETRY_GROUPS - 1;
+	}
+
+	for(index = 0; index < count; index++)
+	{
+		counted[0] += (temp_ok[index] == 7);
+		counted[1] += (temp_ok[index] == 3);
+		counted[2] += (temp_ok[index] == 5);
+		counted[3] += (temp_ok[index] == 6);
+	}
+
+	for(index = 0; index < TELEMETRY_RESULT_CODES; index++)
+	{
+		atomic_fetch_add_explicit(&telemetry->results[group][index], counted[index], memory_order_relaxed);
+	}
+}
+
+
+/*---------------------------------------------------
+* Definition of function TelemetryFormat()
+* Parameters:
+*	telemetry: telemetry initialized with TelemetryInit()
+*	text: buffer for the text in Prometheus text format
+*	size: size of the buffer in bytes
+* Return value:
+*	used: length of the text (without terminating 0), the text is truncated if the buffer is too small
+------------------------------------------------------*/
+size_t TelemetryFormat(Telemetry *telemetry, char *text, size_t size) {
+
+	// Definition of local variables
+	size_t used = 0;					// Return value: length of the text
+	unsigned int group = 0;				// Loop index over the groups
+	unsigned int index = 0;				// Loop index over the result codes
+
+	text[0] = '\0';
+	used += FormatHistogram(&telemetry->call_latency, "monitortemp_call_latency_seconds",
+			"Latency of a single evaluation", text + used, size - used);
+	used += FormatHistogram(&telemetry->scan_latency, "monitortemp_scan_latency_seconds",
+			"Latency of a scan of a batch of channels", text + used, size - used);
+
+	used = Append(size, used, snprintf(text + used, size - used,
+			"# HELP monitortemp_results_total Results of the evaluation (7: OK, 3: alarm, 5: function failure, 6: sensor health failure)\n"
+			"# TYPE monitortemp_results_total counter\n"));
+	for(group = 0; group < TELEMETRY_GROUPS; group++)
+	{
+		for(index = 0; index < TELEMETRY_RESULT_CODES; index++)
+		{
+			used = Append(size, used, snprintf(text + used, size - used,
+					"monitortemp_results_total{group=\"%u\",code=\"%u\"} %lu\n", group, RESULT_CODES[index],
+					atomic_load_explicit(&telemetry->results[group][index], memory_order_relaxed)));
+		}
+	}
+
+	return used;
+}
+
+
+#if defined(__unix__) || defined(__APPLE__)
+/*---------------------------------------------------
+* Definition of function TelemetryServerStart()
+* WARNING: TelemetryServerStart() is hardware dependent (Unix domain sockets)
+* Parameters:
+*	server: endpoint to be started
+*	telemetry: telemetry to be served
+*	path: path of the Unix domain socket, an existing file is replaced
+* Return value:
+*	start_ok: unsigned integer, 1 if the endpoint is running, 0 otherwise
+------------------------------------------------------*/
+unsigned int TelemetryServerStart(TelemetryServer *server, Telemetry *telemetry, const char *path) {
+
+	// Definition of local variables
+	unsigned int start_ok = 0;			// Return value, defensive programming: initialize with 0 (failure)
+	struct sockaddr_un address;			// address of the socket
+
+	memset(&address, 0, sizeof(address));
+	address.sun_family = AF_UNIX;
+	strncpy(address.sun_path, path, sizeof(address.sun_path) - 1);
+	strncpy(server->path, address.sun_path, sizeof(server->path) - 1);
+	server->path[sizeof(server->path) - 1] = '\0';
+	server->telemetry = telemetry;
+	atomic_init(&server->running, 1);
+
+	server->socket = socket(AF_UNIX, SOCK_STREAM, 0);
+	if(server->socket >= 0)
+	{
+		unlink(server->path);
+		if((bind(server->socket, (struct sockaddr *)&address, sizeof(address)) == 0) && (listen(server->socket, 4) == 0)
+				&& (pthread_create(&server->thread, 0, TelemetryServerThread, server) == 0))
+		{
+			start_ok = 1;
+		}
+		else
+		{
+			close(server->socket);
+			unlink(server->path);
+		}
+	}
+
+	return start_ok;
+}
+
+
+/*---------------------------------------------------
+* Definition of function TelemetryServerStop()
+* Parameters:
+*	server: endpoint started with TelemetryServerStart()
+* Return value: none
+------------------------------------------------------*/
+void TelemetryServerStop(TelemetryServer *server) {
+
+	atomic_store(&server->running, 0);
+	/*Wakes up the thread waiting in accept()*/
+	shutdown(server->socket, SHUT_RDWR);
+	pthread_join(server->thread, 0);
+	close(server->socket);
+	unlink(server->path);
+}
+#else
+/*---------------------------------------------------
+* Definition of function TelemetryServerStart()
+* The endpoint is not available on this system
+* Return value:
+*	start_ok: unsigned integer, always 0
+------------------------------------------------------*/
+unsigned int TelemetryServerStart(TelemetryServer *server, Telemetry *telemetry, const char *path) {
+
+	(void)server;
+	(void)telemetry;
+	(void)path;
+
+	return 0;
+}
+
+
+/*---------------------------------------------------
+* Definition of function TelemetryServerStop()
+* The endpoint is not available on this system
+------------------------------------------------------*/
+void TelemetryServerStop(TelemetryServer *server) {
+
+	(void)server;
+}
+#endif
+
+
+
+// Definition of local (module level) functions
+
+/*---------------------------------------------------
+* Definition of function FormatHistogram()
+* Parameters:
+*	histogram: histogram to be formatted
+*	name: metric name
+*	help: help text of the metric
+*	text: buffer for the text
+*	size: size of the buffer in bytes
+* Return value:
+*	used: length of the text
+------------------------------------------------------*/
+static size_t FormatHistogram(TelemetryHistogram *histogram, const char *name, const char *help, char *text, size_t size) {
+
+	// Definition of local variables
+	size_t used = 0;					// Return value: length of the text
+	unsigned long cumulative = 0;		// number of latencies up to the actual bucket
+	unsigned int bucket = 0;			// Loop index over the buckets
+
+	used = Append(size, used, snprintf(text + used, size - used, "# HELP %s %s\n# TYPE %s histogram\n", name, help, name));
+
+	/*The last bucket has no upper bound, it is only contained in +Inf*/
+	for(bucket = 0; bucket < (TELEMETRY_BUCKETS - 1); bucket++)
+	{
+		cumulative += atomic_load_explicit(&histogram->bucket[bucket], memory_order_relaxed);
+		used = Append(size, used, snprintf(text + used, size - used, "%s_bucket{le=\"%.9g\"} %lu\n",
+				name, (double)((uint64_t)1 << bucket) * 1.0e-9, cumulative));
+	}
+	cumulative += atomic_load_explicit(&histogram->bucket[TELEMETRY_BUCKETS - 1], memory_order_relaxed);
+
+	used = Append(size, used, snprintf(text + used, size - used, "%s_bucket{le=\"+Inf\"} %lu\n%s_sum %.9f\n%s_count %lu\n",
+			name, cumulative, name, (double)atomic_load_explicit(&histogram->sum_ns, memory_order_relaxed) * 1.0e-9,
+			name, cumulative));
+
+	return used;
+}
+
+
+/*---------------------------------------------------
+* Definition of function Append()
+* Parameters:
+*	size: size of the buffer in bytes
+*	used: length of the text before snprintf()
+*	written: return value of snprintf()
+* Return value:
+*	used: length of the text after snprintf(), limited to the buffer
+------------------------------------------------------*/
+static size_t Append(size_t size, size_t used, int written) {
+
+	if(written > 0)
+	{
+		used += (size_t)written;
+	}
+	if(used >= size)
+	{
+		used = (size > 0) ? (size - 1) : 0;
+	}
+
+	return used;
+}
+
+
+#if defined(__unix__) || defined(__APPLE__)
+/*---------------------------------------------------
+* Definition of function TelemetryServerThread()
+* Answers every connection with the actual telemetry (HTTP/1.0), until TelemetryServerStop() is called
+* Parameters:
+*	argument: TelemetryServer of the thread
+* Return value: none (0)
+------------------------------------------------------*/
+static void *TelemetryServerThread(void *argument) {
+
+	// Definition of local variables
+	TelemetryServer *server = argument;	// endpoint of this thread
+	int connection = -1;				// accepted connection
+	char request[512];					// request, only read to be discarded
+	char header[128];					// HTTP header of the answer
+	size_t length = 0;					// length of the text
+	int header_length = 0;				// length of the header
+	long pause = ACCEPT_PAUSE_MIN_MS;	// pause after the next failed accept() in ms
+
+	while(atomic_load(&server->running) == 1)
+	{
+		connection = accept(server->socket, 0, 0);
+		if(connection >= 0)
+		{
+			pause = ACCEPT_PAUSE_MIN_MS;
+			PrepareConnection(connection);
+			/*The request is discarded, after the timeout the answer is sent without request*/
+			(void)recv(connection, request, sizeof(request), 0);
+			length = TelemetryFormat(server->telemetry, server->text, sizeof(server->text));
+			header_length = snprintf(header, sizeof(header),
+					"HTTP/1.0 200 OK\r\nContent-Type: text/plain; version=0.0.4\r\nContent-Length: %lu\r\n\r\n",
+					(unsigned long)length);
+			if(SendAll(connection, header, (size_t)header_length) == 1)
+			{
+				(void)SendAll(connection, server->text, length);
+			}
+			close(connection);
+		}
+		else if((errno == EBADF) || (errno == EINVAL) || (errno == ENOTSOCK))
+		{
+			/*The listening socket is shut down (TelemetryServerStop()) or unusable*/
+			atomic_store(&server->running, 0);
+		}
+		else if((errno != EINTR) && (errno != ECONNABORTED))
+		{
+			/*e.g. no file descriptors left: wait instead of repeating accept() in a busy loop*/
+			Pause(pause);
+			pause = ((2 * pause) < ACCEPT_PAUSE_MAX_MS) ? (2 * pause) : ACCEPT_PAUSE_MAX_MS;
+		}
+	}
+
+	return 0;
+}
+
+
+/*---------------------------------------------------
+* Definition of function PrepareConnection()
+* Sets the receive and send timeouts of an accepted connection and, if send() has no MSG_NOSIGNAL, SO_NOSIGPIPE
+* Parameters:
+*	connection: accepted connection
+* Return value: none
+------------------------------------------------------*/
+static void PrepareConnection(int connection) {
+
+	// Definition of local variables
+	struct timeval timeout;				// timeout of receive and send
+
+	timeout.tv_sec = CONNECTION_TIMEOUT_MS / 1000;
+	timeout.tv_usec = (CONNECTION_TIMEOUT_MS % 1000) * 1000;
+	(void)setsockopt(connection, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+	(void)setsockopt(connection, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+#if !defined(MSG_NOSIGNAL) && defined(SO_NOSIGPIPE)
+	{
+		int on = 1;						// option value
+		(void)setsockopt(connection, SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on));
+	}
+#endif
+}
+
+
+/*---------------------------------------------------
+* Definition of function SendAll()
+* Parameters:
+*	connection: accepted connection
+*	data: data to be sent
+*	length: length of the data in bytes
+* Return value:
+*	send_ok: unsigned integer, 1 if all data was sent, 0 if the connection was closed or timed out
+------------------------------------------------------*/
+static unsigned int SendAll(int connection, const char *data, size_t length) {
+
+	// Definition of local variables
+	size_t sent = 0;					// number of sent bytes
+	ssize_t written = 0;				// return value of send()
+
+	while(sent < length)
+	{
+		written = send(connection, data + sent, length - sent, SEND_FLAGS);
+		if(written > 0)
+		{
+			sent += (size_t)written;
+		}
+		else if((written < 0) && (errno == EINTR))
+		{
+			continue;
+		}
+		else
+		{
+			break;
+		}
+	}
+
+	return (sent == length);
+}
+
+
+/*---------------------------------------------------
+* Definition of function Pause()
+* Parameters:
+*	milliseconds: pause in ms
+* Return value: none
+------------------------------------------------------*/
+static void Pause(long milliseconds) {
+
+	// Definition of local variables
+	struct timespec pause;				// pause
+
+	pause.tv_sec = milliseconds / 1000;
+	pause.tv_nsec = (milliseconds % 1000) * 1000000L;
+	(void)nanosleep(&pause, 0);
+}
+#endif
+
+
+// End of file telemetry.c
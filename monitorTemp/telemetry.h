@@ -0,0 +1,100 @@
+/* ---------------------------------------------------------------------------------------------
+ * Module Name: Safe Temperature Monitoring
+ * File Name: telemetry.h
+ * Corresponding Source-File: telemetry.c
+ * Created on: 19.10.2026
+ * Development Group: CKN GmbH
+ * Project: FSQM SW Development Exercise
+ * Dependencies: stdatomic.h (C11), POSIX threads and Unix domain sockets for the endpoint
+ * 		(hardware dependent, the endpoint is not available on other systems)
+ *
+ * Description: This file contains the function prototypes of the telemetry of the monitoring.
+ * The implementation of the functions can be found in the corresponding source file telemetry.c
+ *
+ *  telemetryRecordCall() and telemetryRecordScan() add a latency to the histogram of single
+ *  evaluations and of scans; telemetryCountResults() counts the results 7, 3, 5 and 6 of a channel group
+ *
+ *  all counters are atomic and updated without lock (relaxed), so that recording costs only a few
+ *  instructions in the scan loop
+ *
+ *  telemetryFormat() writes all counters in the Prometheus text format, telemetryServerStart()
+ *  serves this text on a local Unix domain socket (HTTP), e.g. curl --unix-socket <path> http://localhost/metrics
+ * ----------------------------------------------------------------------------------------------
+ * Versions:
+ *
+ * Version: 0.1 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * Initial version, definition of functions
+ *
+ * Version: 0.2 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * TelemetryHistogramInit() and TelemetryRecordLatency() made public
+ *
+ * Version: 0.3 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * Counter for result 6 (sensor health failure) added
+ *
+ * Version: 0.4 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * Answer sent with send() without SIGPIPE, connection timeouts, pause after failed accept() calls
+ *
+ * ----------------------------------------------------------------------------------------------  */
+
+#ifndef TELEMETRY_H_
+#define TELEMETRY_H_
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <pthread.h>
+
+// Declaration of constants (enumeration constants, usable as array sizes)
+enum {
+	TELEMETRY_BUCKETS = 32,			// latency buckets, upper bound of bucket i is 2^i ns
+	TELEMETRY_GROUPS = 16,			// channel groups with own result counters
+	TELEMETRY_RESULT_CODES = 4,		// counted results 7, 3, 5 and 6
+	TELEMETRY_TEXT_SIZE = 16384		// size of the text buffer of the endpoint
+};
+
+// Declaration of types
+// Latency histogram, bucket i counts latencies of (2^(i-1), 2^i] ns, the last bucket all larger ones
+typedef struct {
+	atomic_ulong bucket[TELEMETRY_BUCKETS];	// number of latencies per bucket
+	atomic_ulong count;						// number of latencies
+	atomic_ullong sum_ns;					// sum of all latencies in ns
+} TelemetryHistogram;
+
+// All telemetry of the monitoring
+typedef struct {
+	TelemetryHistogram call_latency;		// latency of single evaluations
+	TelemetryHistogram scan_latency;		// latency of scans (batches)
+	atomic_ulong results[TELEMETRY_GROUPS][TELEMETRY_RESULT_CODES];	// number of results 7, 3, 5, 6 per channel group
+} Telemetry;
+
+// Local endpoint, serving the telemetry in Prometheus text format
+typedef struct {
+	Telemetry *telemetry;					// telemetry to be served
+	pthread_t thread;						// thread accepting the connections
+	int socket;								// listening socket
+	atomic_int running;						// 1 while the thread shall accept connections
+	char path[108];							// path of the Unix domain socket
+	char text[TELEMETRY_TEXT_SIZE];			// preallocated text buffer
+} TelemetryServer;
+
+extern void TelemetryInit(Telemetry *telemetry);
+extern void TelemetryHistogramInit(TelemetryHistogram *histogram);
+extern void TelemetryRecordLatency(TelemetryHistogram *histogram, uint64_t latency_ns);
+extern uint64_t TelemetryNow(void);
+extern void TelemetryRecordCall(Telemetry *telemetry, uint64_t latency_ns);
+extern void TelemetryRecordScan(Telemetry *telemetry, uint64_t latency_ns);
+extern void TelemetryCountResult(Telemetry *telemetry, unsigned int group, unsigned int temp_ok);
+extern void TelemetryCountResults(Telemetry *telemetry, unsigned int group, const uint8_t *temp_ok, unsigned int count);
+extern size_t TelemetryFormat(Telemetry *telemetry, char *text, size_t size);
+extern unsigned int TelemetryServerStart(TelemetryServer *server, Telemetry *telemetry, const char *path);
+extern void TelemetryServerStop(TelemetryServer *server);
+
+#endif /* TELEMETRY_H_ */
@@ -0,0 +1,244 @@
+/* ---------------------------------------------------------------------------------------------
+* Module Name: Telemetry Testing for TelemetryFormat()
+* File Name: telemetry_testing.c
+* Corresponding Header-File: telemetry_testing.h
+* Created on: 19.10.2026
+* Development Group: CKN GmbH
+* Project: FSQM SW Development Exercise (Telemetry Testing Functions)
+* Dependencies: TelemetryFormat(), TelemetryServerStart(), ChannelStoreScan(), stdio.h, Unix domain sockets
+* 		(hardware dependent)
+*
+* Description: This file contains the telemetry testing function
+*
+* PerformTelemetryTest() is a function, which records the results and the latency of a scan of the
+* channel store and checks the Prometheus text of the telemetry, also as answer of the endpoint after
+* clients which disconnected early or sent nothing
+*
+* ----------------------------------------------------------------------------------------------
+* Versions:
+* Version: 0.1 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* 2 telemetry tests were implemented
+*
+* Version: 0.2 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Round trip test of the endpoint with early disconnect and silent client
+*
+* ----------------------------------------------------------------------------------------------*/
+// Include system header files
+#include <stdio.h> // stdio.h is necessary for printing/reading via standard IO
+#include <string.h> // string.h is necessary for string operations
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/socket.h> // sys/socket.h is necessary for the clients of the endpoint
+#include <sys/time.h> // sys/time.h is necessary for the timeout of a client
+#include <sys/un.h> // sys/un.h is necessary for Unix domain sockets
+#include <unistd.h> // unistd.h is necessary for close/access/getpid
+#endif
+// Include own header files
+#include "channelStore.h"
+#include "telemetry.h"
+// Definition of global constants (only if really necessary, see coding rules)
+// No globals
+// Definition of global variables (should be avoided, see coding rules)
+// No globals
+// Declaration of local functions
+#if defined(__unix__) || defined(__APPLE__)
+static int ConnectEndpoint(const char *path);
+static size_t ScrapeEndpoint(const char *path, char *response, size_t size);
+#endif
+// Definition of global and local functions (sorted by topic, if possible)
+
+/*---------------------------------------------------
+* Definition of function PerformTelemetryTest()
+* Parameters:
+* None
+* Return value:
+* test_complete: unsigned integer, 1 if all tests were succesful, 0 if one or more tests failed
+------------------------------------------------------*/
+unsigned int PerformTelemetryTest(void) {
+	// Definition of local variables
+	static Telemetry telemetry; // telemetry under test (static because of its size)
+	static char text[TELEMETRY_TEXT_SIZE]; // Prometheus text
+#if defined(__unix__) || defined(__APPLE__)
+	static TelemetryServer server; // endpoint under test (static because of its size)
+	static char response[TELEMETRY_TEXT_SIZE + 256]; // answer of the endpoint
+	char path[64]; // path of the socket of the endpoint
+	int early = -1; // client which disconnects before the answer
+	int silent = -1; // client which sends no request
+	size_t received = 0; // length of the answer
+	const char *request = "GET /metrics HTTP/1.0\r\n\r\n"; // request of the early client
+#endif
+	ChannelStore store; // channel store with 3 channels: OK, alarm, no reading
+	unsigned int channel = 0; // index of a registered channel
+	uint64_t start = 0; // start of the scan in ns
+	char message[40]; // String array for test result message
+	unsigned int total_tests = 0; // Total number of tests
+	unsigned int successful_tests = 0; // Total number of successful test
+
+	unsigned int test_complete = 0; // 1 if all tests OK, 0 if one or more tests failed
+	// For printf() function, buffer setting (no buffering)
+	setvbuf(stdout, NULL, _IONBF, 0);
+
+	if (ChannelStoreInit(&store, 3) == 0) {
+		printf("\n\nTMT: channel store could not be allocated\n");
+		return 0;
+	}
+	TelemetryInit(&telemetry);
+	ChannelStoreRegister(&store, "OK", 'C', -10.0, 80.0, 3.0, &channel);
+	ChannelStoreSetReading(&store, channel, 55.1, 55.5);
+	ChannelStoreRegister(&store, "alarm", 'C', -10.0, 80.0, 3.0, &channel);
+	ChannelStoreSetReading(&store, channel, 85.0, 85.0);
+	ChannelStoreRegister(&store, "no reading", 'C', -10.0, 80.0, 3.0, &channel);
+	// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+	// Telemetry tests (TMT)
+	// +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+	// TMT1: The results of a scan are counted per code
+	total_tests++;
+	printf("\n\nTMT1: Test with one channel of each result, results are counted\n");
+	// Initialize test result message with negative test result, will only be changed if test is successful
+	strcpy(message, "TMT1 FAILED\0");
+	start = TelemetryNow();
+	ChannelStoreScan(&store, 0, store.count);
+	TelemetryRecordScan(&telemetry, TelemetryNow() - start);
+	TelemetryCountResults(&telemetry, 2, store.temp_ok, store.count);
+	TelemetryFormat(&telemetry, text, sizeof(text));
+	// Expected: one result of each code in group 2
+	if ((strstr(text, "monitortemp_results_total{group=\"2\",code=\"7\"} 1\n") != 0)
+			&& (strstr(text, "monitortemp_results_total{group=\"2\",code=\"3\"} 1\n") != 0)
+			&& (strstr(text, "monitortemp_results_total{group=\"2\",code=\"5\"} 1\n") != 0)
+			&& (strstr(text, "monitortemp_results_total{group=\"0\",code=\"7\"} 0\n") != 0)) {
+		strcpy(message, "TMT1 SUCCESFUL\0");
+		successful_tests++;
+	}
+	// Print test result
+	printf("\n%s", message);
+	// End of TMT1
+
+	// TMT2: Latencies are sorted into cumulative buckets
+	total_tests++;
+	printf("\n\nTMT2: Test with latencies 1 ns, 3 ns and 10 s, cumulative buckets\n");
+	// Initialize test result message with negative test result, will only be changed if test is successful
+	strcpy(message, "TMT2 FAILED\0");
+	TelemetryRecordCall(&telemetry, 1);
+	TelemetryRecordCall(&telemetry, 3);
+	TelemetryRecordCall(&telemetry, 10000000000u);
+	TelemetryFormat(&telemetry, text, sizeof(text));
+	// Expected: 1 latency <= 1 ns, 2 latencies <= 4 ns, 3 latencies in total
+	if ((strstr(text, "monitortemp_call_latency_seconds_bucket{le=\"1e-09\"} 1\n") != 0)
+			&& (strstr(text, "monitortemp_call_latency_seconds_bucket{le=\"4e-09\"} 2\n") != 0)
+			&& (strstr(text, "monitortemp_call_latency_seconds_bucket{le=\"+Inf\"} 3\n") != 0)
+			&& (strstr(text, "monitortemp_call_latency_seconds_count 3\n") != 0)
+			&& (strstr(text, "monitortemp_scan_latency_seconds_count 1\n") != 0)) {
+		strcpy(message, "TMT2 SUCCESFUL\0");
+		successful_tests++;
+	}
+	// Print test result
+	printf("\n%s", message);
+	// End of TMT2
+
+#if defined(__unix__) || defined(__APPLE__)
+	// TMT3: The endpoint answers a scrape after a client which disconnected early and a client which sends nothing
+	total_tests++;
+	printf("\n\nTMT3: Test of the endpoint with an early disconnect, a silent client and a scrape\n");
+	// Initialize test result message with negative test result, will only be changed if test is successful
+	strcpy(message, "TMT3 FAILED\0");
+	snprintf(path, sizeof(path), "/tmp/monitortemp_tmt3_%ld.sock", (long)getpid());
+	if (TelemetryServerStart(&server, &telemetry, path) == 1) {
+		// the answer to this client fails (EPIPE), which must not end the test program by SIGPIPE
+		early = ConnectEndpoint(path);
+		if (early >= 0) {
+			(void)send(early, request, strlen(request), 0);
+			close(early);
+		}
+		// this client is dropped after the receive timeout of the endpoint
+		silent = ConnectEndpoint(path);
+		received = ScrapeEndpoint(path, response, sizeof(response));
+		if (silent >= 0) {
+			close(silent);
+		}
+		TelemetryServerStop(&server);
+		// Expected: complete answer with the results of TMT1, socket file removed
+		if ((early >= 0) && (silent >= 0) && (received > 0)
+				&& (strncmp(response, "HTTP/1.0 200 OK\r\n", 17) == 0)
+				&& (strstr(response, "monitortemp_results_total{group=\"2\",code=\"7\"} 1\n") != 0)
+				&& (access(path, F_OK) != 0)) {
+			strcpy(message, "TMT3 SUCCESFUL\0");
+			successful_tests++;
+		}
+	}
+	// Print test result
+	printf("\n%s", message);
+	// End of TMT3
+#endif
+
+	ChannelStoreFree(&store);
+
+	test_complete = (successful_tests == total_tests);
+
+	return test_complete;
+
+}
+
+
+#if defined(__unix__) || defined(__APPLE__)
+/*---------------------------------------------------
+* Definition of function ConnectEndpoint()
+* Parameters:
+*	path: path of the socket of the endpoint
+* Return value:
+*	client: connected socket with a receive timeout of 5 s, -1 if the connection failed
+------------------------------------------------------*/
+static int ConnectEndpoint(const char *path) {
+	// Definition of local variables
+	struct sockaddr_un address; // address of the endpoint
+	struct timeval timeout = {5, 0}; // receive timeout, the test must not wait forever
+	int client = socket(AF_UNIX, SOCK_STREAM, 0); // Return value
+
+	memset(&address, 0, sizeof(address));
+	address.sun_family = AF_UNIX;
+	strncpy(address.sun_path, path, sizeof(address.sun_path) - 1);
+	if ((client >= 0) && (connect(client, (struct sockaddr *)&address, sizeof(address)) != 0)) {
+		close(client);
+		client = -1;
+	}
+	if (client >= 0) {
+		(void)setsockopt(client, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+	}
+
+	return client;
+}
+
+
+/*---------------------------------------------------
+* Definition of function ScrapeEndpoint()
+* Parameters:
+*	path: path of the socket of the endpoint
+*	response: buffer for the answer, terminated with 0
+*	size: size of the buffer in bytes
+* Return value:
+*	received: length of the answer, 0 if the scrape failed
+------------------------------------------------------*/
+static size_t ScrapeEndpoint(const char *path, char *response, size_t size) {
+	// Definition of local variables
+	int client = ConnectEndpoint(path); // connection to the endpoint
+	const char *request = "GET /metrics HTTP/1.0\r\n\r\n"; // request of the scrape
+	ssize_t part = 0; // length of a received part
+	size_t received = 0; // Return value
+
+	response[0] = '\0';
+	if (client >= 0) {
+		if (send(client, request, strlen(request), 0) == (ssize_t)strlen(request)) {
+			do {
+				part = recv(client, response + received, size - 1 - received, 0);
+				received += (part > 0) ? (size_t)part : 0;
+			} while ((part > 0) && (received < (size - 1)));
+			response[received] = '\0';
+		}
+		close(client);
+	}
+
+	return received;
+}
+#endif
@@ -0,0 +1,33 @@
+/* ---------------------------------------------------------------------------------------------
+ * Module Name: Safe Temperature Monitoring
+ * File Name: telemetry_testing.h
+ * Corresponding Source-File: telemetry_testing.c
+ * Created on: 19.10.2026
+ * Development Group: CKN GmbH
+ * Project: FSQM SW Development Exercise
+ * Dependencies: TelemetryFormat(), stdio.h (hardware dependent)
+ *
+ * Description: This file contains the test cases for the telemetry of the Safe Temperature Monitoring module
+ *
+
+ * ----------------------------------------------------------------------------------------------
+ * Versions:
+ *
+ * Version: 0.1 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * Initial version, definition of functions
+ *
+ * Version: 0.2 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * Round trip test of the endpoint with early disconnect and silent client
+ *
+ * ----------------------------------------------------------------------------------------------  */
+
+#ifndef TELEMETRY_TESTING_H_
+#define TELEMETRY_TESTING_H_
+
+extern unsigned int PerformTelemetryTest(void);
+
+#endif /* TELEMETRY_TESTING_H_ */
@@ -0,0 +1,62 @@
+/* ---------------------------------------------------------------------------------------------
+* Module Name: Safe Temperature Monitoring
+* File Name: testVectors.c
+* Corresponding Header-File: testVectors.h
+* Created on: 19.10.2026
+* Development Group: CKN GmbH
+* Project: FSQM SW Development Exercise
+* Dependencies: none
+*
+* Description: This file contains the table of the fixed test vectors of the periodic self-test, which
+* are copies of the vectors of the test functions.
+*
+*  testVectorGet() returns the vector of a test (TEST_VECTOR_BBT1 ... TEST_VECTOR_WBT4)
+*
+* ----------------------------------------------------------------------------------------------
+* Versions:
+* Version: 0.1 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Initial version, vectors of the test functions and of the self-test moved here
+*
+* Version: 0.2 (under development)
+* Modified on: 19.10.2026
+* Description of Modifications:
+* Test functions keep their literal vectors, the table is checked by STT4
+*
+* ----------------------------------------------------------------------------------------------*/
+
+// Include own header files
+#include "testVectors.h"
+
+// Definition of local (module level) constants
+// Vectors of BBT1, BBT2, NT1, NT2, BT1, BT2, ST1, ST2, CCT1, CCT2, WBT3 and WBT4 (order of the enumeration)
+static const TestVector VECTORS[TEST_VECTOR_COUNT] = {
+	{'C', -10.0f, 80.0f, 3.0f, 55.1f, 55.5f, 7},
+	{'C', -100.0f, 120.0f, 5.0f, 99.9f, 100.1f, 7},
+	{'C', -274.0f, 80.0f, 3.0f, 50.0f, 50.0f, 5},
+	{'C', -300.0f, -274.0f, 3.0f, 50.0f, 50.0f, 5},
+	{'C', -273.15f, 80.0f, 3.0f, -273.15f, -272.0f, 7},
+	{'C', -273.15f, 80.0f, 3.0f, -272.0f, -273.15f, 7},
+	{'C', -273.15f, 1000.0f, 3.0f, 55.1f, 57.6f, 7},
+	{'C', -273.15f, 1000.0f, 6.0f, 89.6f, 94.2f, 7},
+	{'C', -273.15f, 1000.0f, 8.0f, 55.1f, 62.0f, 7},
+	{'C', -273.15f, 1000.0f, 4.0f, 90.2f, 94.2f, 7},
+	{'C', 80.0f, -10.0f, 3.0f, 50.0f, 1001.0f, 5},
+	{'F', 32.0f, 212.0f, 5.0f, 220.0f, 200.0f, 3}
+};
+
+
+// Function Definitions
+
+/*---------------------------------------------------
+* Definition of function TestVectorGet()
+* Parameters:
+*	index: index of the vector, TEST_VECTOR_BBT1 ... TEST_VECTOR_WBT4
+* Return value:
+*	vector: pointer to the vector, 0 if index is not a valid index
+------------------------------------------------------*/
+const TestVector *TestVectorGet(unsigned int index) {
+
+	return (index < TEST_VECTOR_COUNT) ? &VECTORS[index] : 0;
+}
@@ -0,0 +1,67 @@
+/* ---------------------------------------------------------------------------------------------
+ * Module Name: Safe Temperature Monitoring
+ * File Name: testVectors.h
+ * Corresponding Source-File: testVectors.c
+ * Created on: 19.10.2026
+ * Development Group: CKN GmbH
+ * Project: FSQM SW Development Exercise
+ * Dependencies: none
+ *
+ * Description: This file contains the function prototypes of the fixed test vectors. The
+ * implementation of the functions can be found in the corresponding source file testVectors.c
+ *
+ *  the vectors of the black box, negative, boundary, statistical, code coverage and white box tests
+ *  are kept in one table for the periodic self-test (selfTest.c) and for the tests, which need valid
+ *  and failing channels (dual channel, pipeline, scan arena); the test functions keep their own
+ *  literal vectors, STT4 (selftest_testing.c) checks the table against EvaluateTemp()
+ * ----------------------------------------------------------------------------------------------
+ * Versions:
+ *
+ * Version: 0.1 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * Initial version, vectors of the test functions and of the self-test moved here
+ *
+ * Version: 0.2 (under development)
+ * Modified on: 19.10.2026
+ * Description of Modifications:
+ * Test functions keep their literal vectors, the table is checked by STT4
+ *
+ * ----------------------------------------------------------------------------------------------  */
+
+#ifndef TESTVECTORS_H_
+#define TESTVECTORS_H_
+
+// Declaration of constants (enumeration constants, usable as array sizes)
+// Index of the vector of every test in the table
+enum {
+	TEST_VECTOR_BBT1 = 0,
+	TEST_VECTOR_BBT2,
+	TEST_VECTOR_NT1,
+	TEST_VECTOR_NT2,
+	TEST_VECTOR_BT1,
+	TEST_VECTOR_BT2,
+	TEST_VECTOR_ST1,
+	TEST_VECTOR_ST2,
+	TEST_VECTOR_CCT1,
+	TEST_VECTOR_CCT2,
+	TEST_VECTOR_WBT3,
+	TEST_VECTOR_WBT4,
+	TEST_VECTOR_COUNT				// number of vectors
+};
+
+// Declaration of types
+// Test vector with the parameters of MonitorTemp() and the expected result
+typedef struct {
+	char format;
+	float min_temp;
+	float max_temp;
+	float max_deltatemp;
+	float temp_sensor1;
+	float temp_sensor2;
+	unsigned int expected;			// 7, 3 or 5 as for MonitorTemp()
+} TestVector;
+
+extern const TestVector *TestVectorGet(unsigned int index);
+
+#endif /* TESTVECTORS_H_ */
@@ -0,0 +1,94 @@
+#!/bin/sh
+# ---------------------------------------------------------------------------------------------
+# Module Name: Safe Temperature Monitoring
+# File Name: footprint_report.sh
+# Created on: 19.10.2026
+# Development Group: CKN GmbH
+# Project: FSQM SW Development Exercise
+# Dependencies: C compiler with -fstack-usage (gcc), nm and size of the same toolchain
+#
+# Description: Compiles the monitoring core (monitorTemp.c) freestanding, i.e. without libc and libm
+# (-ffreestanding -nostdlib -DMONITORTEMP_FREESTANDING), and reports the code size and the stack usage
+# of every function. The report fails (exit code 1), if the object needs another external symbol than
+# MonitorTempOutput() (the output hook of the application); helper functions of the compiler runtime
+# (e.g. __aeabi_fmul on targets without FPU) are listed, but accepted.
+#
+# Usage (from the repository root):
+#	tools/footprint_report.sh
+#	CC=arm-none-eabi-gcc NM=arm-none-eabi-nm SIZE=arm-none-eabi-size CFLAGS="-Os -mcpu=cortex-m0" tools/footprint_report.sh
+#
+# ----------------------------------------------------------------------------------------------
+# Versions:
+# Version: 0.1 (under development)
+# Modified on: 19.10.2026
+# Description of Modifications:
+# Initial version
+#
+# ----------------------------------------------------------------------------------------------
+
+CC=${CC:-gcc}
+NM=${NM:-nm}
+SIZE=${SIZE:-size}
+CFLAGS=${CFLAGS:--Os}
+SOURCE=$(dirname "$0")/../monitorTemp/monitorTemp.c
+WORKDIR=$(mktemp -d) || exit 1
+trap 'rm -rf "$WORKDIR"' EXIT
+
+# Freestanding build of the monitoring core
+if ! $CC -std=gnu11 $CFLAGS -Wall -Wextra -ffreestanding -nostdlib -DMONITORTEMP_FREESTANDING \
+		-fstack-usage -c "$SOURCE" -o "$WORKDIR/monitorTemp.o"; then
+	echo "footprint report: freestanding build failed" >&2
+	exit 1
+fi
+
+echo "Freestanding build of monitorTemp.c ($CC $CFLAGS)"
+echo
+echo "Sections:"
+$SIZE "$WORKDIR/monitorTemp.o"
+echo
+echo "Code size and stack usage per function in bytes (stack of the function itself, without called functions):"
+# The .su file contains "file:line:column:function<TAB>bytes<TAB>qualifier"
+$NM -S --size-sort --defined-only "$WORKDIR/monitorTemp.o" | awk -v su="$WORKDIR/monitorTemp.su" '
+	BEGIN {
+		FS = "\t"
+		while ((getline line < su) > 0) {
+			split(line, field, "\t")
+			count = split(field[1], position, ":")
+			stack[position[count]] = field[2] " (" field[3] ")"
+		}
+		FS = " "
+		printf "%-24s %8s  %s\n", "function", "code", "stack"
+	}
+	# nm prints the size in hex, strtonum() is not available in every awk
+	function hex(text,    value, index_) {
+		value = 0
+		for (index_ = 1; index_ <= length(text); index_++) {
+			value = value * 16 + index("0123456789abcdef", tolower(substr(text, index_, 1))) - 1
+		}
+		return value
+	}
+	$3 ~ /^[Tt]$/ {
+		# local clones of the optimizer are named e.g. AppendText.constprop.0 in nm and AppendText.constprop in the .su file
+		name = $4
+		sub(/\.[0-9]+$/, "", name)
+		printf "%-24s %8d  %s\n", $4, hex($2), (name in stack) ? stack[name] : "-"
+	}'
+echo
+
+# External symbols: only the output hook is allowed (no libc, no libm)
+echo "External symbols:"
+UNDEFINED=$($NM -u "$WORKDIR/monitorTemp.o" | awk '{ print $NF }')
+RESULT=0
+for SYMBOL in $UNDEFINED; do
+	case "$SYMBOL" in
+		MonitorTempOutput)
+			echo "  $SYMBOL (output hook of the application)";;
+		__*)
+			echo "  $SYMBOL (compiler runtime)";;
+		*)
+			echo "  $SYMBOL (NOT ALLOWED in the freestanding build)"
+			RESULT=1;;
+	esac
+done
+
+exit $RESULT